@@ -9,7 +9,18 @@
         "native/src/vdsp_ops.cc",
         "native/src/blas_ops.cc",
         "native/src/neon_montgomery.cc",
-        "native/src/sme_ops.cc"
+        "native/src/sme_ops.cc",
+        "native/src/msm_execute.cc",
+        "native/src/msm_recode.cc",
+        "native/src/msm_curve.cc",
+        "native/src/msm_incremental.cc",
+        "native/src/fixed_base.cc",
+        "native/src/msm_g2.cc",
+        "native/src/ntt_cpu.cc",
+        "native/src/arena.cc",
+        "native/src/autotune.cc",
+        "native/src/perf_counters.cc",
+        "native/src/srs_loader.cc"
       ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")",
@@ -115,6 +126,91 @@
           ]
         }]
       ]
+    },
+    {
+      "target_name": "zk_bench",
+      "type": "executable",
+      "sources": [
+        "native/bench/bench.cc",
+        "native/src/hardware_detect.cc",
+        "native/src/field_ops.cc",
+        "native/src/vdsp_ops.cc",
+        "native/src/blas_ops.cc",
+        "native/src/neon_montgomery.cc",
+        "native/src/sme_ops.cc",
+        "native/src/msm_execute.cc",
+        "native/src/msm_recode.cc",
+        "native/src/msm_curve.cc",
+        "native/src/msm_incremental.cc",
+        "native/src/fixed_base.cc",
+        "native/src/msm_g2.cc",
+        "native/src/ntt_cpu.cc",
+        "native/src/arena.cc",
+        "native/src/autotune.cc",
+        "native/src/perf_counters.cc"
+      ],
+      "include_dirs": [
+        "native/include"
+      ],
+      "cflags!": ["-fno-exceptions"],
+      "cflags_cc!": ["-fno-exceptions"],
+      "cflags_cc": [
+        "-std=c++17",
+        "-fexceptions"
+      ],
+      "conditions": [
+        ["OS=='mac'", {
+          "xcode_settings": {
+            "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
+            "CLANG_CXX_LIBRARY": "libc++",
+            "CLANG_CXX_LANGUAGE_STANDARD": "c++17",
+            "MACOSX_DEPLOYMENT_TARGET": "12.0",
+            "OTHER_CFLAGS": [
+              "-arch arm64",
+              "-mmacosx-version-min=12.0"
+            ],
+            "OTHER_CPLUSPLUSFLAGS": [
+              "-arch arm64",
+              "-mmacosx-version-min=12.0",
+              "-std=c++17"
+            ],
+            "OTHER_LDFLAGS": [
+              "-framework Accelerate",
+              "-framework Metal",
+              "-framework MetalKit",
+              "-framework Foundation",
+              "-framework CoreFoundation"
+            ],
+            "ARCHS": ["arm64"],
+            "VALID_ARCHS": ["arm64"],
+            "ONLY_ACTIVE_ARCH": "YES"
+          },
+          "defines": [
+            "APPLE_SILICON=1",
+            "TARGET_OS_MAC=1"
+          ],
+          "sources": [
+            "native/src/metal_compute.mm",
+            "native/src/metal_gpu.mm",
+            "native/src/metal_msm.mm",
+            "native/src/metal_ntt.mm"
+          ]
+        }],
+        ["OS=='linux'", {
+          "cflags": [
+            "-march=native",
+            "-O3"
+          ],
+          "cflags_cc": [
+            "-std=c++17",
+            "-march=native",
+            "-O3"
+          ],
+          "defines": [
+            "LINUX_BUILD=1"
+          ]
+        }]
+      ]
     }
   ]
 }
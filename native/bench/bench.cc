@@ -0,0 +1,393 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Native kernel benchmark harness
+ *
+ * Standalone binary (build/Release/zk_bench) exercising the CPU and GPU
+ * kernels across a size sweep without going through the Node/TS stack.
+ * Each benchmark runs a warmup pass plus repeated timed samples and
+ * reports the median as ns/op, ops/s, and GB/s. Intended for validating
+ * OS updates and comparing fleet hardware generations.
+ *
+ * Usage: zk_bench [filter]
+ *   filter  Only run benchmarks whose name contains this substring
+ */
+
+#include "../include/zk_accelerate.h"
+#include "../include/cpu_accelerate.h"
+#ifdef __APPLE__
+#include "../include/metal_gpu.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// BN254 base field modulus and Montgomery constant
+static const uint64_t BENCH_MODULUS[4] = {
+    0x3C208C16D87CFD47ULL,
+    0x97816A916871CA8DULL,
+    0xB85045B68181585DULL,
+    0x30644E72E131A029ULL
+};
+static const uint64_t BENCH_MU = 0x87D20782E4866389ULL;
+
+static const char* g_filter = nullptr;
+
+static bool bench_enabled(const std::string& name) {
+    return g_filter == nullptr || name.find(g_filter) != std::string::npos;
+}
+
+/**
+ * Run one benchmark: warmup, then timed samples, median reported
+ *
+ * fn performs `ops` operations touching `bytes` of data per invocation.
+ */
+template <typename Fn>
+static void run_bench(const std::string& name, size_t ops, size_t bytes, Fn fn) {
+    if (!bench_enabled(name)) {
+        return;
+    }
+
+    const int warmup = 2;
+    const int samples = 7;
+
+    for (int i = 0; i < warmup; i++) {
+        fn();
+    }
+
+    std::vector<double> times_ns(samples);
+    for (int s = 0; s < samples; s++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        times_ns[s] = std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    std::sort(times_ns.begin(), times_ns.end());
+    double median_ns = times_ns[samples / 2];
+
+    double ns_per_op = median_ns / (double)ops;
+    double ops_per_s = 1e9 / ns_per_op;
+    double gb_per_s = (double)bytes / median_ns; // bytes/ns == GB/s
+
+    printf("%-44s %12.2f ns/op %14.0f ops/s %8.2f GB/s\n",
+           name.c_str(), ns_per_op, ops_per_s, gb_per_s);
+}
+
+static void fill_field_elements(std::vector<uint64_t>& limbs, std::mt19937_64& rng) {
+    for (size_t i = 0; i < limbs.size(); i++) {
+        limbs[i] = rng();
+        if (i % 4 == 3) {
+            limbs[i] %= BENCH_MODULUS[3]; // keep elements below the modulus
+        }
+    }
+}
+
+static void bench_montgomery_mul(std::mt19937_64& rng) {
+    std::vector<uint64_t> a(4), b(4), r(4);
+    fill_field_elements(a, rng);
+    fill_field_elements(b, rng);
+
+    const size_t iters = 1000000;
+    run_bench("neon_montgomery_mul_4limb", iters, iters * 3 * 32, [&]() {
+        for (size_t i = 0; i < iters; i++) {
+            neon_montgomery_mul_4limb(a.data(), b.data(), BENCH_MODULUS, BENCH_MU, r.data());
+        }
+    });
+}
+
+static void bench_batch_montgomery_mul(std::mt19937_64& rng) {
+    for (size_t count : {1024, 16384, 262144}) {
+        std::vector<uint64_t> a(count * 4), b(count * 4), r(count * 4);
+        fill_field_elements(a, rng);
+        fill_field_elements(b, rng);
+
+        char name[96];
+        snprintf(name, sizeof(name), "neon_batch_montgomery_mul n=%zu", count);
+        run_bench(name, count, count * 3 * 32, [&]() {
+            neon_batch_montgomery_mul(a.data(), b.data(), BENCH_MODULUS, BENCH_MU, r.data(), count, 4);
+        });
+    }
+}
+
+static void bench_vdsp_butterfly(std::mt19937_64& rng) {
+    for (size_t n : {4096, 65536, 1048576}) {
+        std::vector<double> even(n), odd(n), tw_r(n), tw_i(n), out_e(n), out_o(n);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        std::mt19937_64 local(rng());
+        for (size_t i = 0; i < n; i++) {
+            even[i] = dist(local);
+            odd[i] = dist(local);
+            tw_r[i] = dist(local);
+            tw_i[i] = dist(local);
+        }
+
+        char name[96];
+        snprintf(name, sizeof(name), "vdsp_ntt_butterfly_f64 n=%zu", n);
+        run_bench(name, n, n * 6 * sizeof(double), [&]() {
+            vdsp_ntt_butterfly_f64(even.data(), odd.data(), tw_r.data(), tw_i.data(),
+                                   out_e.data(), out_o.data(), n);
+        });
+    }
+}
+
+static void bench_blas_bucket_accumulate(std::mt19937_64& rng) {
+    const size_t num_buckets = 256;
+    const size_t coord_size = 12;
+    for (size_t num_points : {4096, 65536}) {
+        std::vector<uint32_t> indices(num_points);
+        std::vector<double> coords(num_points * coord_size);
+        std::vector<double> accum(num_buckets * coord_size, 0.0);
+        for (size_t i = 0; i < num_points; i++) {
+            indices[i] = (uint32_t)(rng() % num_buckets);
+        }
+        for (size_t i = 0; i < coords.size(); i++) {
+            coords[i] = (double)(rng() % 1024);
+        }
+
+        char name[96];
+        snprintf(name, sizeof(name), "blas_bucket_accumulate n=%zu", num_points);
+        run_bench(name, num_points, num_points * coord_size * sizeof(double), [&]() {
+            blas_bucket_accumulate(indices.data(), coords.data(), accum.data(),
+                                   num_points, num_buckets, coord_size);
+        });
+    }
+}
+
+static void bench_sparse_bucket_accumulate(std::mt19937_64& rng) {
+    // BN254 generator (1, 2) in Montgomery form; the scatter cost does
+    // not depend on the points being distinct
+    static const uint64_t GX[4] = {
+        0xD35D438DC58F0D9DULL, 0x0A78EB28F5C70B3DULL,
+        0x666EA36F7879462CULL, 0x0E0A77C19A07DF2FULL
+    };
+    static const uint64_t GY[4] = {
+        0xA6BA871B8B1E1B3AULL, 0x14F1D651EB8E167BULL,
+        0xCCDD46DEF0F28C58ULL, 0x1C14EF83340FBE5EULL
+    };
+
+    const size_t num_buckets = 32768;
+    for (size_t num_points : {65536, 262144}) {
+        std::vector<uint32_t> indices(num_points);
+        std::vector<uint64_t> points(num_points * 8);
+        std::vector<uint64_t> buckets(num_buckets * 12);
+        for (size_t i = 0; i < num_points; i++) {
+            indices[i] = (uint32_t)(rng() % num_buckets);
+            memcpy(&points[i * 8], GX, 32);
+            memcpy(&points[i * 8 + 4], GY, 32);
+        }
+
+        char name[96];
+        snprintf(name, sizeof(name), "sparse_bucket_accumulate n=%zu", num_points);
+        run_bench(name, num_points, num_points * 8 * sizeof(uint64_t), [&]() {
+            sparse_bucket_accumulate(indices.data(), points.data(), buckets.data(),
+                                     num_points, num_buckets);
+        });
+    }
+}
+
+static void bench_cpu_msm(std::mt19937_64& rng) {
+    // BN254 generator (1, 2) in Montgomery form
+    static const uint64_t GX[4] = {
+        0xD35D438DC58F0D9DULL, 0x0A78EB28F5C70B3DULL,
+        0x666EA36F7879462CULL, 0x0E0A77C19A07DF2FULL
+    };
+    static const uint64_t GY[4] = {
+        0xA6BA871B8B1E1B3AULL, 0x14F1D651EB8E167BULL,
+        0xCCDD46DEF0F28C58ULL, 0x1C14EF83340FBE5EULL
+    };
+
+    for (size_t n : {4096, 32768}) {
+        std::vector<uint64_t> points(n * 8), scalars(n * 4);
+        for (size_t i = 0; i < n; i++) {
+            memcpy(&points[i * 8], GX, 32);
+            memcpy(&points[i * 8 + 4], GY, 32);
+            for (int j = 0; j < 4; j++) {
+                scalars[i * 4 + j] = rng();
+            }
+            scalars[i * 4 + 3] %= BENCH_MODULUS[3];
+        }
+        uint64_t result[12];
+
+        char name[96];
+        snprintf(name, sizeof(name), "msm_execute (cpu) n=%zu", n);
+        run_bench(name, n, n * (8 + 4) * sizeof(uint64_t), [&]() {
+            msm_execute(points.data(), scalars.data(), n, result);
+        });
+    }
+}
+
+static void bench_cpu_msm_g2(std::mt19937_64& rng) {
+    // BN254 G2 generator in Montgomery form (x.c0, x.c1, y.c0, y.c1)
+    static const uint64_t G2_GEN[16] = {
+        0x8E83B5D102BC2026ULL, 0xDCEB1935497B0172ULL,
+        0xFBB8264797811ADFULL, 0x19573841AF96503BULL,
+        0xAFB4737DA84C6140ULL, 0x6043DD5A5802D8C4ULL,
+        0x09E950FC52A02F86ULL, 0x14FEF0833AEA7B6BULL,
+        0x619DFA9D886BE9F6ULL, 0xFE7FD297F59E9B78ULL,
+        0xFF9E1A62231B7DFEULL, 0x28FD7EEBAE9E4206ULL,
+        0x64095B56C71856EEULL, 0xDC57F922327D3CBBULL,
+        0x55F935BE33351076ULL, 0x0DA4A0E693FD6482ULL
+    };
+
+    // G2 point sets run ~5% of the G1 sizes in proving workloads
+    for (size_t n : {1024, 4096}) {
+        std::vector<uint64_t> points(n * 16), scalars(n * 4);
+        for (size_t i = 0; i < n; i++) {
+            memcpy(&points[i * 16], G2_GEN, 128);
+            for (int j = 0; j < 4; j++) {
+                scalars[i * 4 + j] = rng();
+            }
+            scalars[i * 4 + 3] %= BENCH_MODULUS[3];
+        }
+        uint64_t result[24];
+
+        char name[96];
+        snprintf(name, sizeof(name), "msm_execute_g2 (cpu) n=%zu", n);
+        run_bench(name, n, n * (16 + 4) * sizeof(uint64_t), [&]() {
+            msm_execute_g2(points.data(), scalars.data(), n, result);
+        });
+    }
+}
+
+static void bench_fixed_base(std::mt19937_64& rng) {
+    // BN254 generator (1, 2) in Montgomery form
+    static const uint64_t GEN[8] = {
+        0xD35D438DC58F0D9DULL, 0x0A78EB28F5C70B3DULL,
+        0x666EA36F7879462CULL, 0x0E0A77C19A07DF2FULL,
+        0xA6BA871B8B1E1B3AULL, 0x14F1D651EB8E167BULL,
+        0xCCDD46DEF0F28C58ULL, 0x1C14EF83340FBE5EULL
+    };
+
+    FixedBaseTable* table = fixed_base_table_create(GEN, 8);
+    if (table == nullptr) {
+        return;
+    }
+
+    const size_t iters = 20000;
+    std::vector<uint64_t> scalars(iters * 4);
+    for (size_t i = 0; i < iters * 4; i++) {
+        scalars[i] = rng();
+    }
+    for (size_t i = 0; i < iters; i++) {
+        scalars[i * 4 + 3] %= BENCH_MODULUS[3];
+    }
+    uint64_t result[12];
+
+    run_bench("fixed_base_mul w=8", iters, iters * 4 * sizeof(uint64_t), [&]() {
+        for (size_t i = 0; i < iters; i++) {
+            fixed_base_mul(table, &scalars[i * 4], result);
+        }
+    });
+
+    fixed_base_table_destroy(table);
+}
+
+#ifdef __APPLE__
+
+static void bench_metal_msm(std::mt19937_64& rng) {
+    for (size_t n : {16384, 131072}) {
+        size_t points_size = n * 72; // AffinePoint stride
+        size_t scalars_size = n * 32;
+        GPUBuffer* points = metal_gpu_alloc_buffer(points_size, true);
+        GPUBuffer* scalars = metal_gpu_alloc_buffer(scalars_size, true);
+        GPUBuffer* result = metal_gpu_alloc_buffer(96, true);
+        if (!points || !scalars || !result) {
+            printf("metal msm n=%zu: buffer allocation failed\n", n);
+            return;
+        }
+
+        std::vector<uint64_t> scalar_data(n * 4);
+        for (size_t i = 0; i < scalar_data.size(); i++) {
+            scalar_data[i] = rng();
+        }
+        metal_gpu_copy_to_buffer(scalars, scalar_data.data(), scalars_size, 0);
+
+        char name[96];
+        snprintf(name, sizeof(name), "metal_gpu_msm n=%zu", n);
+        run_bench(name, n, points_size + scalars_size, [&]() {
+            metal_gpu_msm(scalars, points, result, n, 0);
+        });
+
+        metal_gpu_free_buffer(points);
+        metal_gpu_free_buffer(scalars);
+        metal_gpu_free_buffer(result);
+    }
+}
+
+static void bench_metal_ntt(std::mt19937_64& rng) {
+    for (size_t n : {4096, 65536, 1048576}) {
+        // Dispatch throughput only: twiddle contents do not affect timing
+        size_t data_size = n * 32;
+        GPUBuffer* data = metal_gpu_alloc_buffer(data_size, true);
+        GPUBuffer* twiddles = metal_gpu_alloc_buffer((n / 2) * 32, true);
+        if (!data || !twiddles) {
+            printf("metal ntt n=%zu: buffer allocation failed\n", n);
+            return;
+        }
+
+        std::vector<uint64_t> coeffs(n * 4);
+        for (size_t i = 0; i < coeffs.size(); i++) {
+            coeffs[i] = rng();
+        }
+        metal_gpu_copy_to_buffer(data, coeffs.data(), data_size, 0);
+
+        char name[96];
+        snprintf(name, sizeof(name), "metal_gpu_ntt_forward n=%zu", n);
+        run_bench(name, n, data_size, [&]() {
+            metal_gpu_ntt_forward(data, twiddles, n, BENCH_MODULUS);
+        });
+
+        snprintf(name, sizeof(name), "metal_gpu_ntt_batch n=%zu B=16", n);
+        GPUBuffer* batch_data = metal_gpu_alloc_buffer(data_size * 16, true);
+        if (batch_data != nullptr) {
+            run_bench(name, n * 16, data_size * 16, [&]() {
+                metal_gpu_ntt_batch(batch_data, twiddles, n, 16, true, BENCH_MODULUS);
+            });
+            metal_gpu_free_buffer(batch_data);
+        }
+
+        metal_gpu_free_buffer(data);
+        metal_gpu_free_buffer(twiddles);
+    }
+}
+
+#endif /* __APPLE__ */
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        g_filter = argv[1];
+    }
+
+    HardwareCapabilities caps = detect_hardware_capabilities();
+    printf("zk_bench: cores=%d neon=%d amx=%d sme=%d metal=%d unified=%d\n\n",
+           caps.cpu_cores, caps.has_neon, caps.has_amx, caps.has_sme,
+           caps.has_metal, caps.unified_memory);
+
+    std::mt19937_64 rng(0x5eed);
+
+    bench_montgomery_mul(rng);
+    bench_batch_montgomery_mul(rng);
+    bench_vdsp_butterfly(rng);
+    bench_blas_bucket_accumulate(rng);
+    bench_sparse_bucket_accumulate(rng);
+    bench_cpu_msm(rng);
+    bench_cpu_msm_g2(rng);
+    bench_fixed_base(rng);
+
+#ifdef __APPLE__
+    if (metal_gpu_init()) {
+        bench_metal_msm(rng);
+        bench_metal_ntt(rng);
+        metal_gpu_shutdown();
+    } else {
+        printf("Metal GPU unavailable; skipping GPU benchmarks\n");
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Arena allocator for per-proof native scratch memory
+ *
+ * Long-running provers churn the heap with per-kernel temporaries
+ * (indicator matrices, repacked point arrays, digit tables), which shows
+ * up as allocator lock contention and fragmentation after days of
+ * uptime. An arena bump-allocates from large pre-reserved slabs and
+ * resets in O(1) at proof end, so a proof session touches the system
+ * allocator only when a slab grows. Peak-usage stats let slabs be sized
+ * per circuit.
+ *
+ * Requirements: 5.1, 5.4
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Arena usage counters
+ *
+ * peak_bytes is the high-water mark of live bytes across resets: size
+ * the slab to it (one slab, no growth) for steady-state proving.
+ */
+typedef struct {
+    size_t reserved_bytes; // Total bytes held in slabs
+    size_t used_bytes;     // Live bytes since the last reset
+    size_t peak_bytes;     // High-water mark of used_bytes over the arena's life
+    uint32_t slab_count;   // Number of slabs (1 when sized right)
+    uint32_t resets;       // Times arena_reset has run
+} ArenaStats;
+
+/**
+ * Opaque arena handle (one per proof session)
+ */
+typedef struct ArenaAllocator ArenaAllocator;
+
+/**
+ * Create an arena
+ *
+ * @param slab_bytes Slab size; 0 uses ZK_ACCELERATE_ARENA_SLAB or the
+ *                   16 MiB default. Allocations larger than a slab get a
+ *                   dedicated slab of their own size.
+ * @return Arena handle, or NULL if the first slab cannot be reserved
+ */
+ArenaAllocator* arena_create(size_t slab_bytes);
+
+/**
+ * Bump-allocate from the arena (64-byte aligned, thread-safe)
+ *
+ * Blocks are not individually freed; they live until arena_reset or
+ * arena_destroy.
+ *
+ * @return Pointer into a slab, or NULL if a new slab cannot be reserved
+ */
+void* arena_alloc(ArenaAllocator* arena, size_t bytes);
+
+/**
+ * Release every allocation at once, keeping the slabs (O(1) in live
+ * blocks). Called at proof end; peak stats survive the reset.
+ */
+void arena_reset(ArenaAllocator* arena);
+
+/**
+ * Free the arena and all its slabs. Uninstalls it first if it is the
+ * installed session arena.
+ */
+void arena_destroy(ArenaAllocator* arena);
+
+/**
+ * Read the arena's usage counters
+ */
+ArenaStats arena_get_stats(const ArenaAllocator* arena);
+
+/**
+ * Install an arena as the process-wide proof session arena
+ *
+ * Kernels that allocate scratch through arena_scratch_alloc draw from
+ * the installed arena, including when they run on worker threads (async
+ * entry points execute on the libuv pool, so the install is global
+ * rather than thread-local). Pass NULL to uninstall. Installing or
+ * resetting while a kernel is mid-flight is a caller error.
+ */
+void arena_install(ArenaAllocator* arena);
+
+/**
+ * Get the installed session arena, or NULL when none is installed
+ */
+ArenaAllocator* arena_installed(void);
+
+/**
+ * Scratch allocation for native kernels
+ *
+ * Draws from the installed session arena when one exists, otherwise
+ * falls back to the heap so kernels work unchanged without a session.
+ * Pair every call with arena_scratch_free before the kernel returns.
+ */
+void* arena_scratch_alloc(size_t bytes);
+
+/**
+ * Release a scratch block: a no-op for arena-backed blocks (reclaimed by
+ * arena_reset), free() for the heap fallback
+ */
+void arena_scratch_free(void* ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARENA_H */
@@ -0,0 +1,94 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Runtime autotuning for backend and parameter selection
+ *
+ * Hard-coded backend thresholds are wrong on part of the fleet: the
+ * CPU/GPU crossover for MSM sits around 2^14 points on an M1 but near
+ * 2^12 on an M2 Ultra, and the best Pippenger window size moves with
+ * both n and hardware. autotune_warmup micro-benchmarks the NEON batch
+ * multiplier, the BLAS path and the Metal MSM dispatch at a few sizes,
+ * fits the crossover and per-size window choices, and persists the
+ * profile to a per-machine cache file. The native msm entry points
+ * consult the profile on every call; with no profile present they fall
+ * back to the static heuristics, so warmup is optional.
+ *
+ * Requirements: 2.6, 9.1
+ */
+
+#ifndef AUTOTUNE_H
+#define AUTOTUNE_H
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define AUTOTUNE_MAGIC "ZKACCTUN"
+#define AUTOTUNE_VERSION 1
+
+// Window sizes are tuned per log2(n) bracket; bracket k covers
+// n in [2^k, 2^(k+1))
+#define AUTOTUNE_MAX_BRACKETS 24
+
+/**
+ * A per-machine tuning profile (also the on-disk cache layout)
+ *
+ * The fingerprint ties a cached profile to the hardware that produced
+ * it; a mismatch (new machine, migrated home directory) invalidates the
+ * cache and the heuristics apply until the next warmup. Zero entries in
+ * msm_window_size mean "bracket not measured, use the heuristic".
+ */
+typedef struct {
+    char magic[8];              // "ZKACCTUN"
+    uint32_t version;           // AUTOTUNE_VERSION
+    uint32_t reserved;          // Zero
+    char fingerprint[64];       // Device name / core count
+    uint64_t msm_gpu_crossover; // Points above which the GPU MSM wins
+                                // (UINT64_MAX: GPU never measured faster)
+    uint32_t msm_window_size[AUTOTUNE_MAX_BRACKETS];
+    double neon_mul_ns_per_op;  // Measured 4-limb Montgomery mul cost
+    double blas_gflops;         // Measured dgemm throughput
+    double gpu_msm_base_ms;     // Measured small-n Metal MSM wall time
+} AutotuneProfile;
+
+/**
+ * Run the micro-benchmarks and persist the resulting profile
+ *
+ * Takes on the order of a second; callers should run it once at service
+ * startup (the addon exposes it as a promise). The cache file lives at
+ * $ZK_ACCELERATE_AUTOTUNE_CACHE, or ~/.cache/zk-accelerate/autotune.bin
+ * by default.
+ *
+ * @return true if the benchmarks ran and the profile is active
+ */
+bool autotune_warmup(void);
+
+/**
+ * Get the active profile, loading the cache file on first call
+ * @return Profile, or NULL if no valid profile exists for this machine
+ */
+const AutotuneProfile* autotune_get_profile(void);
+
+/**
+ * Tuned Pippenger window size for an MSM of n points
+ *
+ * Falls back to the static size heuristic when no profile exists or the
+ * bracket was not measured.
+ */
+int autotune_msm_window_size(size_t n);
+
+/**
+ * Whether the Metal MSM backend is expected to beat the CPU at n points
+ *
+ * False when no profile exists: routing only changes on machines that
+ * have been measured.
+ */
+bool autotune_msm_prefer_gpu(size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* AUTOTUNE_H */
@@ -144,8 +144,15 @@ void blas_matrix_vector_mul_f64(
 );
 
 /**
- * Bucket accumulation for MSM using BLAS
- * Accumulates points into buckets using matrix operations
+ * Bucket accumulation for MSM using BLAS (f64 experiment)
+ *
+ * Routes point coordinates into buckets through a dense indicator
+ * matrix and dgemv. The indicator is quadratic in memory, so the dense
+ * path is capped at toy sizes, and coordinate-wise double sums are not
+ * curve arithmetic; production bucket accumulation uses
+ * sparse_bucket_accumulate below. Kept for the AMX throughput
+ * benchmarks.
+ *
  * @param bucket_indices Array of bucket indices for each point
  * @param point_coords Point coordinates (x, y, z for Jacobian)
  * @param bucket_accum Accumulated bucket values (output)
@@ -162,6 +169,31 @@ void blas_bucket_accumulate(
     size_t coord_size
 );
 
+/**
+ * Sparse bucket accumulation over limb-form points
+ *
+ * Scatters affine points into Jacobian buckets with proper curve
+ * additions: each worker accumulates a chunk of points into a private
+ * bucket set, and the sets are combined by a parallel pairwise tree
+ * merge. Memory is linear in points + buckets, so it serves the sizes
+ * the dense BLAS formulation cannot. Points with an out-of-range bucket
+ * index are skipped (the caller encodes "no bucket" that way).
+ *
+ * @param bucket_indices num_points bucket indices
+ * @param points num_points affine points, 8 limbs each (x, y Montgomery)
+ * @param buckets Output, num_buckets Jacobian points (12 limbs each, overwritten)
+ * @param num_points Number of points
+ * @param num_buckets Number of buckets
+ * @return true on success
+ */
+bool sparse_bucket_accumulate(
+    const uint32_t* bucket_indices,
+    const uint64_t* points,
+    uint64_t* buckets,
+    size_t num_points,
+    size_t num_buckets
+);
+
 /**
  * NEON SIMD Operations
  * Requirements: 1.4, 4.6, 6.6
@@ -212,7 +244,7 @@ void neon_montgomery_mul_6limb(
  * @param mu Montgomery constant
  * @param results Output array
  * @param count Number of multiplications
- * @param limb_count Number of limbs per element (4 or 6)
+ * @param limb_count Number of limbs per element (1, 4, 6, or 8)
  */
 void neon_batch_montgomery_mul(
     const uint64_t* a,
@@ -224,6 +256,128 @@ void neon_batch_montgomery_mul(
     int limb_count
 );
 
+/**
+ * Batch Fp2 Montgomery multiplication (quadratic extension)
+ *
+ * Multiplies count elements of Fp2 = Fp[u]/(u^2 + 1) using Karatsuba
+ * over the extension: three base-field Montgomery multiplications per
+ * product instead of four. Elements are 2 * limb_count limbs, c0 then
+ * c1, both components in Montgomery form. Requires p = 3 mod 4 so that
+ * u^2 + 1 is irreducible (BN254 and BLS12-381 both qualify).
+ *
+ * @param a First operand array (count * 2 * limb_count limbs)
+ * @param b Second operand array
+ * @param modulus Base field modulus (limb_count limbs)
+ * @param mu Montgomery constant mu = -p^(-1) mod 2^64
+ * @param results Output array (count * 2 * limb_count limbs)
+ * @param count Number of multiplications
+ * @param limb_count Base field limbs per component (4 or 6)
+ */
+void neon_batch_fp2_montgomery_mul(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+);
+
+/**
+ * Batch Fp2 Montgomery squaring
+ *
+ * Same layout as neon_batch_fp2_montgomery_mul with a single operand
+ * array. Uses the complex method (two base-field multiplications per
+ * square).
+ *
+ * @param a Operand array (count * 2 * limb_count limbs)
+ * @param modulus Base field modulus (limb_count limbs)
+ * @param mu Montgomery constant mu = -p^(-1) mod 2^64
+ * @param results Output array (count * 2 * limb_count limbs)
+ * @param count Number of squarings
+ * @param limb_count Base field limbs per component (4 or 6)
+ */
+void neon_batch_fp2_montgomery_sqr(
+    const uint64_t* a,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+);
+
+/**
+ * Batch Montgomery multiplication over SoA limb planes
+ *
+ * Same contract as neon_batch_montgomery_mul with operands and results
+ * in structure-of-arrays layout: limb_count parallel planes of count
+ * limbs each, limb j of element i at index j * count + i. The planes
+ * make limb loads contiguous across the batch, and the kernel runs two
+ * elements per step with interleaved carry chains. Convert with
+ * neon_soa_from_elements / neon_soa_to_elements, or keep data in planes
+ * across a pipeline of batch calls to skip conversion entirely.
+ *
+ * @param a First operand planes (limb_count * count limbs)
+ * @param b Second operand planes
+ * @param modulus Field modulus (limb_count limbs, AoS)
+ * @param mu Montgomery constant
+ * @param results Output planes (limb_count * count limbs)
+ * @param count Number of multiplications
+ * @param limb_count Number of limbs per element (1, 4, 6, or 8)
+ */
+void neon_batch_montgomery_mul_soa(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+);
+
+/**
+ * Convert contiguous elements (AoS) into SoA limb planes
+ */
+void neon_soa_from_elements(
+    const uint64_t* elements,
+    uint64_t* soa,
+    size_t count,
+    int limb_count
+);
+
+/**
+ * Convert SoA limb planes back into contiguous elements (AoS)
+ */
+void neon_soa_to_elements(
+    const uint64_t* soa,
+    uint64_t* elements,
+    size_t count,
+    int limb_count
+);
+
+/**
+ * Batch modular inversion using Montgomery's simultaneous-inversion trick
+ *
+ * Inverts count field elements with one Fermat inversion plus roughly
+ * 3(n-1) Montgomery multiplications. Elements and results are in
+ * Montgomery form; zero elements are skipped and produce zero outputs.
+ *
+ * @param elements Array of elements to invert (count * limb_count limbs)
+ * @param modulus Field modulus (must be prime)
+ * @param mu Montgomery constant mu = -p^(-1) mod 2^64
+ * @param results Output array (count * limb_count limbs)
+ * @param count Number of elements
+ * @param limb_count Number of limbs per element (1, 4, 6, or 8)
+ */
+void neon_batch_inverse(
+    const uint64_t* elements,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+);
+
 /**
  * SME Matrix Operations (M4 Experimental)
  * Requirements: 6.5, 2.8, 9.1
@@ -273,6 +427,28 @@ bool sme_matrix_accumulate(
     int k
 );
 
+/**
+ * Batch Montgomery multiplication on the SME matrix engine
+ *
+ * Exact drop-in for neon_batch_montgomery_mul: 4-limb operands are
+ * decomposed into 16-bit digits and the digit-product matrix of each
+ * multiplication is computed with SME outer-product tiles (ZA
+ * accumulators); carry resolution and the Montgomery reduction stay on
+ * the NEON side. Falls back to the NEON kernel when SME is unavailable
+ * or the limb count is not 4.
+ *
+ * @returns true if the SME path executed, false if the NEON fallback ran
+ */
+bool sme_batch_montgomery_mul(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+);
+
 /**
  * CPU Accelerator Status
  */
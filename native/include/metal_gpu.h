@@ -21,11 +21,24 @@ extern "C" {
  */
 typedef struct {
     void* ptr;           // Native buffer pointer
-    size_t size;         // Buffer size in bytes
+    size_t size;         // Requested buffer size in bytes
+    size_t capacity;     // Underlying allocation size (size-class rounded)
     uint32_t id;         // Unique buffer ID
     bool is_shared;      // Whether buffer uses shared memory
 } GPUBuffer;
 
+/**
+ * Buffer pool statistics
+ */
+typedef struct {
+    uint64_t hits;           // Allocations served from the pool
+    uint64_t misses;         // Allocations requiring a fresh MTLBuffer
+    uint64_t releases;       // Buffers returned to the pool
+    uint64_t evictions;      // Buffers freed because the pool was full
+    uint64_t buffers_pooled; // Buffers currently idle in the pool
+    uint64_t bytes_pooled;   // Bytes currently idle in the pool
+} GPUPoolStats;
+
 /**
  * GPU compute pipeline handle
  */
@@ -52,7 +65,7 @@ typedef struct {
     bool device_available;
     bool unified_memory;
     int max_threads_per_group;
-    int max_buffer_length;
+    int64_t max_buffer_length;
     char device_name[256];
 } MetalGPUStatus;
 
@@ -98,8 +111,28 @@ GPUBuffer* metal_gpu_alloc_buffer(size_t size, bool shared);
  */
 void metal_gpu_free_buffer(GPUBuffer* buffer);
 
+/**
+ * Wrap caller-owned memory as a GPU buffer without copying
+ *
+ * On unified-memory machines the wrapped memory is visible to the GPU
+ * directly (newBufferWithBytesNoCopy), so kernels run in place on data
+ * such as a Node ArrayBuffer. The memory must be page-aligned, the size
+ * a multiple of the page size, and the caller must keep it alive for the
+ * lifetime of the buffer. Wrapped buffers are never pooled.
+ *
+ * @param data Page-aligned caller-owned memory
+ * @param size Size in bytes (multiple of page size)
+ * @return Buffer handle, or NULL if the memory cannot be wrapped
+ */
+GPUBuffer* metal_gpu_wrap_external(void* data, size_t size);
+
 /**
  * Copy data to GPU buffer
+ *
+ * If data already points at the buffer's own contents at the given
+ * offset (the caller produced it in place via
+ * metal_gpu_get_buffer_contents), the copy is elided.
+ *
  * @param buffer Target buffer
  * @param data Source data
  * @param size Size in bytes
@@ -110,6 +143,10 @@ bool metal_gpu_copy_to_buffer(GPUBuffer* buffer, const void* data, size_t size,
 
 /**
  * Copy data from GPU buffer
+ *
+ * Elided like metal_gpu_copy_to_buffer when the target aliases the
+ * buffer contents at the given offset.
+ *
  * @param buffer Source buffer
  * @param data Target data
  * @param size Size in bytes
@@ -120,11 +157,29 @@ bool metal_gpu_copy_from_buffer(GPUBuffer* buffer, void* data, size_t size, size
 
 /**
  * Get direct pointer to buffer contents (for unified memory)
+ *
+ * All buffers are allocated MTLStorageModeShared on Apple Silicon, so
+ * CPU kernels can produce data directly in the memory the GPU will
+ * read, skipping the staging copy entirely.
+ *
  * @param buffer Buffer handle
  * @return Pointer to buffer contents, or NULL if not available
  */
 void* metal_gpu_get_buffer_contents(GPUBuffer* buffer);
 
+/**
+ * Get buffer pool statistics
+ *
+ * Freed buffers are recycled through a size-class pool to avoid repeated
+ * MTLBuffer allocation for the recurring sizes in a proving workload.
+ */
+GPUPoolStats metal_gpu_pool_stats(void);
+
+/**
+ * Release all idle pooled buffers back to the system
+ */
+void metal_gpu_pool_trim(void);
+
 // ============================================================================
 // Shader Compilation and Caching
 // ============================================================================
@@ -137,6 +192,21 @@ void* metal_gpu_get_buffer_contents(GPUBuffer* buffer);
  */
 GPUPipeline* metal_gpu_compile_shader(const char* source, const char* function_name);
 
+/**
+ * Load precompiled kernels from a metallib into the pipeline cache
+ *
+ * Populates the cache consulted by metal_gpu_compile_shader and
+ * metal_gpu_get_cached_pipeline, so callers hit the precompiled
+ * pipelines instead of compiling MSL source at runtime. Called
+ * automatically during metal_gpu_init with the shipped library
+ * (override the search with ZK_ACCELERATE_METALLIB); kernels already
+ * cached are left untouched.
+ *
+ * @param path Filesystem path to a .metallib file
+ * @return Number of pipelines loaded, 0 on failure
+ */
+int metal_gpu_load_metallib(const char* path);
+
 /**
  * Get a cached pipeline by name
  * @param name Pipeline/function name
@@ -175,6 +245,91 @@ GPUResult metal_gpu_dispatch(
     size_t group_size
 );
 
+/**
+ * One compute pass in a multi-pass dispatch
+ *
+ * label names the pass in GPU stage profiles when several passes share
+ * one pipeline (e.g. NTT butterfly stages); NULL uses the pipeline name.
+ */
+typedef struct {
+    GPUPipeline* pipeline;
+    GPUBuffer** buffers;
+    size_t buffer_count;
+    size_t grid_size;
+    size_t group_size;
+    const char* label;
+} GPUPass;
+
+/**
+ * Dispatch a sequence of compute passes in a single command buffer
+ *
+ * Each pass gets its own encoder, so Metal's hazard tracking orders the
+ * passes correctly, but there is only one command buffer commit and one
+ * wait for the whole sequence. Multi-stage kernels (NTT butterfly
+ * stages, MSM phases) use this to avoid paying command buffer setup and
+ * full GPU synchronization per stage.
+ *
+ * @param passes Array of passes, executed in order
+ * @param pass_count Number of passes
+ * @return Execution result covering the whole sequence
+ */
+GPUResult metal_gpu_dispatch_passes(const GPUPass* passes, size_t pass_count);
+
+/**
+ * Handle for an in-flight asynchronous dispatch
+ */
+typedef struct {
+    void* command_buffer;    // Retained MTLCommandBuffer
+    double start_time;       // Submission timestamp
+    void* profile;           // In-flight GPU stage capture, or NULL
+} GPUDispatchHandle;
+
+/**
+ * Dispatch a compute kernel without waiting for completion
+ *
+ * Up to two command buffers (ZK_ACCELERATE_MAX_IN_FLIGHT overrides) are
+ * kept in flight, so upload and encoding of batch N+1 overlap compute of
+ * batch N. Blocks only when the in-flight limit is reached.
+ *
+ * @param pipeline Compute pipeline
+ * @param buffers Array of buffer handles
+ * @param buffer_count Number of buffers
+ * @param grid_size Total number of threads
+ * @param group_size Threads per threadgroup
+ * @return Dispatch handle to pass to metal_gpu_wait, or NULL on failure
+ */
+GPUDispatchHandle* metal_gpu_dispatch_async(
+    GPUPipeline* pipeline,
+    GPUBuffer** buffers,
+    size_t buffer_count,
+    size_t grid_size,
+    size_t group_size
+);
+
+/**
+ * Check whether an asynchronous dispatch has completed (non-blocking)
+ */
+bool metal_gpu_poll(GPUDispatchHandle* handle);
+
+/**
+ * Wait for an asynchronous dispatch and release its handle
+ * @return Execution result
+ */
+GPUResult metal_gpu_wait(GPUDispatchHandle* handle);
+
+/**
+ * Dispatch a sequence of compute passes without waiting for completion
+ *
+ * Combines metal_gpu_dispatch_passes (one command buffer, one encoder
+ * per pass) with the in-flight throttling of metal_gpu_dispatch_async,
+ * so the host can upload the next batch while the current sequence runs.
+ *
+ * @param passes Array of passes, executed in order
+ * @param pass_count Number of passes
+ * @return Dispatch handle to pass to metal_gpu_wait, or NULL on failure
+ */
+GPUDispatchHandle* metal_gpu_dispatch_passes_async(const GPUPass* passes, size_t pass_count);
+
 /**
  * Dispatch a compute kernel with 2D grid
  */
@@ -193,15 +348,77 @@ GPUResult metal_gpu_dispatch_2d(
  */
 void metal_gpu_synchronize(void);
 
+// ============================================================================
+// GPU Stage Profiling
+// ============================================================================
+
+/**
+ * Aggregated GPU-side statistics for one compute stage
+ *
+ * gpu_ms is measured with Metal timestamp sample buffers at encoder
+ * boundaries, so it covers kernel execution only — no queueing, commit,
+ * or host wait time. occupancy is the dispatched threadgroup size over
+ * the pipeline's maxTotalThreadsPerThreadgroup (which is at most
+ * MetalGPUStatus.max_threads_per_group), averaged across invocations.
+ */
+typedef struct {
+    char stage[64];
+    uint64_t count;
+    double gpu_ms;
+    double occupancy;
+    uint32_t threads_per_group;
+    uint32_t max_threads_per_group;
+} GPUStageStats;
+
+/**
+ * Enable or disable GPU stage profiling
+ *
+ * Off by default; ZK_ACCELERATE_GPU_PROFILE=1 enables it at startup.
+ * When enabled, every dispatch samples GPU timestamps around each
+ * encoder, attributing time to individual stages (MSM bucket phases,
+ * NTT butterfly stages) instead of the single wall-clock
+ * execution_time_ms. Requires a device that supports counter sampling
+ * at stage boundaries; on devices that do not, dispatches run
+ * unprofiled.
+ */
+void metal_gpu_profiling_set_enabled(bool enabled);
+
+/**
+ * Whether GPU stage profiling is currently enabled
+ */
+bool metal_gpu_profiling_is_enabled(void);
+
+/**
+ * Snapshot per-stage GPU statistics
+ *
+ * Stage times are also recorded into the perf counters under
+ * "gpu:<stage>", so percentiles are available through getPerfCounters.
+ *
+ * @param out Output array
+ * @param max Capacity of out
+ * @return Number of stages written
+ */
+size_t metal_gpu_profiling_snapshot(GPUStageStats* out, size_t max);
+
+/**
+ * Reset the GPU stage statistics
+ */
+void metal_gpu_profiling_reset(void);
+
 // ============================================================================
 // MSM-specific operations
 // ============================================================================
 
 /**
  * Execute MSM on GPU
+ *
+ * The full Pippenger pipeline (bucket accumulation, chunked bucket
+ * reduction, window combination) runs on-device; only the final point
+ * is written to result_buffer.
+ *
  * @param scalars_buffer Buffer containing scalars
- * @param points_buffer Buffer containing points
- * @param result_buffer Buffer for result
+ * @param points_buffer Buffer containing points (Montgomery-form affine)
+ * @param result_buffer Buffer receiving the final Jacobian point (12 limbs)
  * @param num_points Number of scalar-point pairs
  * @param window_size Pippenger window size
  * @return Execution result
@@ -214,45 +431,82 @@ GPUResult metal_gpu_msm(
     int window_size
 );
 
+/**
+ * Execute MSM on GPU in buffer-sized tiles streamed from host memory
+ *
+ * For inputs whose point array exceeds the device buffer limit, the
+ * input is split into tiles that fit. Tiles stream through two buffer
+ * slots (upload of tile N+1 overlaps compute of tile N) and every tile
+ * folds into the same GPU-resident bucket state, so bucket reduction
+ * and window combination still run exactly once at the end. The tile
+ * size derives from MetalGPUStatus.max_buffer_length
+ * (ZK_ACCELERATE_MSM_TILE_POINTS overrides).
+ *
+ * @param scalars num_points scalars, 4 limbs each (plain form)
+ * @param points num_points affine points (72-byte records, Montgomery form)
+ * @param result Receives the final Jacobian point (12 limbs)
+ * @param num_points Number of scalar-point pairs
+ * @param window_size Pippenger window size (0 = automatic)
+ * @return Execution result
+ */
+GPUResult metal_gpu_msm_chunked(
+    const void* scalars,
+    const void* points,
+    void* result,
+    size_t num_points,
+    int window_size
+);
+
 // ============================================================================
 // NTT-specific operations
 // ============================================================================
 
 /**
  * Execute forward NTT on GPU
- * @param data_buffer Buffer containing coefficients (in-place)
- * @param twiddles_buffer Buffer containing twiddle factors
+ *
+ * Data limbs are canonical; the twiddle buffer must hold the factors in
+ * Montgomery form (w^i * R mod modulus), which the butterfly's Montgomery
+ * multiply consumes without converting the data. ntt_plan_create builds
+ * tables in this form.
+ *
+ * @param data_buffer Buffer containing coefficients (in-place, canonical)
+ * @param twiddles_buffer Buffer containing twiddle factors (Montgomery form)
  * @param n NTT size
+ * @param modulus Field modulus (4 limbs, little-endian)
  * @return Execution result
  */
 GPUResult metal_gpu_ntt_forward(
     GPUBuffer* data_buffer,
     GPUBuffer* twiddles_buffer,
-    size_t n
+    size_t n,
+    const uint64_t* modulus
 );
 
 /**
  * Execute inverse NTT on GPU
- * @param data_buffer Buffer containing values (in-place)
- * @param twiddles_inv_buffer Buffer containing inverse twiddle factors
- * @param n_inv_buffer Buffer containing n^-1
+ * @param data_buffer Buffer containing values (in-place, canonical)
+ * @param twiddles_inv_buffer Buffer containing inverse twiddle factors (Montgomery form)
+ * @param n_inv_buffer Buffer containing n^-1 (Montgomery form)
  * @param n NTT size
+ * @param modulus Field modulus (4 limbs, little-endian)
  * @return Execution result
  */
 GPUResult metal_gpu_ntt_inverse(
     GPUBuffer* data_buffer,
     GPUBuffer* twiddles_inv_buffer,
     GPUBuffer* n_inv_buffer,
-    size_t n
+    size_t n,
+    const uint64_t* modulus
 );
 
 /**
  * Execute batch NTT on GPU
- * @param data_buffer Buffer containing multiple polynomials
- * @param twiddles_buffer Buffer containing twiddle factors
+ * @param data_buffer Buffer containing multiple polynomials (canonical)
+ * @param twiddles_buffer Buffer containing twiddle factors (Montgomery form)
  * @param n NTT size per polynomial
  * @param batch_size Number of polynomials
  * @param forward true for forward NTT, false for inverse
+ * @param modulus Field modulus (4 limbs, little-endian)
  * @return Execution result
  */
 GPUResult metal_gpu_ntt_batch(
@@ -260,9 +514,70 @@ GPUResult metal_gpu_ntt_batch(
     GPUBuffer* twiddles_buffer,
     size_t n,
     size_t batch_size,
-    bool forward
+    bool forward,
+    const uint64_t* modulus
 );
 
+/**
+ * NTT execution plan
+ *
+ * Holds the precomputed forward and inverse twiddle tables plus n^-1 for
+ * one (modulus, root, n) triple, resident in GPU buffers so repeated transforms
+ * at the same size pay no per-call twiddle generation or upload cost.
+ */
+typedef struct {
+    uint32_t n;               // Transform size
+    uint64_t modulus[4];      // Field modulus (little-endian limbs)
+    uint64_t mu;              // -modulus^-1 mod 2^64 (Montgomery constant)
+    GPUBuffer* twiddles;      // Forward twiddle table (n/2 elements, Montgomery form)
+    GPUBuffer* twiddles_inv;  // Inverse twiddle table (n/2 elements, Montgomery form)
+    GPUBuffer* n_inv;         // n^-1 mod modulus (1 element, Montgomery form)
+} NTTPlan;
+
+/**
+ * Create (or fetch from cache) an NTT plan for a (modulus, root, n) triple
+ *
+ * Plans are cached by (modulus, root, n): the first call computes the twiddle
+ * tables on the CPU and uploads them, subsequent calls with the same key
+ * return the resident plan. Cached plans are owned by the cache and stay
+ * valid until ntt_plan_cache_clear or metal_gpu_shutdown.
+ *
+ * @param modulus Field modulus (4 limbs, little-endian)
+ * @param root_of_unity Primitive n-th root of unity mod modulus (4 limbs)
+ * @param n Transform size (power of 2)
+ * @return Plan handle, or NULL on failure
+ */
+NTTPlan* ntt_plan_create(const uint64_t* modulus, const uint64_t* root_of_unity, size_t n);
+
+/**
+ * Execute an NTT using a plan's resident twiddle tables
+ * @param plan Plan from ntt_plan_create
+ * @param data_buffer Buffer containing coefficients (in-place)
+ * @param forward true for forward NTT, false for inverse
+ * @return Execution result
+ */
+GPUResult ntt_plan_execute(NTTPlan* plan, GPUBuffer* data_buffer, bool forward);
+
+/**
+ * Execute NTTs over a batch of contiguous same-size polynomials
+ *
+ * Runs all batch_size transforms in one command buffer, with the grid
+ * sized at batch_size * (n/2) butterflies per stage. Inverse transforms
+ * include the n^-1 scaling pass using the plan's resident constant.
+ *
+ * @param plan Plan from ntt_plan_create
+ * @param data_buffer Buffer holding batch_size polynomials of n elements
+ * @param batch_size Number of polynomials
+ * @param forward true for forward NTT, false for inverse
+ * @return Execution result
+ */
+GPUResult ntt_plan_execute_batch(NTTPlan* plan, GPUBuffer* data_buffer, size_t batch_size, bool forward);
+
+/**
+ * Free all cached NTT plans and their GPU buffers
+ */
+void ntt_plan_cache_clear(void);
+
 #ifdef __cplusplus
 }
 #endif
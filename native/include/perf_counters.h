@@ -0,0 +1,83 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Native performance counters
+ *
+ * Aggregates per-kernel invocation counts and timing histograms across
+ * the CPU and GPU hot paths, plus GPU transfer byte counts. Designed to
+ * be scraped periodically (getPerfCounters in the addon) and reset at
+ * runtime; recording is mutex-protected and cheap relative to the
+ * kernels it wraps.
+ *
+ * Requirements: 7.5, 9.1
+ */
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <cstdint>
+#include <cstddef>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Aggregated statistics for one kernel
+ *
+ * Percentiles are estimated from a fixed geometric histogram (factor-2
+ * buckets from 1 microsecond), so they are accurate to within a bucket.
+ */
+typedef struct {
+    char name[64];
+    uint64_t count;
+    double total_ms;
+    double min_ms;
+    double max_ms;
+    double p50_ms;
+    double p95_ms;
+    double p99_ms;
+} PerfKernelStats;
+
+/**
+ * GPU transfer byte counts
+ */
+typedef struct {
+    uint64_t bytes_to_gpu;
+    uint64_t bytes_from_gpu;
+} PerfTransferStats;
+
+/**
+ * Record one timed invocation of a kernel
+ * @param kernel Stable kernel name (not copied beyond 63 chars)
+ * @param ms Elapsed wall time in milliseconds
+ */
+void perf_counters_record(const char* kernel, double ms);
+
+/**
+ * Add to the GPU transfer byte counts
+ */
+void perf_counters_add_transfer(uint64_t bytes_to_gpu, uint64_t bytes_from_gpu);
+
+/**
+ * Snapshot per-kernel statistics
+ * @param out Output array
+ * @param max Capacity of out
+ * @return Number of kernels written
+ */
+size_t perf_counters_snapshot(PerfKernelStats* out, size_t max);
+
+/**
+ * Get GPU transfer byte counts
+ */
+PerfTransferStats perf_counters_transfers(void);
+
+/**
+ * Reset all counters, histograms, and transfer totals
+ */
+void perf_counters_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PERF_COUNTERS_H */
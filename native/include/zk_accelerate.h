@@ -58,6 +58,511 @@ bool has_sme_support(void);
  */
 bool has_metal_support(void);
 
+/**
+ * Execute a complete Pippenger MSM in native code
+ *
+ * Performs scalar windowing, bucket accumulation, bucket reduction and
+ * final window combination without returning to JavaScript, choosing the
+ * NEON or Metal backend internally.
+ *
+ * @param points Affine points, 8 limbs each (x, y in Montgomery form)
+ * @param scalars Scalars, 4 limbs each (plain form)
+ * @param n Number of scalar-point pairs
+ * @param result Output Jacobian point, 12 limbs (x, y, z in Montgomery form)
+ * @return true on success
+ */
+bool msm_execute(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result
+);
+
+/**
+ * msm_execute with an explicit Pippenger window size
+ *
+ * window_size <= 0 selects the size automatically (autotuned profile
+ * when present, static heuristic otherwise). Used by the autotuner to
+ * measure candidate window sizes; always runs on the CPU engine.
+ */
+bool msm_execute_with_window(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result,
+    int window_size
+);
+
+/**
+ * Execute a complete Pippenger MSM over BLS12-381 G1
+ *
+ * Instantiation of the curve-generic CPU engine (curve_ops.h) for the
+ * 6-limb BLS12-381 base field: same windowing, bucket accumulation and
+ * combination pipeline as msm_execute, multi-threaded on NEON. The
+ * scalar field is 255 bits, so scalars stay 4 limbs.
+ *
+ * @param points Affine points, 12 limbs each (x, y in Montgomery form)
+ * @param scalars Scalars, 4 limbs each (plain form)
+ * @param n Number of scalar-point pairs
+ * @param result Output Jacobian point, 18 limbs (x, y, z in Montgomery form)
+ * @return true on success
+ */
+bool msm_execute_bls12381(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result
+);
+
+/**
+ * msm_execute_bls12381 with an explicit Pippenger window size
+ *
+ * window_size <= 0 selects the size automatically, as in
+ * msm_execute_with_window.
+ */
+bool msm_execute_bls12381_with_window(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result,
+    int window_size
+);
+
+/**
+ * End-to-end Pippenger MSM over BN254 G2
+ *
+ * Same windowing, bucket accumulation and combination pipeline as
+ * msm_execute over G2 points whose coordinates live in Fp2, using the
+ * Karatsuba extension-field kernels; multi-threaded on NEON. Replaces
+ * the JavaScript G2 fallback for pairing-based commitments.
+ *
+ * @param points Affine G2 points, 16 limbs each (x.c0, x.c1, y.c0,
+ *               y.c1 in Montgomery form)
+ * @param scalars Scalars, 4 limbs each (plain form)
+ * @param n Number of scalar-point pairs
+ * @param result Output Jacobian G2 point, 24 limbs (x, y, z with c0,
+ *               c1 each, Montgomery form)
+ * @return true on success
+ */
+bool msm_execute_g2(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result
+);
+
+/**
+ * msm_execute_g2 with an explicit Pippenger window size
+ *
+ * window_size <= 0 selects the size automatically, as in
+ * msm_execute_with_window.
+ */
+bool msm_execute_g2_with_window(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result,
+    int window_size
+);
+
+// ============================================================================
+// Scalar preprocessing (signed-digit recoding)
+// ============================================================================
+
+/**
+ * One point routed to one Pippenger bucket
+ *
+ * Layout matches the Metal BucketEntry struct (16 bytes), so arrays of
+ * these can be written straight into a GPU-shared buffer. The sign lane
+ * occupies what the unsigned pipeline leaves as padding: 1 means the
+ * point is subtracted from the bucket instead of added.
+ */
+typedef struct {
+    uint32_t point_index;
+    uint32_t bucket_index;
+    uint32_t window_index;
+    uint32_t sign;
+} MsmBucketEntry;
+
+/**
+ * Number of windows produced by signed recoding for a window size
+ *
+ * One more than the unsigned count: the carry out of the top window can
+ * spill a single digit into an extra window.
+ */
+int msm_signed_num_windows(int window_size);
+
+/**
+ * Recode scalars into signed window digits and per-window bucket entries
+ *
+ * Converts each 256-bit scalar into signed digits in
+ * [-2^(w-1), 2^(w-1)], halving the bucket count per window to 2^(w-1)
+ * compared to the unsigned decomposition. Entries for window w are
+ * packed at entries + w * n (the layout the Metal accumulate kernels
+ * read), sorted by bucket index, with only nonzero digits emitted;
+ * entry_counts[w] receives the number of entries in window w. The work
+ * is split across cores (ZK_ACCELERATE_CPU_THREADS overrides the
+ * count).
+ *
+ * @param scalars n scalars, 4 limbs each (plain form)
+ * @param n Number of scalars
+ * @param window_size Window size in bits (2..16)
+ * @param entries Output array, capacity n * msm_signed_num_windows(window_size)
+ * @param entry_counts Output array, msm_signed_num_windows(window_size) entries
+ * @return true on success
+ */
+bool msm_recode_scalars(
+    const uint64_t* scalars,
+    size_t n,
+    int window_size,
+    MsmBucketEntry* entries,
+    uint32_t* entry_counts
+);
+
+// ============================================================================
+// Incremental MSM (persistent bucket state)
+// ============================================================================
+
+/**
+ * Opaque incremental MSM state over a fixed point set
+ *
+ * Holds the per-window Pippenger buckets (the metal_msm.mm bucket
+ * layout) persistently, so a commitment whose scalar vector changes in
+ * few positions per block costs O(changes) bucket updates plus a
+ * commit that re-reduces only the touched bucket chunks, instead of a
+ * full O(n) MSM. Objects are not thread-safe; callers serialize access.
+ */
+typedef struct MsmIncremental MsmIncremental;
+
+/**
+ * Create incremental MSM state for n points
+ *
+ * The points buffer is borrowed and must stay valid for the lifetime of
+ * the object (the memory-mapped SRS region is the intended source).
+ * When scalars is non-NULL the buckets are bulk-loaded from it with the
+ * work split across cores; NULL starts from the all-zero vector.
+ *
+ * @param points Affine points, 8 limbs each (x, y in Montgomery form)
+ * @param scalars Initial scalars, 4 limbs each (plain form), or NULL
+ * @param n Number of points
+ * @param window_size Window size in bits (2..16), <= 0 selects automatically
+ * @return New state, or NULL on invalid parameters
+ */
+MsmIncremental* msm_incremental_create(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    int window_size
+);
+
+/**
+ * Apply one scalar change: scalar[index] goes from old_scalar to new_scalar
+ *
+ * Subtracts the point's old window digits from their buckets and adds
+ * the new ones, marking the touched bucket chunks dirty. old_scalar
+ * must match what the state was built or last updated with at this
+ * index; the object does not store the scalar vector.
+ *
+ * @param inc State from msm_incremental_create
+ * @param index Point index, < n
+ * @param old_scalar Previous scalar, 4 limbs (plain form)
+ * @param new_scalar New scalar, 4 limbs (plain form)
+ * @return true on success
+ */
+bool msm_incremental_update(
+    MsmIncremental* inc,
+    size_t index,
+    const uint64_t* old_scalar,
+    const uint64_t* new_scalar
+);
+
+/**
+ * Produce the current commitment
+ *
+ * Re-reduces only the bucket chunks dirtied since the last commit, then
+ * combines the cached chunk partials into the final sum. Cost scales
+ * with the number of dirty chunks, not with n.
+ *
+ * @param inc State from msm_incremental_create
+ * @param result Output Jacobian point, 12 limbs (x, y, z in Montgomery form)
+ * @return true on success
+ */
+bool msm_incremental_commit(MsmIncremental* inc, uint64_t* result);
+
+/**
+ * Size in bytes of the serialized state
+ */
+size_t msm_incremental_serialize_size(const MsmIncremental* inc);
+
+/**
+ * Serialize the bucket state for restart
+ *
+ * Writes a little-endian header plus the raw bucket limbs. The point
+ * set itself is not serialized; deserialization takes the same points.
+ *
+ * @param inc State to serialize
+ * @param out Output buffer, at least msm_incremental_serialize_size bytes
+ * @param size Capacity of out
+ * @return true on success
+ */
+bool msm_incremental_serialize(const MsmIncremental* inc, uint8_t* out, size_t size);
+
+/**
+ * Restore incremental MSM state from a serialized blob
+ *
+ * points and n must match the state the blob was serialized from. All
+ * chunk caches are rebuilt on the first commit after restore.
+ *
+ * @param points Affine points, 8 limbs each (the original point set)
+ * @param n Number of points
+ * @param data Serialized state from msm_incremental_serialize
+ * @param size Size of data in bytes
+ * @return New state, or NULL if the blob is invalid or mismatched
+ */
+MsmIncremental* msm_incremental_deserialize(
+    const uint64_t* points,
+    size_t n,
+    const uint8_t* data,
+    size_t size
+);
+
+/**
+ * Free incremental MSM state
+ */
+void msm_incremental_destroy(MsmIncremental* inc);
+
+// ============================================================================
+// Fixed-base scalar multiplication
+// ============================================================================
+
+/**
+ * Opaque precomputed table for fixed-base scalar multiplication
+ *
+ * Stores d * 2^(w * window_size) * P for every window w and digit d as
+ * affine points in one contiguous block, so multiplying the fixed base
+ * by a fresh scalar is one table lookup plus one mixed addition per
+ * window with no doublings. Tables are immutable after construction
+ * and safe to share across threads.
+ */
+typedef struct FixedBaseTable FixedBaseTable;
+
+/**
+ * Build a fixed-base table for one point
+ *
+ * Computes the per-window multiples with the native point arithmetic
+ * and normalizes them to affine with one Montgomery-trick batch
+ * inversion. A window size of 8 gives ~32 windows of 255 entries
+ * (~520 KB per table) and suits the verifier workload; larger windows
+ * trade table memory for fewer additions per multiplication.
+ *
+ * @param point Affine base point, 8 limbs (x, y in Montgomery form)
+ * @param window_size Window size in bits (2..16)
+ * @return New table, or NULL on invalid parameters
+ */
+FixedBaseTable* fixed_base_table_create(const uint64_t* point, int window_size);
+
+/**
+ * Multiply the table's base point by a scalar
+ *
+ * Performs table lookups plus at most one mixed addition per window;
+ * zero digits are skipped.
+ *
+ * @param table Table from fixed_base_table_create
+ * @param scalar Scalar, 4 limbs (plain form)
+ * @param result Output Jacobian point, 12 limbs (x, y, z in Montgomery form)
+ * @return true on success
+ */
+bool fixed_base_mul(const FixedBaseTable* table, const uint64_t* scalar, uint64_t* result);
+
+/**
+ * Size in bytes of the serialized table
+ */
+size_t fixed_base_table_serialize_size(const FixedBaseTable* table);
+
+/**
+ * Serialize the table for reuse across processes
+ *
+ * Writes a little-endian header plus the raw affine limbs; the blob is
+ * position-independent and can live in a shared or memory-mapped file.
+ *
+ * @param table Table to serialize
+ * @param out Output buffer, at least fixed_base_table_serialize_size bytes
+ * @param size Capacity of out
+ * @return true on success
+ */
+bool fixed_base_table_serialize(const FixedBaseTable* table, uint8_t* out, size_t size);
+
+/**
+ * Restore a fixed-base table from a serialized blob
+ *
+ * @param data Serialized table from fixed_base_table_serialize
+ * @param size Size of data in bytes
+ * @return New table, or NULL if the blob is invalid
+ */
+FixedBaseTable* fixed_base_table_deserialize(const uint8_t* data, size_t size);
+
+/**
+ * Free a fixed-base table
+ */
+void fixed_base_table_destroy(FixedBaseTable* table);
+
+// ============================================================================
+// CPU NTT engine
+// ============================================================================
+
+/**
+ * Opaque prepared transform for the CPU NTT engine
+ *
+ * Counterpart of the Metal NTTPlan: holds the field context and resident
+ * twiddle tables for one (modulus, root, n) triple. Plans are cached per triple
+ * and shared, so they must not be freed by callers; use
+ * ntt_cpu_plan_cache_clear to release them all.
+ */
+typedef struct NttCpuPlan NttCpuPlan;
+
+/**
+ * Create (or fetch from cache) a CPU NTT plan
+ *
+ * Validates that root_of_unity has multiplicative order exactly n and
+ * precomputes the forward and inverse twiddle tables. Unlike the GPU
+ * plan this needs no Metal device, so it also serves as the fallback
+ * path when the GPU engine is unavailable.
+ *
+ * @param modulus Field modulus, 4 limbs (odd prime)
+ * @param root_of_unity Primitive n-th root of unity, 4 limbs, canonical form
+ * @param n Transform size (power of 2, >= 2)
+ * @return Cached plan, or NULL on invalid parameters
+ */
+NttCpuPlan* ntt_cpu_plan_create(
+    const uint64_t* modulus,
+    const uint64_t* root_of_unity,
+    size_t n
+);
+
+/**
+ * Execute an in-place NTT over n 4-limb elements
+ *
+ * Data is in canonical form on entry and exit, matching the GPU buffer
+ * convention. Small transforms run as one iterative radix-2 pass; large
+ * ones use a cache-blocked six-step decomposition with the row
+ * transforms split across cores (ZK_ACCELERATE_CPU_THREADS overrides
+ * the worker count, ZK_ACCELERATE_NTT_BLOCK the blocking threshold).
+ * Inverse transforms include the 1/n scaling.
+ *
+ * @param plan Plan from ntt_cpu_plan_create
+ * @param data n * 4 limbs, transformed in place
+ * @param forward true for the forward transform, false for the inverse
+ * @return true on success
+ */
+bool ntt_cpu_execute(NttCpuPlan* plan, uint64_t* data, bool forward);
+
+/**
+ * Free all cached CPU NTT plans
+ */
+void ntt_cpu_plan_cache_clear(void);
+
+// ============================================================================
+// Memory-mapped SRS (structured reference string) format
+// ============================================================================
+
+/**
+ * On-disk SRS file layout (all integers little-endian):
+ *
+ *   [0, sizeof(SrsFileHeader))   header
+ *   [points_offset, ...)         num_points * point_limbs uint64 limbs
+ *   [scalars_offset, ...)        num_scalars * scalar_limbs uint64 limbs
+ *
+ * Section offsets are page-aligned (4096 by convention), so a mapped
+ * section can be handed to metal_gpu_wrap_external without a copy.
+ * Points are affine, x then y limbs, coordinates in Montgomery form
+ * when SRS_FLAG_MONTGOMERY is set. Files are produced once offline with
+ * srs_write and consumed via srs_open, whose limb pointers feed
+ * msm_execute and the batch kernels directly from the mapping.
+ */
+#define SRS_MAGIC "ZKACCSRS"
+#define SRS_VERSION 1
+#define SRS_FLAG_MONTGOMERY 0x1
+
+typedef struct {
+    char magic[8];           // "ZKACCSRS"
+    uint32_t version;        // SRS_VERSION
+    uint32_t flags;          // SRS_FLAG_* bits
+    uint64_t num_points;     // Number of affine points
+    uint64_t num_scalars;    // Number of scalars (0 if the file has none)
+    uint32_t point_limbs;    // Limbs per point (8: x then y, 4 limbs each)
+    uint32_t scalar_limbs;   // Limbs per scalar (4)
+    uint64_t points_offset;  // Byte offset of the point section (page-aligned)
+    uint64_t scalars_offset; // Byte offset of the scalar section (page-aligned)
+    uint64_t reserved[2];    // Zero
+} SrsFileHeader;
+
+/**
+ * An open, memory-mapped SRS
+ *
+ * The limb pointers alias the mapping: no copy is made, and they stay
+ * valid until srs_close. The point section is advised MADV_SEQUENTIAL
+ * at open, matching the access pattern of Pippenger window passes.
+ */
+typedef struct {
+    void* mapping;           // mmap base address
+    size_t mapping_size;     // Total mapped bytes
+    const uint64_t* points;  // num_points * point_limbs limbs
+    const uint64_t* scalars; // NULL when the file has no scalar section
+    uint64_t num_points;
+    uint64_t num_scalars;
+    uint32_t point_limbs;
+    uint32_t scalar_limbs;
+    uint32_t flags;
+} SrsMapping;
+
+/**
+ * Map an SRS file into memory
+ * @param path Path to a file produced by srs_write
+ * @return Mapping handle, or NULL on open/validation failure
+ */
+SrsMapping* srs_open(const char* path);
+
+/**
+ * Unmap an SRS and release its handle (limb pointers become invalid)
+ */
+void srs_close(SrsMapping* srs);
+
+/**
+ * Ask the kernel to prefetch a point range (madvise MADV_WILLNEED)
+ *
+ * Called ahead of a sequential window pass so page faults overlap
+ * compute instead of stalling it.
+ *
+ * @param srs Open mapping
+ * @param start_point First point index
+ * @param count Number of points
+ * @return true if the advice was applied
+ */
+bool srs_prefetch(const SrsMapping* srs, uint64_t start_point, uint64_t count);
+
+/**
+ * Write an SRS file (offline pre-conversion)
+ * @param path Output path (overwritten)
+ * @param points num_points * point_limbs limbs, little-endian
+ * @param num_points Number of affine points
+ * @param point_limbs Limbs per point
+ * @param scalars num_scalars * scalar_limbs limbs, or NULL
+ * @param num_scalars Number of scalars (0 for none)
+ * @param scalar_limbs Limbs per scalar
+ * @param flags SRS_FLAG_* bits
+ * @return true on success
+ */
+bool srs_write(
+    const char* path,
+    const uint64_t* points,
+    uint64_t num_points,
+    uint32_t point_limbs,
+    const uint64_t* scalars,
+    uint64_t num_scalars,
+    uint32_t scalar_limbs,
+    uint32_t flags
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,27 +4,43 @@
  *
  * Requirements: 2.6, 7.3
  *
- * This file contains Metal compute shaders for GPU-accelerated MSM
- * using Pippenger's bucket method with sparse matrix transposition.
+ * Standalone copy of the assembled BN254 shader (MSM_SHADER_PRELUDE_BN254
+ * + MSM_SHADER_BODY + MSM_SHADER_G2_EXT in native/src/metal_msm.mm) for
+ * offline compilation into zk_accelerate.metallib. Keep the two in sync:
+ * the runtime falls back to compiling the embedded strings only when the
+ * precompiled library is missing a kernel.
  */
 
 #include <metal_stdlib>
 using namespace metal;
 
-// ============================================================================
-// Constants and Types
-// ============================================================================
+// BN254: 4-limb base field, kernel names unsuffixed so the precompiled
+// metallib and existing cache entries keep working
+#define CURVE_LIMBS 4
+#define MSM_KERNEL(name) name
 
-// Field element limb count (4 for BN254, 6 for BLS12-381)
-constant uint LIMBS_BN254 = 4;
-constant uint LIMBS_BLS12_381 = 6;
+// BN254 field modulus
+constant uint64_t CURVE_MODULUS[CURVE_LIMBS] = {
+    0x3C208C16D87CFD47ULL,
+    0x97816A916871CA8DULL,
+    0xB85045B68181585DULL,
+    0x30644E72E131A029ULL
+};
 
-// Maximum window size for Pippenger
-constant uint MAX_WINDOW_SIZE = 20;
+// Montgomery constant mu = -p^(-1) mod 2^64
+constant uint64_t CURVE_MU = 0x87D20782E4866389ULL;
+
+// R mod p (Montgomery representation of 1)
+constant uint64_t CURVE_MONT_ONE[CURVE_LIMBS] = {
+    0xD35D438DC58F0D9DULL,
+    0x0A78EB28F5C70B3DULL,
+    0x666EA36F7879462CULL,
+    0x0E0A77C19A07DF2FULL
+};
 
-// Field element (256-bit for BN254)
+// Field element over the descriptor's base field
 struct FieldElement {
-    uint64_t limbs[4];
+    uint64_t limbs[CURVE_LIMBS];
 };
 
 // Jacobian point representation
@@ -54,10 +70,12 @@ struct MSMConfig {
     uint32_t num_windows;
     uint32_t buckets_per_window;
     uint32_t scalar_bits;
-    uint32_t padding[3];
+    uint32_t chunk_size;         // Buckets per reduction chunk
+    uint32_t chunks_per_window;  // Reduction chunks per window
+    uint32_t padding;
 };
 
-// Bucket assignment entry (for sparse matrix)
+// Bucket entry for sparse matrix
 struct BucketEntry {
     uint32_t point_index;
     uint32_t bucket_index;
@@ -65,154 +83,196 @@ struct BucketEntry {
     uint32_t padding;
 };
 
-// ============================================================================
-// Field Arithmetic (BN254)
-// ============================================================================
+// Check if field element is zero
+inline bool field_is_zero(thread const FieldElement& a) {
+    uint64_t bits = 0;
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        bits |= a.limbs[i];
+    }
+    return bits == 0;
+}
 
-// BN254 field modulus
-constant uint64_t BN254_MODULUS[4] = {
-    0x3C208C16D87CFD47ULL,
-    0x97816A916871CA8DULL,
-    0xB85045B68181585DULL,
-    0x30644E72E131A029ULL
-};
+// Set field element to one (Montgomery form)
+inline void field_one(thread FieldElement& a) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        a.limbs[i] = CURVE_MONT_ONE[i];
+    }
+}
+
+// Set field element to zero
+inline void field_zero(thread FieldElement& a) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        a.limbs[i] = 0;
+    }
+}
+
+// Copy field element
+inline void field_copy(thread FieldElement& dst, thread const FieldElement& src) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        dst.limbs[i] = src.limbs[i];
+    }
+}
+
+inline bool field_equal(thread const FieldElement& a, thread const FieldElement& b) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        if (a.limbs[i] != b.limbs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
 
-// Check if a >= b (constant time)
-inline bool field_gte(thread const FieldElement& a, constant const uint64_t* b) {
-    for (int i = 3; i >= 0; i--) {
-        if (a.limbs[i] > b[i]) return true;
-        if (a.limbs[i] < b[i]) return false;
+inline bool field_gte_modulus(thread const FieldElement& a) {
+    for (int i = CURVE_LIMBS - 1; i >= 0; i--) {
+        if (a.limbs[i] > CURVE_MODULUS[i]) return true;
+        if (a.limbs[i] < CURVE_MODULUS[i]) return false;
     }
-    return true; // Equal
+    return true;
 }
 
-// Field addition: result = a + b mod p
+// Field addition: result = (a + b) mod p
 inline void field_add(thread FieldElement& result,
                       thread const FieldElement& a,
                       thread const FieldElement& b) {
     uint64_t carry = 0;
-    for (uint i = 0; i < 4; i++) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
         uint64_t sum = a.limbs[i] + b.limbs[i] + carry;
         carry = (sum < a.limbs[i]) || (carry && sum == a.limbs[i]) ? 1 : 0;
         result.limbs[i] = sum;
     }
-    
-    // Reduce if >= modulus
-    if (carry || field_gte(result, BN254_MODULUS)) {
+
+    if (carry || field_gte_modulus(result)) {
         uint64_t borrow = 0;
-        for (uint i = 0; i < 4; i++) {
-            uint64_t diff = result.limbs[i] - BN254_MODULUS[i] - borrow;
-            borrow = (diff > result.limbs[i]) ? 1 : 0;
+        for (uint i = 0; i < CURVE_LIMBS; i++) {
+            uint64_t diff = result.limbs[i] - CURVE_MODULUS[i] - borrow;
+            borrow = (diff > result.limbs[i]) || (borrow && diff == result.limbs[i]) ? 1 : 0;
             result.limbs[i] = diff;
         }
     }
 }
 
-// Field subtraction: result = a - b mod p
+// Field subtraction: result = (a - b) mod p
 inline void field_sub(thread FieldElement& result,
                       thread const FieldElement& a,
                       thread const FieldElement& b) {
     uint64_t borrow = 0;
-    for (uint i = 0; i < 4; i++) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
         uint64_t diff = a.limbs[i] - b.limbs[i] - borrow;
-        borrow = (diff > a.limbs[i]) ? 1 : 0;
+        borrow = (diff > a.limbs[i]) || (borrow && diff == a.limbs[i]) ? 1 : 0;
         result.limbs[i] = diff;
     }
-    
-    // Add modulus if underflow
+
     if (borrow) {
         uint64_t carry = 0;
-        for (uint i = 0; i < 4; i++) {
-            uint64_t sum = result.limbs[i] + BN254_MODULUS[i] + carry;
-            carry = (sum < result.limbs[i]) ? 1 : 0;
+        for (uint i = 0; i < CURVE_LIMBS; i++) {
+            uint64_t sum = result.limbs[i] + CURVE_MODULUS[i] + carry;
+            carry = (sum < result.limbs[i]) || (carry && sum == result.limbs[i]) ? 1 : 0;
             result.limbs[i] = sum;
         }
     }
 }
 
-// Check if field element is zero
-inline bool field_is_zero(thread const FieldElement& a) {
-    return a.limbs[0] == 0 && a.limbs[1] == 0 && a.limbs[2] == 0 && a.limbs[3] == 0;
-}
+// Montgomery multiplication: result = a * b * R^(-1) mod p
+// Schoolbook product followed by Montgomery reduction, mirroring the
+// CPU kernel in neon_montgomery.cc with mulhi() supplying the high limb.
+inline void field_mul(thread FieldElement& result,
+                      thread const FieldElement& a,
+                      thread const FieldElement& b) {
+    uint64_t t[CURVE_LIMBS * 2];
+    for (uint i = 0; i < CURVE_LIMBS * 2; i++) {
+        t[i] = 0;
+    }
 
-// Copy field element
-inline void field_copy(thread FieldElement& dst, thread const FieldElement& src) {
-    for (uint i = 0; i < 4; i++) {
-        dst.limbs[i] = src.limbs[i];
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        uint64_t carry = 0;
+        for (uint j = 0; j < CURVE_LIMBS; j++) {
+            uint64_t lo = a.limbs[i] * b.limbs[j];
+            uint64_t hi = mulhi(a.limbs[i], b.limbs[j]);
+
+            uint64_t s = t[i + j] + lo;
+            uint64_t c1 = (s < lo) ? 1 : 0;
+            uint64_t s2 = s + carry;
+            uint64_t c2 = (s2 < carry) ? 1 : 0;
+            t[i + j] = s2;
+            carry = hi + c1 + c2;
+        }
+        t[i + CURVE_LIMBS] = carry;
     }
-}
 
-// Set field element to zero
-inline void field_zero(thread FieldElement& a) {
-    for (uint i = 0; i < 4; i++) {
-        a.limbs[i] = 0;
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        uint64_t m = t[i] * CURVE_MU;
+        uint64_t carry = 0;
+        for (uint j = 0; j < CURVE_LIMBS; j++) {
+            uint64_t lo = m * CURVE_MODULUS[j];
+            uint64_t hi = mulhi(m, CURVE_MODULUS[j]);
+
+            uint64_t s = t[i + j] + lo;
+            uint64_t c1 = (s < lo) ? 1 : 0;
+            uint64_t s2 = s + carry;
+            uint64_t c2 = (s2 < carry) ? 1 : 0;
+            t[i + j] = s2;
+            carry = hi + c1 + c2;
+        }
+        for (uint k = i + CURVE_LIMBS; k < CURVE_LIMBS * 2 && carry != 0; k++) {
+            uint64_t s = t[k] + carry;
+            carry = (s < carry) ? 1 : 0;
+            t[k] = s;
+        }
+    }
+
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        result.limbs[i] = t[i + CURVE_LIMBS];
+    }
+
+    if (field_gte_modulus(result)) {
+        uint64_t borrow = 0;
+        for (uint i = 0; i < CURVE_LIMBS; i++) {
+            uint64_t diff = result.limbs[i] - CURVE_MODULUS[i] - borrow;
+            borrow = (diff > result.limbs[i]) || (borrow && diff == result.limbs[i]) ? 1 : 0;
+            result.limbs[i] = diff;
+        }
     }
 }
 
-// Set field element to one
-inline void field_one(thread FieldElement& a) {
-    a.limbs[0] = 1;
-    a.limbs[1] = 0;
-    a.limbs[2] = 0;
-    a.limbs[3] = 0;
+inline void field_sqr(thread FieldElement& result, thread const FieldElement& a) {
+    field_mul(result, a, a);
 }
 
-// ============================================================================
-// Point Operations
-// ============================================================================
+inline void field_dbl(thread FieldElement& result, thread const FieldElement& a) {
+    field_add(result, a, a);
+}
 
-// Check if Jacobian point is identity (Z = 0) - thread version
+// Check if Jacobian point is identity (Z = 0)
 inline bool point_is_identity(thread const JacobianPoint& p) {
     return field_is_zero(p.z);
 }
 
-// Check if Jacobian point is identity (Z = 0) - device version
-inline bool point_is_identity_device(device const JacobianPoint& p) {
-    return p.z.limbs[0] == 0 && p.z.limbs[1] == 0 && p.z.limbs[2] == 0 && p.z.limbs[3] == 0;
-}
-
-// Set point to identity - thread version
+// Set point to identity
 inline void point_set_identity(thread JacobianPoint& p) {
     field_one(p.x);
     field_one(p.y);
     field_zero(p.z);
 }
 
-// Set point to identity - device version
-inline void point_set_identity_device(device JacobianPoint& p) {
-    p.x.limbs[0] = 1;
-    p.x.limbs[1] = 0;
-    p.x.limbs[2] = 0;
-    p.x.limbs[3] = 0;
-    p.y.limbs[0] = 1;
-    p.y.limbs[1] = 0;
-    p.y.limbs[2] = 0;
-    p.y.limbs[3] = 0;
-    p.z.limbs[0] = 0;
-    p.z.limbs[1] = 0;
-    p.z.limbs[2] = 0;
-    p.z.limbs[3] = 0;
-}
-
-// Copy Jacobian point - thread to thread
+// Copy Jacobian point
 inline void point_copy(thread JacobianPoint& dst, thread const JacobianPoint& src) {
     field_copy(dst.x, src.x);
     field_copy(dst.y, src.y);
     field_copy(dst.z, src.z);
 }
 
-// Copy Jacobian point - thread to device
-inline void point_copy_to_device(device JacobianPoint& dst, thread const JacobianPoint& src) {
-    for (uint i = 0; i < 4; i++) {
+// Copy from device to thread
+inline void point_copy_from_device(thread JacobianPoint& dst, device const JacobianPoint& src) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
         dst.x.limbs[i] = src.x.limbs[i];
         dst.y.limbs[i] = src.y.limbs[i];
         dst.z.limbs[i] = src.z.limbs[i];
     }
 }
 
-// Copy Jacobian point - device to thread
-inline void point_copy_from_device(thread JacobianPoint& dst, device const JacobianPoint& src) {
-    for (uint i = 0; i < 4; i++) {
+// Copy from thread to device
+inline void point_copy_to_device(device JacobianPoint& dst, thread const JacobianPoint& src) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
         dst.x.limbs[i] = src.x.limbs[i];
         dst.y.limbs[i] = src.y.limbs[i];
         dst.z.limbs[i] = src.z.limbs[i];
@@ -224,7 +284,7 @@ inline void affine_to_jacobian(thread JacobianPoint& j, device const AffinePoint
     if (a.is_infinity) {
         point_set_identity(j);
     } else {
-        for (uint i = 0; i < 4; i++) {
+        for (uint i = 0; i < CURVE_LIMBS; i++) {
             j.x.limbs[i] = a.x.limbs[i];
             j.y.limbs[i] = a.y.limbs[i];
         }
@@ -232,15 +292,167 @@ inline void affine_to_jacobian(thread JacobianPoint& j, device const AffinePoint
     }
 }
 
-// ============================================================================
-// Scalar Operations
-// ============================================================================
+// Point doubling: result = 2p (dbl-2009-l, valid for a = 0 curves)
+inline void point_double(thread JacobianPoint& result, thread const JacobianPoint& p) {
+    if (point_is_identity(p)) {
+        point_set_identity(result);
+        return;
+    }
+
+    FieldElement a, b, c, d, e, f, t0, t1, y3;
+
+    field_sqr(a, p.x);               // A = X^2
+    field_sqr(b, p.y);               // B = Y^2
+    field_sqr(c, b);                 // C = B^2
+
+    field_add(t0, p.x, b);           // X + B
+    field_sqr(t0, t0);               // (X + B)^2
+    field_sub(t0, t0, a);
+    field_sub(t0, t0, c);
+    field_dbl(d, t0);                // D = 2((X + B)^2 - A - C)
+
+    field_dbl(e, a);
+    field_add(e, e, a);              // E = 3A
+    field_sqr(f, e);                 // F = E^2
+
+    field_dbl(t0, d);
+    field_sub(result.x, f, t0);      // X3 = F - 2D
+
+    field_sub(t0, d, result.x);
+    field_mul(t0, e, t0);            // E * (D - X3)
+    field_dbl(t1, c);
+    field_dbl(t1, t1);
+    field_dbl(t1, t1);               // 8C
+    field_sub(y3, t0, t1);           // Y3 = E(D - X3) - 8C
 
-// Get bit from scalar
-inline uint get_scalar_bit(device const Scalar& s, uint bit_index) {
-    uint limb_index = bit_index / 64;
-    uint bit_offset = bit_index % 64;
-    return (s.limbs[limb_index] >> bit_offset) & 1;
+    field_mul(t0, p.y, p.z);
+    field_dbl(result.z, t0);         // Z3 = 2YZ
+
+    field_copy(result.y, y3);
+}
+
+// Point addition: result = p + q (add-2007-bl with identity handling)
+inline void point_add(thread JacobianPoint& result,
+                      thread const JacobianPoint& p,
+                      thread const JacobianPoint& q) {
+    if (point_is_identity(p)) {
+        point_copy(result, q);
+        return;
+    }
+    if (point_is_identity(q)) {
+        point_copy(result, p);
+        return;
+    }
+
+    FieldElement z1z1, z2z2, u1, u2, s1, s2;
+
+    field_sqr(z1z1, p.z);            // Z1^2
+    field_sqr(z2z2, q.z);            // Z2^2
+    field_mul(u1, p.x, z2z2);        // U1 = X1 * Z2^2
+    field_mul(u2, q.x, z1z1);        // U2 = X2 * Z1^2
+
+    field_mul(s1, q.z, z2z2);
+    field_mul(s1, p.y, s1);          // S1 = Y1 * Z2^3
+    field_mul(s2, p.z, z1z1);
+    field_mul(s2, q.y, s2);          // S2 = Y2 * Z1^3
+
+    if (field_equal(u1, u2)) {
+        if (field_equal(s1, s2)) {
+            point_double(result, p);
+        } else {
+            point_set_identity(result);
+        }
+        return;
+    }
+
+    FieldElement h, i, j, r, v, t0, t1, y3;
+
+    field_sub(h, u2, u1);            // H = U2 - U1
+    field_dbl(i, h);
+    field_sqr(i, i);                 // I = (2H)^2
+    field_mul(j, h, i);              // J = H * I
+    field_sub(r, s2, s1);
+    field_dbl(r, r);                 // r = 2(S2 - S1)
+    field_mul(v, u1, i);             // V = U1 * I
+
+    field_sqr(t0, r);
+    field_sub(t0, t0, j);
+    field_dbl(t1, v);
+    field_sub(result.x, t0, t1);     // X3 = r^2 - J - 2V
+
+    field_sub(t0, v, result.x);
+    field_mul(t0, r, t0);            // r * (V - X3)
+    field_mul(t1, s1, j);
+    field_dbl(t1, t1);               // 2 * S1 * J
+    field_sub(y3, t0, t1);           // Y3 = r(V - X3) - 2*S1*J
+
+    field_add(t0, p.z, q.z);
+    field_sqr(t0, t0);
+    field_sub(t0, t0, z1z1);
+    field_sub(t0, t0, z2z2);
+    field_mul(result.z, t0, h);      // Z3 = ((Z1 + Z2)^2 - Z1^2 - Z2^2) * H
+
+    field_copy(result.y, y3);
+}
+
+// Mixed addition: result = p + q where q is affine (madd-2007-bl)
+inline void point_add_mixed(thread JacobianPoint& result,
+                            thread const JacobianPoint& p,
+                            thread const JacobianPoint& q_jac) {
+    // q_jac holds an affine point promoted to Jacobian with Z = 1
+    if (point_is_identity(p)) {
+        point_copy(result, q_jac);
+        return;
+    }
+    if (point_is_identity(q_jac)) {
+        point_copy(result, p);
+        return;
+    }
+
+    FieldElement z1z1, u2, s2;
+
+    field_sqr(z1z1, p.z);            // Z1^2
+    field_mul(u2, q_jac.x, z1z1);    // U2 = X2 * Z1^2
+    field_mul(s2, p.z, z1z1);
+    field_mul(s2, q_jac.y, s2);      // S2 = Y2 * Z1^3
+
+    if (field_equal(p.x, u2)) {
+        if (field_equal(p.y, s2)) {
+            point_double(result, p);
+        } else {
+            point_set_identity(result);
+        }
+        return;
+    }
+
+    FieldElement h, hh, i, j, r, v, t0, t1, y3;
+
+    field_sub(h, u2, p.x);           // H = U2 - X1
+    field_sqr(hh, h);                // HH = H^2
+    field_dbl(i, hh);
+    field_dbl(i, i);                 // I = 4 * HH
+    field_mul(j, h, i);              // J = H * I
+    field_sub(r, s2, p.y);
+    field_dbl(r, r);                 // r = 2(S2 - Y1)
+    field_mul(v, p.x, i);            // V = X1 * I
+
+    field_sqr(t0, r);
+    field_sub(t0, t0, j);
+    field_dbl(t1, v);
+    field_sub(result.x, t0, t1);     // X3 = r^2 - J - 2V
+
+    field_sub(t0, v, result.x);
+    field_mul(t0, r, t0);            // r * (V - X3)
+    field_mul(t1, p.y, j);
+    field_dbl(t1, t1);               // 2 * Y1 * J
+    field_sub(y3, t0, t1);           // Y3 = r(V - X3) - 2*Y1*J
+
+    field_add(t0, p.z, h);
+    field_sqr(t0, t0);
+    field_sub(t0, t0, z1z1);
+    field_sub(result.z, t0, hh);     // Z3 = (Z1 + H)^2 - Z1^2 - HH
+
+    field_copy(result.y, y3);
 }
 
 // Get window value from scalar
@@ -249,24 +461,17 @@ inline uint get_scalar_window(device const Scalar& s, uint window_index, uint wi
     uint value = 0;
     
     for (uint i = 0; i < window_size && (start_bit + i) < 256; i++) {
-        value |= get_scalar_bit(s, start_bit + i) << i;
+        uint limb_index = (start_bit + i) / 64;
+        uint bit_offset = (start_bit + i) % 64;
+        uint bit = (s.limbs[limb_index] >> bit_offset) & 1;
+        value |= bit << i;
     }
     
     return value;
 }
 
-// ============================================================================
-// Bucket Assignment Kernel
-// ============================================================================
-
-/**
- * Assign points to buckets based on scalar window values
- *
- * This kernel computes the bucket assignment for each (point, window) pair.
- * The output is a sparse matrix representation where each entry indicates
- * which bucket a point should be added to for a given window.
- */
-kernel void bucket_assignment(
+// Bucket assignment kernel
+kernel void MSM_KERNEL(msm_bucket_assignment)(
     device const Scalar* scalars [[buffer(0)]],
     device BucketEntry* entries [[buffer(1)]],
     device atomic_uint* entry_counts [[buffer(2)]],
@@ -280,41 +485,130 @@ kernel void bucket_assignment(
         return;
     }
     
-    // Get window value for this scalar
     uint bucket_value = get_scalar_window(scalars[point_index], window_index, config.window_size);
     
-    // Skip zero buckets (identity contribution)
     if (bucket_value == 0) {
         return;
     }
     
-    // Bucket index is value - 1 (since bucket 0 is for value 1)
     uint bucket_index = bucket_value - 1;
-    
-    // Atomically get entry index
     uint entry_index = atomic_fetch_add_explicit(&entry_counts[window_index], 1, memory_order_relaxed);
-    
-    // Store entry
     uint global_entry_index = window_index * config.num_points + entry_index;
+    
     entries[global_entry_index].point_index = point_index;
     entries[global_entry_index].bucket_index = bucket_index;
     entries[global_entry_index].window_index = window_index;
 }
 
-// ============================================================================
-// Bucket Accumulation Kernel
-// ============================================================================
+// Per-bucket entry histogram (sorted scheduling, pass 1)
+//
+// Counting sort of the entries by (window_index, bucket_index): this
+// pass only bumps a counter per bucket, so the atomic traffic is a
+// 4-byte add instead of a serialized point addition on hot buckets.
+kernel void MSM_KERNEL(msm_bucket_histogram)(
+    device const Scalar* scalars [[buffer(0)]],
+    device atomic_uint* bucket_counts [[buffer(1)]],
+    constant MSMConfig& config [[buffer(2)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    uint point_index = gid / config.num_windows;
+    uint window_index = gid % config.num_windows;
 
-/**
- * Accumulate points into buckets
- *
- * This kernel processes bucket entries and accumulates points into their
- * assigned buckets using point addition.
- *
- * Note: This is a simplified version. A production implementation would
- * use more sophisticated parallel reduction techniques.
- */
-kernel void bucket_accumulation(
+    if (point_index >= config.num_points) {
+        return;
+    }
+
+    uint bucket_value = get_scalar_window(scalars[point_index], window_index, config.window_size);
+
+    if (bucket_value == 0) {
+        return;
+    }
+
+    uint count_index = window_index * config.buckets_per_window + (bucket_value - 1);
+    atomic_fetch_add_explicit(&bucket_counts[count_index], 1, memory_order_relaxed);
+}
+
+// Exclusive prefix sum over each window's bucket counts (pass 2)
+//
+// One thread walks one window's buckets, producing the start offset of
+// every bucket's run and seeding the scatter cursors with the same
+// values.
+kernel void MSM_KERNEL(msm_bucket_prefix_sum)(
+    device const uint* bucket_counts [[buffer(0)]],
+    device uint* bucket_offsets [[buffer(1)]],
+    device atomic_uint* bucket_cursors [[buffer(2)]],
+    constant MSMConfig& config [[buffer(3)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    if (gid >= config.num_windows) {
+        return;
+    }
+
+    uint base = gid * config.buckets_per_window;
+    uint running = 0;
+
+    for (uint b = 0; b < config.buckets_per_window; b++) {
+        bucket_offsets[base + b] = running;
+        atomic_store_explicit(&bucket_cursors[base + b], running, memory_order_relaxed);
+        running += bucket_counts[base + b];
+    }
+}
+
+// Scatter entries into bucket-sorted order (pass 3)
+//
+// Each entry lands at its bucket's cursor, so window w's entries occupy
+// [w * num_points, ...) sorted by bucket_index with each bucket's run
+// contiguous.
+kernel void MSM_KERNEL(msm_bucket_scatter)(
+    device const Scalar* scalars [[buffer(0)]],
+    device BucketEntry* entries [[buffer(1)]],
+    device atomic_uint* bucket_cursors [[buffer(2)]],
+    constant MSMConfig& config [[buffer(3)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    uint point_index = gid / config.num_windows;
+    uint window_index = gid % config.num_windows;
+
+    if (point_index >= config.num_points) {
+        return;
+    }
+
+    uint bucket_value = get_scalar_window(scalars[point_index], window_index, config.window_size);
+
+    if (bucket_value == 0) {
+        return;
+    }
+
+    uint bucket_index = bucket_value - 1;
+    uint cursor_index = window_index * config.buckets_per_window + bucket_index;
+    uint slot = atomic_fetch_add_explicit(&bucket_cursors[cursor_index], 1, memory_order_relaxed);
+    uint global_entry_index = window_index * config.num_points + slot;
+
+    entries[global_entry_index].point_index = point_index;
+    entries[global_entry_index].bucket_index = bucket_index;
+    entries[global_entry_index].window_index = window_index;
+}
+
+// Initialize buckets to identity
+kernel void MSM_KERNEL(msm_init_buckets)(
+    device JacobianPoint* buckets [[buffer(0)]],
+    constant MSMConfig& config [[buffer(1)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    if (gid >= config.num_windows * config.buckets_per_window) {
+        return;
+    }
+    
+    // Set to identity: (1, 1, 0)
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        buckets[gid].x.limbs[i] = (i == 0) ? 1 : 0;
+        buckets[gid].y.limbs[i] = (i == 0) ? 1 : 0;
+        buckets[gid].z.limbs[i] = 0;
+    }
+}
+
+// Bucket accumulation (one thread per bucket)
+kernel void MSM_KERNEL(msm_bucket_accumulate)(
     device const AffinePoint* points [[buffer(0)]],
     device const BucketEntry* entries [[buffer(1)]],
     device const uint* entry_counts [[buffer(2)]],
@@ -324,139 +618,740 @@ kernel void bucket_accumulation(
 ) {
     uint window_index = gid / config.buckets_per_window;
     uint bucket_index = gid % config.buckets_per_window;
-    
+
     if (window_index >= config.num_windows) {
         return;
     }
-    
-    // Initialize bucket to identity
+
     uint bucket_global_index = window_index * config.buckets_per_window + bucket_index;
-    point_set_identity_device(buckets[bucket_global_index]);
-    
-    // Process all entries for this window
     uint num_entries = entry_counts[window_index];
     uint entries_offset = window_index * config.num_points;
-    
+
+    JacobianPoint acc;
+    point_set_identity(acc);
+
+    // Add every point routed to this bucket
     for (uint i = 0; i < num_entries; i++) {
         BucketEntry entry = entries[entries_offset + i];
-        
+
         if (entry.bucket_index == bucket_index) {
-            // Add point to bucket
             JacobianPoint point_j;
             affine_to_jacobian(point_j, points[entry.point_index]);
-            
-            // Simple addition (in production, use optimized mixed addition)
-            if (point_is_identity_device(buckets[bucket_global_index])) {
-                point_copy_to_device(buckets[bucket_global_index], point_j);
-            } else {
-                // TODO: Implement full point addition
-                // For now, just copy (placeholder)
-                // In production, this would be a proper Jacobian addition
-            }
+            point_add_mixed(acc, acc, point_j);
         }
     }
+
+    point_copy_to_device(buckets[bucket_global_index], acc);
 }
 
-// ============================================================================
-// Bucket Reduction Kernel
-// ============================================================================
+// Bucket accumulation folding into existing bucket state
+//
+// Identical to msm_bucket_accumulate except the accumulator starts from
+// the bucket's current value instead of identity, so successive tiles of
+// a chunked MSM stream through the same GPU-resident buckets.
+kernel void MSM_KERNEL(msm_bucket_accumulate_fold)(
+    device const AffinePoint* points [[buffer(0)]],
+    device const BucketEntry* entries [[buffer(1)]],
+    device const uint* entry_counts [[buffer(2)]],
+    device JacobianPoint* buckets [[buffer(3)]],
+    constant MSMConfig& config [[buffer(4)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    uint window_index = gid / config.buckets_per_window;
+    uint bucket_index = gid % config.buckets_per_window;
 
-/**
- * Reduce buckets to compute window sums
- *
- * For each window, compute: sum = bucket[n-1] + 2*bucket[n-2] + ... + n*bucket[0]
- * This is done efficiently as: sum = bucket[n-1] + (bucket[n-1] + bucket[n-2]) + ...
- */
-kernel void bucket_reduction(
-    device JacobianPoint* buckets [[buffer(0)]],
-    device JacobianPoint* window_sums [[buffer(1)]],
-    constant MSMConfig& config [[buffer(2)]],
-    uint window_index [[thread_position_in_grid]]
+    if (window_index >= config.num_windows) {
+        return;
+    }
+
+    uint bucket_global_index = window_index * config.buckets_per_window + bucket_index;
+    uint num_entries = entry_counts[window_index];
+    uint entries_offset = window_index * config.num_points;
+
+    JacobianPoint acc;
+    point_copy_from_device(acc, buckets[bucket_global_index]);
+
+    for (uint i = 0; i < num_entries; i++) {
+        BucketEntry entry = entries[entries_offset + i];
+
+        if (entry.bucket_index == bucket_index) {
+            JacobianPoint point_j;
+            affine_to_jacobian(point_j, points[entry.point_index]);
+            point_add_mixed(acc, acc, point_j);
+        }
+    }
+
+    point_copy_to_device(buckets[bucket_global_index], acc);
+}
+
+// Bucket accumulation over sorted entry runs (one thread per bucket)
+//
+// With entries counting-sorted by (window_index, bucket_index), each
+// bucket's points sit in one contiguous run, so the thread walks exactly
+// its own entries with no scanning, no atomics and no dependence on how
+// skewed the scalar distribution is.
+kernel void MSM_KERNEL(msm_bucket_accumulate_sorted)(
+    device const AffinePoint* points [[buffer(0)]],
+    device const BucketEntry* entries [[buffer(1)]],
+    device const uint* bucket_offsets [[buffer(2)]],
+    device const uint* bucket_counts [[buffer(3)]],
+    device JacobianPoint* buckets [[buffer(4)]],
+    constant MSMConfig& config [[buffer(5)]],
+    uint gid [[thread_position_in_grid]]
 ) {
+    uint window_index = gid / config.buckets_per_window;
+    uint bucket_index = gid % config.buckets_per_window;
+
     if (window_index >= config.num_windows) {
         return;
     }
-    
-    uint bucket_offset = window_index * config.buckets_per_window;
-    
-    // Initialize running sum and window sum
-    JacobianPoint running_sum;
+
+    uint bucket_global_index = window_index * config.buckets_per_window + bucket_index;
+    uint start = window_index * config.num_points + bucket_offsets[bucket_global_index];
+    uint end = start + bucket_counts[bucket_global_index];
+
+    JacobianPoint acc;
+    point_set_identity(acc);
+
+    for (uint i = start; i < end; i++) {
+        JacobianPoint point_j;
+        affine_to_jacobian(point_j, points[entries[i].point_index]);
+        point_add_mixed(acc, acc, point_j);
+    }
+
+    point_copy_to_device(buckets[bucket_global_index], acc);
+}
+
+// Sorted bucket accumulation folding into existing bucket state
+//
+// Identical to msm_bucket_accumulate_sorted except the accumulator
+// starts from the bucket's current value, for the chunked MSM's
+// GPU-resident buckets.
+kernel void MSM_KERNEL(msm_bucket_accumulate_sorted_fold)(
+    device const AffinePoint* points [[buffer(0)]],
+    device const BucketEntry* entries [[buffer(1)]],
+    device const uint* bucket_offsets [[buffer(2)]],
+    device const uint* bucket_counts [[buffer(3)]],
+    device JacobianPoint* buckets [[buffer(4)]],
+    constant MSMConfig& config [[buffer(5)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    uint window_index = gid / config.buckets_per_window;
+    uint bucket_index = gid % config.buckets_per_window;
+
+    if (window_index >= config.num_windows) {
+        return;
+    }
+
+    uint bucket_global_index = window_index * config.buckets_per_window + bucket_index;
+    uint start = window_index * config.num_points + bucket_offsets[bucket_global_index];
+    uint end = start + bucket_counts[bucket_global_index];
+
+    JacobianPoint acc;
+    point_copy_from_device(acc, buckets[bucket_global_index]);
+
+    for (uint i = start; i < end; i++) {
+        JacobianPoint point_j;
+        affine_to_jacobian(point_j, points[entries[i].point_index]);
+        point_add_mixed(acc, acc, point_j);
+    }
+
+    point_copy_to_device(buckets[bucket_global_index], acc);
+}
+
+// Chunked bucket reduction (one thread per chunk of buckets)
+//
+// Walking a chunk [lo, hi) from the top down while keeping a running
+// sum yields sum = Σ (i - lo + 1) * bucket[i] and running = Σ bucket[i].
+// The per-window combine below re-weights each chunk by its base offset,
+// so the full running-sum over 2^w buckets parallelizes across chunks.
+kernel void MSM_KERNEL(msm_bucket_reduce)(
+    device const JacobianPoint* buckets [[buffer(0)]],
+    device JacobianPoint* chunk_sums [[buffer(1)]],
+    device JacobianPoint* chunk_totals [[buffer(2)]],
+    constant MSMConfig& config [[buffer(3)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    uint window_index = gid / config.chunks_per_window;
+    uint chunk_index = gid % config.chunks_per_window;
+
+    if (window_index >= config.num_windows) {
+        return;
+    }
+
+    uint lo = chunk_index * config.chunk_size;
+    uint hi = lo + config.chunk_size;
+    if (hi > config.buckets_per_window) {
+        hi = config.buckets_per_window;
+    }
+
+    uint bucket_base = window_index * config.buckets_per_window;
+
+    JacobianPoint running, sum;
+    point_set_identity(running);
+    point_set_identity(sum);
+
+    for (uint i = hi; i > lo; i--) {
+        JacobianPoint bucket;
+        point_copy_from_device(bucket, buckets[bucket_base + i - 1]);
+        point_add(running, running, bucket);
+        point_add(sum, sum, running);
+    }
+
+    point_copy_to_device(chunk_sums[gid], sum);
+    point_copy_to_device(chunk_totals[gid], running);
+}
+
+// Per-window combination of chunk partial sums (one thread per window)
+//
+// window_sum = Σ_c (chunk_sums[c] + lo_c * chunk_totals[c]) where lo_c
+// is the chunk's base bucket offset; the constant multiple is formed by
+// double-and-add over at most window_size bits.
+kernel void MSM_KERNEL(msm_window_reduce)(
+    device const JacobianPoint* chunk_sums [[buffer(0)]],
+    device const JacobianPoint* chunk_totals [[buffer(1)]],
+    device JacobianPoint* window_sums [[buffer(2)]],
+    constant MSMConfig& config [[buffer(3)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    if (gid >= config.num_windows) {
+        return;
+    }
+
+    uint chunk_base = gid * config.chunks_per_window;
+
     JacobianPoint window_sum;
-    point_set_identity(running_sum);
     point_set_identity(window_sum);
-    
-    // Process buckets from highest to lowest
-    for (int i = config.buckets_per_window - 1; i >= 0; i--) {
-        JacobianPoint bucket;
-        point_copy_from_device(bucket, buckets[bucket_offset + i]);
-        
-        // running_sum += bucket
-        if (!point_is_identity(bucket)) {
-            if (point_is_identity(running_sum)) {
-                point_copy(running_sum, bucket);
-            } else {
-                // TODO: Implement point addition
-            }
-        }
-        
-        // window_sum += running_sum
-        if (!point_is_identity(running_sum)) {
-            if (point_is_identity(window_sum)) {
-                point_copy(window_sum, running_sum);
-            } else {
-                // TODO: Implement point addition
+
+    for (uint c = 0; c < config.chunks_per_window; c++) {
+        JacobianPoint sum, total;
+        point_copy_from_device(sum, chunk_sums[chunk_base + c]);
+        point_copy_from_device(total, chunk_totals[chunk_base + c]);
+
+        point_add(window_sum, window_sum, sum);
+
+        uint multiplier = c * config.chunk_size;
+        if (multiplier != 0 && !point_is_identity(total)) {
+            JacobianPoint scaled;
+            point_set_identity(scaled);
+            for (int bit = 31; bit >= 0; bit--) {
+                point_double(scaled, scaled);
+                if ((multiplier >> bit) & 1) {
+                    point_add(scaled, scaled, total);
+                }
             }
+            point_add(window_sum, window_sum, scaled);
         }
     }
-    
-    // Store window sum
-    point_copy_to_device(window_sums[window_index], window_sum);
-}
 
-// ============================================================================
-// Final Reduction Kernel
-// ============================================================================
+    point_copy_to_device(window_sums[gid], window_sum);
+}
 
-/**
- * Combine window sums into final MSM result
- *
- * result = window_sums[n-1] * 2^((n-1)*w) + ... + window_sums[0]
- * Computed as: result = (...((window_sums[n-1] * 2^w) + window_sums[n-2]) * 2^w + ...) + window_sums[0]
- */
-kernel void final_reduction(
-    device JacobianPoint* window_sums [[buffer(0)]],
+// Final window combination (single thread)
+//
+// result = Σ_w window_sums[w] * 2^(w * window_size), evaluated Horner
+// style from the top window so only the final point leaves the GPU.
+kernel void MSM_KERNEL(msm_final_combine)(
+    device const JacobianPoint* window_sums [[buffer(0)]],
     device JacobianPoint* result [[buffer(1)]],
     constant MSMConfig& config [[buffer(2)]],
     uint gid [[thread_position_in_grid]]
 ) {
     if (gid != 0) {
-        return; // Only one thread does the final reduction
+        return;
     }
-    
+
     JacobianPoint acc;
     point_set_identity(acc);
-    
-    // Process windows from highest to lowest
-    for (int w = config.num_windows - 1; w >= 0; w--) {
-        // Double acc by window_size
-        for (uint i = 0; i < config.window_size; i++) {
-            if (!point_is_identity(acc)) {
-                // TODO: Implement point doubling
-            }
+
+    for (uint w = config.num_windows; w > 0; w--) {
+        for (uint k = 0; k < config.window_size; k++) {
+            point_double(acc, acc);
         }
-        
-        // Add window sum
-        JacobianPoint ws;
-        point_copy_from_device(ws, window_sums[w]);
-        if (!point_is_identity(ws)) {
-            if (point_is_identity(acc)) {
-                point_copy(acc, ws);
-            } else {
-                // TODO: Implement point addition
+        JacobianPoint window_sum;
+        point_copy_from_device(window_sum, window_sums[w - 1]);
+        point_add(acc, acc, window_sum);
+    }
+
+    point_copy_to_device(result[0], acc);
+}
+
+// Fp2 element: c0 + c1 * u
+struct FieldElement2 {
+    FieldElement c0;
+    FieldElement c1;
+};
+
+// Jacobian G2 point representation
+struct JacobianPointG2 {
+    FieldElement2 x;
+    FieldElement2 y;
+    FieldElement2 z;
+};
+
+// Affine G2 point representation
+struct AffinePointG2 {
+    FieldElement2 x;
+    FieldElement2 y;
+    uint32_t is_infinity;
+    uint32_t padding;
+};
+
+inline bool fp2_is_zero(thread const FieldElement2& a) {
+    return field_is_zero(a.c0) && field_is_zero(a.c1);
+}
+
+inline void fp2_zero(thread FieldElement2& a) {
+    field_zero(a.c0);
+    field_zero(a.c1);
+}
+
+inline void fp2_one(thread FieldElement2& a) {
+    field_one(a.c0);
+    field_zero(a.c1);
+}
+
+inline void fp2_copy(thread FieldElement2& dst, thread const FieldElement2& src) {
+    field_copy(dst.c0, src.c0);
+    field_copy(dst.c1, src.c1);
+}
+
+inline bool fp2_equal(thread const FieldElement2& a, thread const FieldElement2& b) {
+    return field_equal(a.c0, b.c0) && field_equal(a.c1, b.c1);
+}
+
+inline void fp2_add(thread FieldElement2& result,
+                    thread const FieldElement2& a,
+                    thread const FieldElement2& b) {
+    field_add(result.c0, a.c0, b.c0);
+    field_add(result.c1, a.c1, b.c1);
+}
+
+inline void fp2_sub(thread FieldElement2& result,
+                    thread const FieldElement2& a,
+                    thread const FieldElement2& b) {
+    field_sub(result.c0, a.c0, b.c0);
+    field_sub(result.c1, a.c1, b.c1);
+}
+
+inline void fp2_dbl(thread FieldElement2& result, thread const FieldElement2& a) {
+    field_add(result.c0, a.c0, a.c0);
+    field_add(result.c1, a.c1, a.c1);
+}
+
+// Fp2 multiplication (Karatsuba): with u^2 = -1,
+// c0 = a0*b0 - a1*b1, c1 = (a0 + a1)(b0 + b1) - a0*b0 - a1*b1
+inline void fp2_mul(thread FieldElement2& result,
+                    thread const FieldElement2& a,
+                    thread const FieldElement2& b) {
+    FieldElement t0, t1, t2, sa, sb;
+
+    field_mul(t0, a.c0, b.c0);
+    field_mul(t1, a.c1, b.c1);
+    field_add(sa, a.c0, a.c1);
+    field_add(sb, b.c0, b.c1);
+    field_mul(t2, sa, sb);
+
+    field_sub(result.c0, t0, t1);
+    field_sub(t2, t2, t0);
+    field_sub(result.c1, t2, t1);
+}
+
+// Fp2 squaring (complex method): c0 = (a0 + a1)(a0 - a1), c1 = 2*a0*a1
+inline void fp2_sqr(thread FieldElement2& result, thread const FieldElement2& a) {
+    FieldElement sum, diff, prod;
+
+    field_add(sum, a.c0, a.c1);
+    field_sub(diff, a.c0, a.c1);
+    field_mul(prod, a.c0, a.c1);
+
+    field_mul(result.c0, sum, diff);
+    field_add(result.c1, prod, prod);
+}
+
+// Check if Jacobian G2 point is identity (Z = 0)
+inline bool g2_point_is_identity(thread const JacobianPointG2& p) {
+    return fp2_is_zero(p.z);
+}
+
+// Set G2 point to identity
+inline void g2_point_set_identity(thread JacobianPointG2& p) {
+    fp2_one(p.x);
+    fp2_one(p.y);
+    fp2_zero(p.z);
+}
+
+// Copy Jacobian G2 point
+inline void g2_point_copy(thread JacobianPointG2& dst, thread const JacobianPointG2& src) {
+    fp2_copy(dst.x, src.x);
+    fp2_copy(dst.y, src.y);
+    fp2_copy(dst.z, src.z);
+}
+
+// Copy from device to thread
+inline void g2_point_copy_from_device(thread JacobianPointG2& dst, device const JacobianPointG2& src) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        dst.x.c0.limbs[i] = src.x.c0.limbs[i];
+        dst.x.c1.limbs[i] = src.x.c1.limbs[i];
+        dst.y.c0.limbs[i] = src.y.c0.limbs[i];
+        dst.y.c1.limbs[i] = src.y.c1.limbs[i];
+        dst.z.c0.limbs[i] = src.z.c0.limbs[i];
+        dst.z.c1.limbs[i] = src.z.c1.limbs[i];
+    }
+}
+
+// Copy from thread to device
+inline void g2_point_copy_to_device(device JacobianPointG2& dst, thread const JacobianPointG2& src) {
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        dst.x.c0.limbs[i] = src.x.c0.limbs[i];
+        dst.x.c1.limbs[i] = src.x.c1.limbs[i];
+        dst.y.c0.limbs[i] = src.y.c0.limbs[i];
+        dst.y.c1.limbs[i] = src.y.c1.limbs[i];
+        dst.z.c0.limbs[i] = src.z.c0.limbs[i];
+        dst.z.c1.limbs[i] = src.z.c1.limbs[i];
+    }
+}
+
+// Convert affine G2 to Jacobian
+inline void g2_affine_to_jacobian(thread JacobianPointG2& j, device const AffinePointG2& a) {
+    if (a.is_infinity) {
+        g2_point_set_identity(j);
+    } else {
+        for (uint i = 0; i < CURVE_LIMBS; i++) {
+            j.x.c0.limbs[i] = a.x.c0.limbs[i];
+            j.x.c1.limbs[i] = a.x.c1.limbs[i];
+            j.y.c0.limbs[i] = a.y.c0.limbs[i];
+            j.y.c1.limbs[i] = a.y.c1.limbs[i];
+        }
+        fp2_one(j.z);
+    }
+}
+
+// G2 point doubling: result = 2p (dbl-2009-l, valid for a = 0 curves)
+inline void g2_point_double(thread JacobianPointG2& result, thread const JacobianPointG2& p) {
+    if (g2_point_is_identity(p)) {
+        g2_point_set_identity(result);
+        return;
+    }
+
+    FieldElement2 a, b, c, d, e, f, t0, t1, y3;
+
+    fp2_sqr(a, p.x);                 // A = X^2
+    fp2_sqr(b, p.y);                 // B = Y^2
+    fp2_sqr(c, b);                   // C = B^2
+
+    fp2_add(t0, p.x, b);             // X + B
+    fp2_sqr(t0, t0);                 // (X + B)^2
+    fp2_sub(t0, t0, a);
+    fp2_sub(t0, t0, c);
+    fp2_dbl(d, t0);                  // D = 2((X + B)^2 - A - C)
+
+    fp2_dbl(e, a);
+    fp2_add(e, e, a);                // E = 3A
+    fp2_sqr(f, e);                   // F = E^2
+
+    fp2_dbl(t0, d);
+    fp2_sub(result.x, f, t0);        // X3 = F - 2D
+
+    fp2_sub(t0, d, result.x);
+    fp2_mul(t0, e, t0);              // E * (D - X3)
+    fp2_dbl(t1, c);
+    fp2_dbl(t1, t1);
+    fp2_dbl(t1, t1);                 // 8C
+    fp2_sub(y3, t0, t1);             // Y3 = E(D - X3) - 8C
+
+    fp2_mul(t0, p.y, p.z);
+    fp2_dbl(result.z, t0);           // Z3 = 2YZ
+
+    fp2_copy(result.y, y3);
+}
+
+// G2 point addition: result = p + q (add-2007-bl with identity handling)
+inline void g2_point_add(thread JacobianPointG2& result,
+                         thread const JacobianPointG2& p,
+                         thread const JacobianPointG2& q) {
+    if (g2_point_is_identity(p)) {
+        g2_point_copy(result, q);
+        return;
+    }
+    if (g2_point_is_identity(q)) {
+        g2_point_copy(result, p);
+        return;
+    }
+
+    FieldElement2 z1z1, z2z2, u1, u2, s1, s2;
+
+    fp2_sqr(z1z1, p.z);              // Z1^2
+    fp2_sqr(z2z2, q.z);              // Z2^2
+    fp2_mul(u1, p.x, z2z2);          // U1 = X1 * Z2^2
+    fp2_mul(u2, q.x, z1z1);          // U2 = X2 * Z1^2
+
+    fp2_mul(s1, q.z, z2z2);
+    fp2_mul(s1, p.y, s1);            // S1 = Y1 * Z2^3
+    fp2_mul(s2, p.z, z1z1);
+    fp2_mul(s2, q.y, s2);            // S2 = Y2 * Z1^3
+
+    if (fp2_equal(u1, u2)) {
+        if (fp2_equal(s1, s2)) {
+            g2_point_double(result, p);
+        } else {
+            g2_point_set_identity(result);
+        }
+        return;
+    }
+
+    FieldElement2 h, i, j, r, v, t0, t1, y3;
+
+    fp2_sub(h, u2, u1);              // H = U2 - U1
+    fp2_dbl(i, h);
+    fp2_sqr(i, i);                   // I = (2H)^2
+    fp2_mul(j, h, i);                // J = H * I
+    fp2_sub(r, s2, s1);
+    fp2_dbl(r, r);                   // r = 2(S2 - S1)
+    fp2_mul(v, u1, i);               // V = U1 * I
+
+    fp2_sqr(t0, r);
+    fp2_sub(t0, t0, j);
+    fp2_dbl(t1, v);
+    fp2_sub(result.x, t0, t1);       // X3 = r^2 - J - 2V
+
+    fp2_sub(t0, v, result.x);
+    fp2_mul(t0, r, t0);              // r * (V - X3)
+    fp2_mul(t1, s1, j);
+    fp2_dbl(t1, t1);                 // 2 * S1 * J
+    fp2_sub(y3, t0, t1);             // Y3 = r(V - X3) - 2*S1*J
+
+    fp2_add(t0, p.z, q.z);
+    fp2_sqr(t0, t0);
+    fp2_sub(t0, t0, z1z1);
+    fp2_sub(t0, t0, z2z2);
+    fp2_mul(result.z, t0, h);        // Z3 = ((Z1 + Z2)^2 - Z1^2 - Z2^2) * H
+
+    fp2_copy(result.y, y3);
+}
+
+// G2 mixed addition: result = p + q where q is affine (madd-2007-bl)
+inline void g2_point_add_mixed(thread JacobianPointG2& result,
+                               thread const JacobianPointG2& p,
+                               thread const JacobianPointG2& q_jac) {
+    // q_jac holds an affine point promoted to Jacobian with Z = 1
+    if (g2_point_is_identity(p)) {
+        g2_point_copy(result, q_jac);
+        return;
+    }
+    if (g2_point_is_identity(q_jac)) {
+        g2_point_copy(result, p);
+        return;
+    }
+
+    FieldElement2 z1z1, u2, s2;
+
+    fp2_sqr(z1z1, p.z);              // Z1^2
+    fp2_mul(u2, q_jac.x, z1z1);      // U2 = X2 * Z1^2
+    fp2_mul(s2, p.z, z1z1);
+    fp2_mul(s2, q_jac.y, s2);        // S2 = Y2 * Z1^3
+
+    if (fp2_equal(p.x, u2)) {
+        if (fp2_equal(p.y, s2)) {
+            g2_point_double(result, p);
+        } else {
+            g2_point_set_identity(result);
+        }
+        return;
+    }
+
+    FieldElement2 h, hh, i, j, r, v, t0, t1, y3;
+
+    fp2_sub(h, u2, p.x);             // H = U2 - X1
+    fp2_sqr(hh, h);                  // HH = H^2
+    fp2_dbl(i, hh);
+    fp2_dbl(i, i);                   // I = 4 * HH
+    fp2_mul(j, h, i);                // J = H * I
+    fp2_sub(r, s2, p.y);
+    fp2_dbl(r, r);                   // r = 2(S2 - Y1)
+    fp2_mul(v, p.x, i);              // V = X1 * I
+
+    fp2_sqr(t0, r);
+    fp2_sub(t0, t0, j);
+    fp2_dbl(t1, v);
+    fp2_sub(result.x, t0, t1);       // X3 = r^2 - J - 2V
+
+    fp2_sub(t0, v, result.x);
+    fp2_mul(t0, r, t0);              // r * (V - X3)
+    fp2_mul(t1, p.y, j);
+    fp2_dbl(t1, t1);                 // 2 * Y1 * J
+    fp2_sub(y3, t0, t1);             // Y3 = r(V - X3) - 2*Y1*J
+
+    fp2_add(t0, p.z, h);
+    fp2_sqr(t0, t0);
+    fp2_sub(t0, t0, z1z1);
+    fp2_sub(result.z, t0, hh);       // Z3 = (Z1 + H)^2 - Z1^2 - HH
+
+    fp2_copy(result.y, y3);
+}
+
+// Initialize G2 buckets to identity
+kernel void MSM_KERNEL(msm_g2_init_buckets)(
+    device JacobianPointG2* buckets [[buffer(0)]],
+    constant MSMConfig& config [[buffer(1)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    if (gid >= config.num_windows * config.buckets_per_window) {
+        return;
+    }
+
+    // Set to identity: (1, 1, 0) with Fp2 components
+    for (uint i = 0; i < CURVE_LIMBS; i++) {
+        buckets[gid].x.c0.limbs[i] = (i == 0) ? 1 : 0;
+        buckets[gid].x.c1.limbs[i] = 0;
+        buckets[gid].y.c0.limbs[i] = (i == 0) ? 1 : 0;
+        buckets[gid].y.c1.limbs[i] = 0;
+        buckets[gid].z.c0.limbs[i] = 0;
+        buckets[gid].z.c1.limbs[i] = 0;
+    }
+}
+
+// G2 bucket accumulation (one thread per bucket)
+kernel void MSM_KERNEL(msm_g2_bucket_accumulate)(
+    device const AffinePointG2* points [[buffer(0)]],
+    device const BucketEntry* entries [[buffer(1)]],
+    device const uint* entry_counts [[buffer(2)]],
+    device JacobianPointG2* buckets [[buffer(3)]],
+    constant MSMConfig& config [[buffer(4)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    uint window_index = gid / config.buckets_per_window;
+    uint bucket_index = gid % config.buckets_per_window;
+
+    if (window_index >= config.num_windows) {
+        return;
+    }
+
+    uint bucket_global_index = window_index * config.buckets_per_window + bucket_index;
+    uint num_entries = entry_counts[window_index];
+    uint entries_offset = window_index * config.num_points;
+
+    JacobianPointG2 acc;
+    g2_point_set_identity(acc);
+
+    // Add every point routed to this bucket
+    for (uint i = 0; i < num_entries; i++) {
+        BucketEntry entry = entries[entries_offset + i];
+
+        if (entry.bucket_index == bucket_index) {
+            JacobianPointG2 point_j;
+            g2_affine_to_jacobian(point_j, points[entry.point_index]);
+            g2_point_add_mixed(acc, acc, point_j);
+        }
+    }
+
+    g2_point_copy_to_device(buckets[bucket_global_index], acc);
+}
+
+// Chunked G2 bucket reduction (one thread per chunk of buckets)
+//
+// Same running-sum decomposition as msm_bucket_reduce over the G2
+// point type.
+kernel void MSM_KERNEL(msm_g2_bucket_reduce)(
+    device const JacobianPointG2* buckets [[buffer(0)]],
+    device JacobianPointG2* chunk_sums [[buffer(1)]],
+    device JacobianPointG2* chunk_totals [[buffer(2)]],
+    constant MSMConfig& config [[buffer(3)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    uint window_index = gid / config.chunks_per_window;
+    uint chunk_index = gid % config.chunks_per_window;
+
+    if (window_index >= config.num_windows) {
+        return;
+    }
+
+    uint lo = chunk_index * config.chunk_size;
+    uint hi = lo + config.chunk_size;
+    if (hi > config.buckets_per_window) {
+        hi = config.buckets_per_window;
+    }
+
+    uint bucket_base = window_index * config.buckets_per_window;
+
+    JacobianPointG2 running, sum;
+    g2_point_set_identity(running);
+    g2_point_set_identity(sum);
+
+    for (uint i = hi; i > lo; i--) {
+        JacobianPointG2 bucket;
+        g2_point_copy_from_device(bucket, buckets[bucket_base + i - 1]);
+        g2_point_add(running, running, bucket);
+        g2_point_add(sum, sum, running);
+    }
+
+    g2_point_copy_to_device(chunk_sums[gid], sum);
+    g2_point_copy_to_device(chunk_totals[gid], running);
+}
+
+// Per-window combination of G2 chunk partial sums (one thread per window)
+kernel void MSM_KERNEL(msm_g2_window_reduce)(
+    device const JacobianPointG2* chunk_sums [[buffer(0)]],
+    device const JacobianPointG2* chunk_totals [[buffer(1)]],
+    device JacobianPointG2* window_sums [[buffer(2)]],
+    constant MSMConfig& config [[buffer(3)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    if (gid >= config.num_windows) {
+        return;
+    }
+
+    uint chunk_base = gid * config.chunks_per_window;
+
+    JacobianPointG2 window_sum;
+    g2_point_set_identity(window_sum);
+
+    for (uint c = 0; c < config.chunks_per_window; c++) {
+        JacobianPointG2 sum, total;
+        g2_point_copy_from_device(sum, chunk_sums[chunk_base + c]);
+        g2_point_copy_from_device(total, chunk_totals[chunk_base + c]);
+
+        g2_point_add(window_sum, window_sum, sum);
+
+        uint multiplier = c * config.chunk_size;
+        if (multiplier != 0 && !g2_point_is_identity(total)) {
+            JacobianPointG2 scaled;
+            g2_point_set_identity(scaled);
+            for (int bit = 31; bit >= 0; bit--) {
+                g2_point_double(scaled, scaled);
+                if ((multiplier >> bit) & 1) {
+                    g2_point_add(scaled, scaled, total);
+                }
             }
+            g2_point_add(window_sum, window_sum, scaled);
         }
     }
-    
-    // Store result
-    point_copy_to_device(result[0], acc);
+
+    g2_point_copy_to_device(window_sums[gid], window_sum);
+}
+
+// Final G2 window combination (single thread)
+kernel void MSM_KERNEL(msm_g2_final_combine)(
+    device const JacobianPointG2* window_sums [[buffer(0)]],
+    device JacobianPointG2* result [[buffer(1)]],
+    constant MSMConfig& config [[buffer(2)]],
+    uint gid [[thread_position_in_grid]]
+) {
+    if (gid != 0) {
+        return;
+    }
+
+    JacobianPointG2 acc;
+    g2_point_set_identity(acc);
+
+    for (uint w = config.num_windows; w > 0; w--) {
+        for (uint k = 0; k < config.window_size; k++) {
+            g2_point_double(acc, acc);
+        }
+        JacobianPointG2 window_sum;
+        g2_point_copy_from_device(window_sum, window_sums[w - 1]);
+        g2_point_add(acc, acc, window_sum);
+    }
+
+    g2_point_copy_to_device(result[0], acc);
 }
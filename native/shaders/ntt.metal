@@ -4,44 +4,33 @@
  *
  * Requirements: 3.7, 7.4, 7.6
  *
- * This file contains Metal compute shaders for GPU-accelerated NTT
- * using the Cooley-Tukey butterfly algorithm.
+ * Standalone copy of NTT_SHADER_SOURCE in native/src/metal_ntt.mm for
+ * offline compilation into zk_accelerate.metallib. Keep the two in sync:
+ * the runtime falls back to compiling the embedded string only when the
+ * precompiled library is missing a kernel.
+ *
+ * Twiddle factors and n^-1 arrive in Montgomery form (w * R mod p) while
+ * the data buffer stays canonical: the butterfly's Montgomery multiply
+ * cancels the R factor, montmul(w * R, v) = w * v.
  */
 
 #include <metal_stdlib>
 using namespace metal;
 
-// ============================================================================
-// Constants and Types
-// ============================================================================
-
-// Field element (256-bit for BN254)
 struct FieldElement {
     uint64_t limbs[4];
 };
 
-// NTT configuration
 struct NTTConfig {
-    uint32_t n;              // Transform size
-    uint32_t log_n;          // log2(n)
-    uint32_t stage;          // Current butterfly stage
-    uint32_t batch_size;     // Number of polynomials in batch
-    uint32_t padding[4];
-};
-
-// BN254 field modulus
-constant uint64_t BN254_MODULUS[4] = {
-    0x3C208C16D87CFD47ULL,
-    0x97816A916871CA8DULL,
-    0xB85045B68181585DULL,
-    0x30644E72E131A029ULL
+    uint32_t n;
+    uint32_t log_n;
+    uint32_t stage;
+    uint32_t batch_size;
+    uint64_t modulus[4];
+    uint64_t mu;
+    uint64_t padding;
 };
 
-// ============================================================================
-// Field Arithmetic
-// ============================================================================
-
-// Check if a >= b (constant time)
 inline bool field_gte(thread const FieldElement& a, constant const uint64_t* b) {
     for (int i = 3; i >= 0; i--) {
         if (a.limbs[i] > b[i]) return true;
@@ -50,94 +39,125 @@ inline bool field_gte(thread const FieldElement& a, constant const uint64_t* b)
     return true;
 }
 
-// Field addition: result = a + b mod p
 inline void field_add(thread FieldElement& result,
                       thread const FieldElement& a,
-                      thread const FieldElement& b) {
+                      thread const FieldElement& b,
+                      constant const uint64_t* modulus) {
     uint64_t carry = 0;
     for (uint i = 0; i < 4; i++) {
         uint64_t sum = a.limbs[i] + b.limbs[i] + carry;
         carry = (sum < a.limbs[i]) || (carry && sum == a.limbs[i]) ? 1 : 0;
         result.limbs[i] = sum;
     }
-    
-    if (carry || field_gte(result, BN254_MODULUS)) {
+
+    if (carry || field_gte(result, modulus)) {
         uint64_t borrow = 0;
         for (uint i = 0; i < 4; i++) {
-            uint64_t diff = result.limbs[i] - BN254_MODULUS[i] - borrow;
-            borrow = (diff > result.limbs[i]) ? 1 : 0;
+            uint64_t diff = result.limbs[i] - modulus[i] - borrow;
+            borrow = (diff > result.limbs[i]) || (borrow && diff == result.limbs[i]) ? 1 : 0;
             result.limbs[i] = diff;
         }
     }
 }
 
-// Field subtraction: result = a - b mod p
 inline void field_sub(thread FieldElement& result,
                       thread const FieldElement& a,
-                      thread const FieldElement& b) {
+                      thread const FieldElement& b,
+                      constant const uint64_t* modulus) {
     uint64_t borrow = 0;
     for (uint i = 0; i < 4; i++) {
         uint64_t diff = a.limbs[i] - b.limbs[i] - borrow;
-        borrow = (diff > a.limbs[i]) ? 1 : 0;
+        borrow = (diff > a.limbs[i]) || (borrow && diff == a.limbs[i]) ? 1 : 0;
         result.limbs[i] = diff;
     }
-    
+
     if (borrow) {
         uint64_t carry = 0;
         for (uint i = 0; i < 4; i++) {
-            uint64_t sum = result.limbs[i] + BN254_MODULUS[i] + carry;
-            carry = (sum < result.limbs[i]) ? 1 : 0;
+            uint64_t sum = result.limbs[i] + modulus[i] + carry;
+            carry = (sum < result.limbs[i]) || (carry && sum == result.limbs[i]) ? 1 : 0;
             result.limbs[i] = sum;
         }
     }
 }
 
-// Copy field element
-inline void field_copy(thread FieldElement& dst, thread const FieldElement& src) {
+inline void field_copy_from_device(thread FieldElement& dst, device const FieldElement& src) {
     for (uint i = 0; i < 4; i++) {
         dst.limbs[i] = src.limbs[i];
     }
 }
 
-// Copy from device to thread
-inline void field_copy_from_device(thread FieldElement& dst, device const FieldElement& src) {
+inline void field_copy_to_device(device FieldElement& dst, thread const FieldElement& src) {
     for (uint i = 0; i < 4; i++) {
         dst.limbs[i] = src.limbs[i];
     }
 }
 
-// Copy from thread to device
-inline void field_copy_to_device(device FieldElement& dst, thread const FieldElement& src) {
+// Montgomery multiplication: result = a * b * R^(-1) mod p
+// Same schoolbook-multiply-then-reduce construction as the MSM shader
+// field_mul, with mulhi() supplying the high limb; the modulus and mu
+// come from the dispatch config instead of compile-time constants.
+inline void field_mul(thread FieldElement& result,
+                      thread const FieldElement& a,
+                      thread const FieldElement& b,
+                      constant const uint64_t* modulus,
+                      uint64_t mu) {
+    uint64_t t[8];
+    for (uint i = 0; i < 8; i++) {
+        t[i] = 0;
+    }
+
     for (uint i = 0; i < 4; i++) {
-        dst.limbs[i] = src.limbs[i];
+        uint64_t carry = 0;
+        for (uint j = 0; j < 4; j++) {
+            uint64_t lo = a.limbs[i] * b.limbs[j];
+            uint64_t hi = mulhi(a.limbs[i], b.limbs[j]);
+
+            uint64_t s = t[i + j] + lo;
+            uint64_t c1 = (s < lo) ? 1 : 0;
+            uint64_t s2 = s + carry;
+            uint64_t c2 = (s2 < carry) ? 1 : 0;
+            t[i + j] = s2;
+            carry = hi + c1 + c2;
+        }
+        t[i + 4] = carry;
     }
-}
 
-// ============================================================================
-// Montgomery Multiplication (simplified for GPU)
-// ============================================================================
+    for (uint i = 0; i < 4; i++) {
+        uint64_t m = t[i] * mu;
+        uint64_t carry = 0;
+        for (uint j = 0; j < 4; j++) {
+            uint64_t lo = m * modulus[j];
+            uint64_t hi = mulhi(m, modulus[j]);
 
-// Note: Full Montgomery multiplication would be implemented here
-// For now, we use a simplified placeholder that demonstrates the structure
+            uint64_t s = t[i + j] + lo;
+            uint64_t c1 = (s < lo) ? 1 : 0;
+            uint64_t s2 = s + carry;
+            uint64_t c2 = (s2 < carry) ? 1 : 0;
+            t[i + j] = s2;
+            carry = hi + c1 + c2;
+        }
+        for (uint k = i + 4; k < 8 && carry != 0; k++) {
+            uint64_t s = t[k] + carry;
+            carry = (s < carry) ? 1 : 0;
+            t[k] = s;
+        }
+    }
 
-inline void field_mul_simple(thread FieldElement& result,
-                             thread const FieldElement& a,
-                             thread const FieldElement& b) {
-    // Placeholder: In production, implement full Montgomery multiplication
-    // For demonstration, just copy a (this is NOT correct math)
-    field_copy(result, a);
-    
-    // TODO: Implement proper Montgomery multiplication
-    // This requires:
-    // 1. Multiply a * b to get 512-bit result
-    // 2. Montgomery reduction
-}
+    for (uint i = 0; i < 4; i++) {
+        result.limbs[i] = t[i + 4];
+    }
 
-// ============================================================================
-// Bit Reversal
-// ============================================================================
+    if (field_gte(result, modulus)) {
+        uint64_t borrow = 0;
+        for (uint i = 0; i < 4; i++) {
+            uint64_t diff = result.limbs[i] - modulus[i] - borrow;
+            borrow = (diff > result.limbs[i]) || (borrow && diff == result.limbs[i]) ? 1 : 0;
+            result.limbs[i] = diff;
+        }
+    }
+}
 
-// Bit-reverse an index
 inline uint bit_reverse(uint index, uint log_n) {
     uint result = 0;
     for (uint i = 0; i < log_n; i++) {
@@ -146,16 +166,6 @@ inline uint bit_reverse(uint index, uint log_n) {
     return result;
 }
 
-// ============================================================================
-// NTT Kernels
-// ============================================================================
-
-/**
- * Bit-reversal permutation kernel
- *
- * Reorders array elements according to bit-reversed indices.
- * This is the first step of the Cooley-Tukey NTT algorithm.
- */
 kernel void ntt_bit_reverse(
     device FieldElement* data [[buffer(0)]],
     constant NTTConfig& config [[buffer(1)]],
@@ -170,7 +180,6 @@ kernel void ntt_bit_reverse(
     
     uint rev_idx = bit_reverse(elem_idx, config.log_n);
     
-    // Only swap if elem_idx < rev_idx to avoid double swapping
     if (elem_idx < rev_idx) {
         uint offset = batch_idx * config.n;
         
@@ -185,12 +194,6 @@ kernel void ntt_bit_reverse(
     }
 }
 
-/**
- * NTT butterfly kernel (single stage)
- *
- * Performs one stage of the Cooley-Tukey butterfly operations.
- * Each thread handles one butterfly operation.
- */
 kernel void ntt_butterfly(
     device FieldElement* data [[buffer(0)]],
     device const FieldElement* twiddles [[buffer(1)]],
@@ -205,10 +208,9 @@ kernel void ntt_butterfly(
     }
     
     uint stage = config.stage;
-    uint m = 1u << stage;           // 2^stage
-    uint m_half = m >> 1;           // m/2
+    uint m = 1u << stage;
+    uint m_half = m >> 1;
     
-    // Calculate indices for this butterfly
     uint group = butterfly_idx / m_half;
     uint j = butterfly_idx % m_half;
     uint k = group * m + j;
@@ -217,33 +219,24 @@ kernel void ntt_butterfly(
     uint idx1 = offset + k;
     uint idx2 = offset + k + m_half;
     
-    // Twiddle factor index
     uint twiddle_step = config.n / m;
     uint twiddle_idx = j * twiddle_step;
     
-    // Load values
     FieldElement u, v, t, twiddle;
     field_copy_from_device(u, data[idx1]);
     field_copy_from_device(v, data[idx2]);
     field_copy_from_device(twiddle, twiddles[twiddle_idx]);
-    
-    // t = twiddle * v
-    field_mul_simple(t, twiddle, v);
-    
-    // Butterfly: data[idx1] = u + t, data[idx2] = u - t
+
+    field_mul(t, twiddle, v, config.modulus, config.mu);
+
     FieldElement sum, diff;
-    field_add(sum, u, t);
-    field_sub(diff, u, t);
-    
+    field_add(sum, u, t, config.modulus);
+    field_sub(diff, u, t, config.modulus);
+
     field_copy_to_device(data[idx1], sum);
     field_copy_to_device(data[idx2], diff);
 }
 
-/**
- * Inverse NTT scaling kernel
- *
- * Multiplies all elements by n^-1 after inverse NTT.
- */
 kernel void ntt_scale(
     device FieldElement* data [[buffer(0)]],
     device const FieldElement* n_inv [[buffer(1)]],
@@ -257,79 +250,8 @@ kernel void ntt_scale(
     FieldElement elem, scale, result;
     field_copy_from_device(elem, data[gid]);
     field_copy_from_device(scale, n_inv[0]);
-    
-    field_mul_simple(result, elem, scale);
-    
-    field_copy_to_device(data[gid], result);
-}
 
-/**
- * Combined NTT kernel for small transforms
- *
- * Performs complete NTT in a single kernel launch for small sizes.
- * More efficient for n <= 1024 due to reduced kernel launch overhead.
- */
-kernel void ntt_small(
-    device FieldElement* data [[buffer(0)]],
-    device const FieldElement* twiddles [[buffer(1)]],
-    constant NTTConfig& config [[buffer(2)]],
-    uint gid [[thread_position_in_grid]],
-    uint tid [[thread_index_in_threadgroup]],
-    uint tg_size [[threads_per_threadgroup]]
-) {
-    uint batch_idx = gid / config.n;
-    uint elem_idx = gid % config.n;
-    
-    if (batch_idx >= config.batch_size) {
-        return;
-    }
-    
-    uint offset = batch_idx * config.n;
-    
-    // Bit-reversal permutation
-    uint rev_idx = bit_reverse(elem_idx, config.log_n);
-    
-    // Load element (with bit-reversal)
-    FieldElement elem;
-    field_copy_from_device(elem, data[offset + rev_idx]);
-    
-    // Threadgroup barrier to ensure all loads complete
-    threadgroup_barrier(mem_flags::mem_device);
-    
-    // Store back to original position
-    field_copy_to_device(data[offset + elem_idx], elem);
-    
-    threadgroup_barrier(mem_flags::mem_device);
-    
-    // Butterfly stages
-    for (uint s = 1; s <= config.log_n; s++) {
-        uint m = 1u << s;
-        uint m_half = m >> 1;
-        uint twiddle_step = config.n / m;
-        
-        uint group = elem_idx / m;
-        uint j = elem_idx % m;
-        
-        if (j < m_half) {
-            uint idx1 = offset + group * m + j;
-            uint idx2 = idx1 + m_half;
-            uint twiddle_idx = j * twiddle_step;
-            
-            FieldElement u, v, t, twiddle;
-            field_copy_from_device(u, data[idx1]);
-            field_copy_from_device(v, data[idx2]);
-            field_copy_from_device(twiddle, twiddles[twiddle_idx]);
-            
-            field_mul_simple(t, twiddle, v);
-            
-            FieldElement sum, diff;
-            field_add(sum, u, t);
-            field_sub(diff, u, t);
-            
-            field_copy_to_device(data[idx1], sum);
-            field_copy_to_device(data[idx2], diff);
-        }
-        
-        threadgroup_barrier(mem_flags::mem_device);
-    }
+    field_mul(result, scale, elem, config.modulus, config.mu);
+
+    field_copy_to_device(data[gid], result);
 }
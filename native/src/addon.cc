@@ -4,8 +4,14 @@
  */
 
 #include <napi.h>
+#include <chrono>
+#include <cstring>
+#include <vector>
 #include "../include/zk_accelerate.h"
 #include "../include/cpu_accelerate.h"
+#include "../include/perf_counters.h"
+#include "../include/autotune.h"
+#include "../include/arena.h"
 
 // Forward declaration for Metal capabilities update
 #ifdef __APPLE__
@@ -159,63 +165,2041 @@ Napi::Float64Array VdspVectorSub(const Napi::CallbackInfo& info) {
     return result;
 }
 
+/**
+ * Shared validation and dispatch for the in-place vDSP binary operations
+ *
+ * Writes the result into a caller-provided Float64Array instead of
+ * allocating a new one, so hot loops can reuse output storage.
+ */
+static Napi::Value VdspBinaryInto(
+    const Napi::CallbackInfo& info,
+    void (*op)(const double*, const double*, double*, size_t)
+) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3 || !info[0].IsTypedArray() || !info[1].IsTypedArray() || !info[2].IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected three Float64Array arguments: a, b, out").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+
+    Napi::Float64Array a = info[0].As<Napi::Float64Array>();
+    Napi::Float64Array b = info[1].As<Napi::Float64Array>();
+    Napi::Float64Array out = info[2].As<Napi::Float64Array>();
+
+    if (a.ElementLength() != b.ElementLength() || out.ElementLength() < a.ElementLength()) {
+        Napi::TypeError::New(env, "Array lengths must match (out may be larger)").ThrowAsJavaScriptException();
+        return env.Undefined();
+    }
+
+    op(a.Data(), b.Data(), out.Data(), a.ElementLength());
+
+    return out;
+}
+
+/**
+ * Vector addition using vDSP, writing into a caller-provided array
+ */
+Napi::Value VdspVectorAddInto(const Napi::CallbackInfo& info) {
+    return VdspBinaryInto(info, vdsp_vector_add_f64);
+}
+
+/**
+ * Vector multiplication using vDSP, writing into a caller-provided array
+ */
+Napi::Value VdspVectorMulInto(const Napi::CallbackInfo& info) {
+    return VdspBinaryInto(info, vdsp_vector_mul_f64);
+}
+
+/**
+ * Vector subtraction using vDSP, writing into a caller-provided array
+ */
+Napi::Value VdspVectorSubInto(const Napi::CallbackInfo& info) {
+    return VdspBinaryInto(info, vdsp_vector_sub_f64);
+}
+
 /**
  * BLAS matrix multiplication
  */
-Napi::Float64Array BlasMatrixMul(const Napi::CallbackInfo& info) {
+Napi::Float64Array BlasMatrixMul(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+    
+    if (info.Length() < 5) {
+        Napi::TypeError::New(env, "Expected 5 arguments: a, b, m, n, k").ThrowAsJavaScriptException();
+        return Napi::Float64Array::New(env, 0);
+    }
+    
+    if (!info[0].IsTypedArray() || !info[1].IsTypedArray()) {
+        Napi::TypeError::New(env, "First two arguments must be Float64Array").ThrowAsJavaScriptException();
+        return Napi::Float64Array::New(env, 0);
+    }
+    
+    Napi::Float64Array a = info[0].As<Napi::Float64Array>();
+    Napi::Float64Array b = info[1].As<Napi::Float64Array>();
+    int m = info[2].As<Napi::Number>().Int32Value();
+    int n = info[3].As<Napi::Number>().Int32Value();
+    int k = info[4].As<Napi::Number>().Int32Value();
+    
+    // Validate dimensions
+    if (a.ElementLength() != (size_t)(m * k) || b.ElementLength() != (size_t)(k * n)) {
+        Napi::TypeError::New(env, "Matrix dimensions don't match").ThrowAsJavaScriptException();
+        return Napi::Float64Array::New(env, 0);
+    }
+    
+    Napi::Float64Array result = Napi::Float64Array::New(env, m * n);
+    
+    // Initialize result to zero
+    memset(result.Data(), 0, m * n * sizeof(double));
+    
+    blas_matrix_mul_f64(a.Data(), b.Data(), result.Data(), m, n, k, 1.0, 0.0);
+    
+    return result;
+}
+
+/**
+ * Check if NEON is available
+ */
+Napi::Boolean NeonAvailable(const Napi::CallbackInfo& info) {
+    return Napi::Boolean::New(info.Env(), neon_available());
+}
+
+/**
+ * Check if SME is available
+ */
+Napi::Boolean SmeAvailable(const Napi::CallbackInfo& info) {
+    return Napi::Boolean::New(info.Env(), sme_available());
+}
+
+/**
+ * Batch Montgomery multiplication using NEON (synchronous)
+ */
+Napi::Value NeonBatchMontgomeryMul(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 6) {
+        Napi::TypeError::New(env, "Expected 6 arguments: a, b, modulus, mu, count, limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array a = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array b = info[1].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array modulus = info[2].As<Napi::BigUint64Array>();
+
+    bool lossless = false;
+    uint64_t mu = info[3].As<Napi::BigInt>().Uint64Value(&lossless);
+    size_t count = info[4].As<Napi::Number>().Uint32Value();
+    int limb_count = info[5].As<Napi::Number>().Int32Value();
+
+    if (a.ElementLength() < count * limb_count || b.ElementLength() < count * limb_count) {
+        Napi::TypeError::New(env, "Operand arrays too small for count * limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array result = Napi::BigUint64Array::New(env, count * limb_count);
+
+    neon_batch_montgomery_mul(a.Data(), b.Data(), modulus.Data(), mu, result.Data(), count, limb_count);
+
+    return result;
+}
+
+/**
+ * Batch Montgomery multiplication over SoA limb planes (synchronous)
+ *
+ * Operands and results are limb planes (limb j of element i at index
+ * j * count + i) rather than contiguous elements.
+ */
+Napi::Value NeonBatchMontgomeryMulSoa(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 6) {
+        Napi::TypeError::New(env, "Expected 6 arguments: a, b, modulus, mu, count, limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array a = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array b = info[1].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array modulus = info[2].As<Napi::BigUint64Array>();
+
+    bool lossless = false;
+    uint64_t mu = info[3].As<Napi::BigInt>().Uint64Value(&lossless);
+    size_t count = info[4].As<Napi::Number>().Uint32Value();
+    int limb_count = info[5].As<Napi::Number>().Int32Value();
+
+    if (a.ElementLength() < count * limb_count || b.ElementLength() < count * limb_count) {
+        Napi::TypeError::New(env, "Operand arrays too small for count * limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array result = Napi::BigUint64Array::New(env, count * limb_count);
+
+    neon_batch_montgomery_mul_soa(a.Data(), b.Data(), modulus.Data(), mu, result.Data(), count, limb_count);
+
+    return result;
+}
+
+/**
+ * Batch Fp2 Montgomery multiplication (synchronous)
+ *
+ * Elements of Fp2 = Fp[u]/(u^2 + 1) are 2 * limbCount limbs each, c0
+ * then c1; limbCount selects the base field (4 for BN254, 6 for
+ * BLS12-381).
+ */
+Napi::Value NeonBatchFp2MontgomeryMul(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 6) {
+        Napi::TypeError::New(env, "Expected 6 arguments: a, b, modulus, mu, count, limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array a = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array b = info[1].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array modulus = info[2].As<Napi::BigUint64Array>();
+
+    bool lossless = false;
+    uint64_t mu = info[3].As<Napi::BigInt>().Uint64Value(&lossless);
+    size_t count = info[4].As<Napi::Number>().Uint32Value();
+    int limb_count = info[5].As<Napi::Number>().Int32Value();
+
+    if (a.ElementLength() < count * limb_count * 2 || b.ElementLength() < count * limb_count * 2) {
+        Napi::TypeError::New(env, "Operand arrays too small for count * 2 * limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array result = Napi::BigUint64Array::New(env, count * limb_count * 2);
+
+    neon_batch_fp2_montgomery_mul(a.Data(), b.Data(), modulus.Data(), mu, result.Data(), count, limb_count);
+
+    return result;
+}
+
+/**
+ * Batch modular inversion using Montgomery's trick (synchronous)
+ */
+Napi::Value NeonBatchInverse(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 5) {
+        Napi::TypeError::New(env, "Expected 5 arguments: elements, modulus, mu, count, limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array elements = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array modulus = info[1].As<Napi::BigUint64Array>();
+
+    bool lossless = false;
+    uint64_t mu = info[2].As<Napi::BigInt>().Uint64Value(&lossless);
+    size_t count = info[3].As<Napi::Number>().Uint32Value();
+    int limb_count = info[4].As<Napi::Number>().Int32Value();
+
+    if (elements.ElementLength() < count * limb_count) {
+        Napi::TypeError::New(env, "Element array too small for count * limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array result = Napi::BigUint64Array::New(env, count * limb_count);
+
+    neon_batch_inverse(elements.Data(), modulus.Data(), mu, result.Data(), count, limb_count);
+
+    return result;
+}
+
+/**
+ * End-to-end Pippenger MSM in native code (synchronous)
+ */
+Napi::Value MsmExecute(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, scalars, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array scalars = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (points.ElementLength() < n * 8 || scalars.ElementLength() < n * 4) {
+        Napi::TypeError::New(env, "Point/scalar arrays too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array result = Napi::BigUint64Array::New(env, 12);
+
+    if (!msm_execute(points.Data(), scalars.Data(), n, result.Data())) {
+        Napi::Error::New(env, "MSM execution failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return result;
+}
+
+/**
+ * End-to-end Pippenger MSM over BLS12-381 G1 (synchronous)
+ *
+ * Same pipeline as msmExecute through the curve-generic engine: points
+ * are 12 limbs each (6-limb x, y in Montgomery form), scalars stay 4
+ * limbs, and the result is an 18-limb Jacobian point.
+ */
+Napi::Value MsmExecuteBls12381(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, scalars, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array scalars = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (points.ElementLength() < n * 12 || scalars.ElementLength() < n * 4) {
+        Napi::TypeError::New(env, "Point/scalar arrays too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array result = Napi::BigUint64Array::New(env, 18);
+
+    if (!msm_execute_bls12381(points.Data(), scalars.Data(), n, result.Data())) {
+        Napi::Error::New(env, "MSM execution failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return result;
+}
+
+/**
+ * End-to-end Pippenger MSM over BN254 G2 (synchronous)
+ *
+ * Same pipeline as msmExecute over G2 points with Fp2 coordinates:
+ * points are 16 limbs each (x.c0, x.c1, y.c0, y.c1 in Montgomery form),
+ * scalars stay 4 limbs, and the result is a 24-limb Jacobian point.
+ */
+Napi::Value MsmExecuteG2(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, scalars, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array scalars = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (points.ElementLength() < n * 16 || scalars.ElementLength() < n * 4) {
+        Napi::TypeError::New(env, "Point/scalar arrays too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array result = Napi::BigUint64Array::New(env, 24);
+
+    if (!msm_execute_g2(points.Data(), scalars.Data(), n, result.Data())) {
+        Napi::Error::New(env, "MSM execution failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return result;
+}
+
+/**
+ * Signed-digit scalar recoding and bucket entry generation (synchronous)
+ *
+ * Entries are returned as a Uint32Array of packed MsmBucketEntry structs
+ * (pointIndex, bucketIndex, windowIndex, sign per entry), window-major
+ * with window w starting at entry w * n; counts[w] gives the number of
+ * populated entries in window w.
+ */
+Napi::Value MsmRecodeScalars(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: scalars, n, windowSize").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array scalars = info[0].As<Napi::BigUint64Array>();
+    size_t n = info[1].As<Napi::Number>().Uint32Value();
+    int window_size = info[2].As<Napi::Number>().Int32Value();
+
+    int num_windows = msm_signed_num_windows(window_size);
+    if (num_windows == 0) {
+        Napi::TypeError::New(env, "Window size must be between 2 and 16").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (scalars.ElementLength() < n * 4) {
+        Napi::TypeError::New(env, "Scalar array too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Uint32Array entries = Napi::Uint32Array::New(env, n * (size_t)num_windows * 4);
+    Napi::Uint32Array counts = Napi::Uint32Array::New(env, num_windows);
+
+    if (!msm_recode_scalars(scalars.Data(), n, window_size,
+                            (MsmBucketEntry*)entries.Data(), counts.Data())) {
+        Napi::Error::New(env, "Scalar recoding failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("numWindows", Napi::Number::New(env, num_windows));
+    result.Set("entries", entries);
+    result.Set("counts", counts);
+    return result;
+}
+
+// ============================================================================
+// Async Execution (Promise-based)
+// ============================================================================
+
+/**
+ * Base worker that resolves a JS promise when a native kernel completes.
+ *
+ * Heavy kernels (MSM, NTT, batch Montgomery multiplication) run on the
+ * libuv thread pool so the Node event loop stays responsive while the
+ * CPU or GPU is busy.
+ */
+class PromiseWorker : public Napi::AsyncWorker {
+public:
+    explicit PromiseWorker(Napi::Env env)
+        : Napi::AsyncWorker(env), deferred_(Napi::Promise::Deferred::New(env)) {}
+
+    Napi::Promise GetPromise() { return deferred_.Promise(); }
+
+protected:
+    void OnError(const Napi::Error& error) override {
+        deferred_.Reject(error.Value());
+    }
+
+    Napi::Promise::Deferred deferred_;
+};
+
+/**
+ * Async worker for batch Montgomery multiplication
+ *
+ * Input arrays are pinned via persistent references for the duration of
+ * the computation, so no copies are made on the way in.
+ */
+class BatchMontgomeryMulWorker : public PromiseWorker {
+public:
+    BatchMontgomeryMulWorker(
+        Napi::Env env,
+        Napi::BigUint64Array a,
+        Napi::BigUint64Array b,
+        Napi::BigUint64Array modulus,
+        uint64_t mu,
+        size_t count,
+        int limb_count
+    ) : PromiseWorker(env),
+        a_ref_(Napi::Persistent(a)),
+        b_ref_(Napi::Persistent(b)),
+        modulus_ref_(Napi::Persistent(modulus)),
+        a_(a.Data()),
+        b_(b.Data()),
+        modulus_(modulus.Data()),
+        mu_(mu),
+        count_(count),
+        limb_count_(limb_count),
+        results_(count * limb_count) {}
+
+    void Execute() override {
+        // Backend is chosen internally: the SME matrix engine on parts
+        // that have it, the NEON kernel everywhere else
+        auto start = std::chrono::steady_clock::now();
+        bool used_sme = sme_batch_montgomery_mul(a_, b_, modulus_, mu_, results_.data(), count_, limb_count_);
+        auto end = std::chrono::steady_clock::now();
+        perf_counters_record(used_sme ? "sme_batch_montgomery_mul" : "neon_batch_montgomery_mul",
+                             std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::BigUint64Array out = Napi::BigUint64Array::New(env, results_.size());
+        memcpy(out.Data(), results_.data(), results_.size() * sizeof(uint64_t));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::Reference<Napi::BigUint64Array> a_ref_;
+    Napi::Reference<Napi::BigUint64Array> b_ref_;
+    Napi::Reference<Napi::BigUint64Array> modulus_ref_;
+    const uint64_t* a_;
+    const uint64_t* b_;
+    const uint64_t* modulus_;
+    uint64_t mu_;
+    size_t count_;
+    int limb_count_;
+    std::vector<uint64_t> results_;
+};
+
+/**
+ * Async worker for the end-to-end native MSM
+ */
+class MsmExecuteWorker : public PromiseWorker {
+public:
+    MsmExecuteWorker(
+        Napi::Env env,
+        Napi::BigUint64Array points,
+        Napi::BigUint64Array scalars,
+        size_t n
+    ) : PromiseWorker(env),
+        points_ref_(Napi::Persistent(points)),
+        scalars_ref_(Napi::Persistent(scalars)),
+        points_(points.Data()),
+        scalars_(scalars.Data()),
+        n_(n) {}
+
+    void Execute() override {
+        if (!msm_execute(points_, scalars_, n_, result_)) {
+            SetError("MSM execution failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::BigUint64Array out = Napi::BigUint64Array::New(env, 12);
+        memcpy(out.Data(), result_, sizeof(result_));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::Reference<Napi::BigUint64Array> points_ref_;
+    Napi::Reference<Napi::BigUint64Array> scalars_ref_;
+    const uint64_t* points_;
+    const uint64_t* scalars_;
+    size_t n_;
+    uint64_t result_[12];
+};
+
+/**
+ * End-to-end Pippenger MSM, promise-returning
+ */
+Napi::Value MsmExecuteAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, scalars, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array scalars = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (points.ElementLength() < n * 8 || scalars.ElementLength() < n * 4) {
+        Napi::TypeError::New(env, "Point/scalar arrays too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmExecuteWorker* worker = new MsmExecuteWorker(env, points, scalars, n);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Async worker for the BLS12-381 MSM
+ */
+class MsmExecuteBls12381Worker : public PromiseWorker {
+public:
+    MsmExecuteBls12381Worker(
+        Napi::Env env,
+        Napi::BigUint64Array points,
+        Napi::BigUint64Array scalars,
+        size_t n
+    ) : PromiseWorker(env),
+        points_ref_(Napi::Persistent(points)),
+        scalars_ref_(Napi::Persistent(scalars)),
+        points_(points.Data()),
+        scalars_(scalars.Data()),
+        n_(n) {}
+
+    void Execute() override {
+        if (!msm_execute_bls12381(points_, scalars_, n_, result_)) {
+            SetError("MSM execution failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::BigUint64Array out = Napi::BigUint64Array::New(env, 18);
+        memcpy(out.Data(), result_, sizeof(result_));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::Reference<Napi::BigUint64Array> points_ref_;
+    Napi::Reference<Napi::BigUint64Array> scalars_ref_;
+    const uint64_t* points_;
+    const uint64_t* scalars_;
+    size_t n_;
+    uint64_t result_[18];
+};
+
+/**
+ * BLS12-381 Pippenger MSM, promise-returning
+ */
+Napi::Value MsmExecuteBls12381Async(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, scalars, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array scalars = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (points.ElementLength() < n * 12 || scalars.ElementLength() < n * 4) {
+        Napi::TypeError::New(env, "Point/scalar arrays too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmExecuteBls12381Worker* worker = new MsmExecuteBls12381Worker(env, points, scalars, n);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Async worker for the G2 MSM
+ */
+class MsmExecuteG2Worker : public PromiseWorker {
+public:
+    MsmExecuteG2Worker(
+        Napi::Env env,
+        Napi::BigUint64Array points,
+        Napi::BigUint64Array scalars,
+        size_t n
+    ) : PromiseWorker(env),
+        points_ref_(Napi::Persistent(points)),
+        scalars_ref_(Napi::Persistent(scalars)),
+        points_(points.Data()),
+        scalars_(scalars.Data()),
+        n_(n) {}
+
+    void Execute() override {
+        if (!msm_execute_g2(points_, scalars_, n_, result_)) {
+            SetError("MSM execution failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::BigUint64Array out = Napi::BigUint64Array::New(env, 24);
+        memcpy(out.Data(), result_, sizeof(result_));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::Reference<Napi::BigUint64Array> points_ref_;
+    Napi::Reference<Napi::BigUint64Array> scalars_ref_;
+    const uint64_t* points_;
+    const uint64_t* scalars_;
+    size_t n_;
+    uint64_t result_[24];
+};
+
+/**
+ * BN254 G2 Pippenger MSM, promise-returning
+ */
+Napi::Value MsmExecuteG2Async(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, scalars, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array scalars = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (points.ElementLength() < n * 16 || scalars.ElementLength() < n * 4) {
+        Napi::TypeError::New(env, "Point/scalar arrays too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmExecuteG2Worker* worker = new MsmExecuteG2Worker(env, points, scalars, n);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Async worker for autotuner warmup
+ *
+ * The micro-benchmarks take on the order of a second, so warmup runs on
+ * the thread pool like the other heavy kernels.
+ */
+class AutotuneWarmupWorker : public PromiseWorker {
+public:
+    explicit AutotuneWarmupWorker(Napi::Env env) : PromiseWorker(env) {}
+
+    void Execute() override {
+        if (!autotune_warmup()) {
+            SetError("Autotune warmup failed");
+        }
+    }
+
+    void OnOK() override {
+        deferred_.Resolve(Napi::Boolean::New(Env(), true));
+    }
+};
+
+/**
+ * Run the autotuner micro-benchmarks, promise-returning
+ */
+Napi::Value AutotuneWarmup(const Napi::CallbackInfo& info) {
+    AutotuneWarmupWorker* worker = new AutotuneWarmupWorker(info.Env());
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Get the active autotune profile, or null when none exists
+ */
+Napi::Value AutotuneGetProfile(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    const AutotuneProfile* profile = autotune_get_profile();
+    if (profile == nullptr) {
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("fingerprint", Napi::String::New(env, profile->fingerprint));
+    result.Set("msmGpuCrossover", profile->msm_gpu_crossover == UINT64_MAX
+        ? env.Null().As<Napi::Value>()
+        : Napi::Number::New(env, (double)profile->msm_gpu_crossover).As<Napi::Value>());
+
+    Napi::Array windows = Napi::Array::New(env, AUTOTUNE_MAX_BRACKETS);
+    for (uint32_t i = 0; i < AUTOTUNE_MAX_BRACKETS; i++) {
+        windows.Set(i, Napi::Number::New(env, profile->msm_window_size[i]));
+    }
+    result.Set("msmWindowSizes", windows);
+
+    result.Set("neonMulNsPerOp", Napi::Number::New(env, profile->neon_mul_ns_per_op));
+    result.Set("blasGflops", Napi::Number::New(env, profile->blas_gflops));
+    result.Set("gpuMsmBaseMs", Napi::Number::New(env, profile->gpu_msm_base_ms));
+
+    return result;
+}
+
+/**
+ * Batch Montgomery multiplication, promise-returning
+ */
+Napi::Value NeonBatchMontgomeryMulAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 6) {
+        Napi::TypeError::New(env, "Expected 6 arguments: a, b, modulus, mu, count, limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array a = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array b = info[1].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array modulus = info[2].As<Napi::BigUint64Array>();
+
+    bool lossless = false;
+    uint64_t mu = info[3].As<Napi::BigInt>().Uint64Value(&lossless);
+    size_t count = info[4].As<Napi::Number>().Uint32Value();
+    int limb_count = info[5].As<Napi::Number>().Int32Value();
+
+    if (a.ElementLength() < count * limb_count || b.ElementLength() < count * limb_count) {
+        Napi::TypeError::New(env, "Operand arrays too small for count * limbCount").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    BatchMontgomeryMulWorker* worker = new BatchMontgomeryMulWorker(env, a, b, modulus, mu, count, limb_count);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+// ============================================================================
+// Proof session arena
+// ============================================================================
+
+/**
+ * Extract the native ArenaAllocator pointer from a JS arena handle
+ */
+static ArenaAllocator* GetNativeArena(Napi::Object arenaObj) {
+    if (!arenaObj.Has("_nativePtr")) {
+        return nullptr;
+    }
+    return arenaObj.Get("_nativePtr").As<Napi::External<ArenaAllocator>>().Data();
+}
+
+/**
+ * Create a proof session arena
+ *
+ * Optional argument: slab size in bytes (0 or omitted uses the
+ * ZK_ACCELERATE_ARENA_SLAB default).
+ */
+Napi::Value ArenaCreate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    size_t slab_bytes = 0;
+    if (info.Length() >= 1 && info[0].IsNumber()) {
+        slab_bytes = (size_t)info[0].As<Napi::Number>().Int64Value();
+    }
+
+    ArenaAllocator* arena = arena_create(slab_bytes);
+    if (arena == nullptr) {
+        Napi::Error::New(env, "Failed to reserve arena slab").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("_nativePtr", Napi::External<ArenaAllocator>::New(env, arena));
+    return result;
+}
+
+/**
+ * Install (or with null, uninstall) the session arena that native
+ * kernels draw scratch memory from
+ */
+Napi::Value ArenaInstall(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || info[0].IsNull() || info[0].IsUndefined()) {
+        arena_install(nullptr);
+        return Napi::Boolean::New(env, true);
+    }
+
+    ArenaAllocator* arena = GetNativeArena(info[0].As<Napi::Object>());
+    if (arena == nullptr) {
+        Napi::TypeError::New(env, "Invalid arena object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    arena_install(arena);
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Release every arena allocation at once (proof end)
+ */
+Napi::Value ArenaReset(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected an arena object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ArenaAllocator* arena = GetNativeArena(info[0].As<Napi::Object>());
+    if (arena == nullptr) {
+        Napi::TypeError::New(env, "Invalid arena object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    arena_reset(arena);
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Destroy an arena and free its slabs
+ */
+Napi::Value ArenaDestroy(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected an arena object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object arenaObj = info[0].As<Napi::Object>();
+    ArenaAllocator* arena = GetNativeArena(arenaObj);
+    if (arena == nullptr) {
+        Napi::TypeError::New(env, "Invalid arena object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    arena_destroy(arena);
+    arenaObj.Delete("_nativePtr");
+    return env.Undefined();
+}
+
+/**
+ * Read an arena's usage counters (peakBytes sizes slabs per circuit)
+ */
+Napi::Value ArenaGetStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected an arena object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ArenaAllocator* arena = GetNativeArena(info[0].As<Napi::Object>());
+    if (arena == nullptr) {
+        Napi::TypeError::New(env, "Invalid arena object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    ArenaStats stats = arena_get_stats(arena);
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("reservedBytes", Napi::Number::New(env, (double)stats.reserved_bytes));
+    result.Set("usedBytes", Napi::Number::New(env, (double)stats.used_bytes));
+    result.Set("peakBytes", Napi::Number::New(env, (double)stats.peak_bytes));
+    result.Set("slabCount", Napi::Number::New(env, stats.slab_count));
+    result.Set("resets", Napi::Number::New(env, stats.resets));
+    return result;
+}
+
+// ============================================================================
+// Incremental MSM
+// ============================================================================
+
+/**
+ * Extract the native MsmIncremental pointer from a JS handle
+ */
+static MsmIncremental* GetNativeIncremental(Napi::Object incObj) {
+    if (!incObj.Has("_nativePtr")) {
+        return nullptr;
+    }
+    return incObj.Get("_nativePtr").As<Napi::External<MsmIncremental>>().Data();
+}
+
+/**
+ * Create incremental MSM state over a fixed point set
+ *
+ * Arguments: points, scalars (or null for the all-zero vector), n,
+ * optional windowSize. The native state borrows the points buffer, so
+ * the handle keeps a reference to the typed array (an SRS points view
+ * works directly); the bulk load from scalars runs synchronously.
+ */
+Napi::Value MsmIncrementalCreate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, scalars, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    const uint64_t* scalars_data = nullptr;
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+    int window_size = 0;
+    if (info.Length() >= 4 && info[3].IsNumber()) {
+        window_size = info[3].As<Napi::Number>().Int32Value();
+    }
+
+    if (points.ElementLength() < n * 8) {
+        Napi::TypeError::New(env, "Point array too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!info[1].IsNull() && !info[1].IsUndefined()) {
+        Napi::BigUint64Array scalars = info[1].As<Napi::BigUint64Array>();
+        if (scalars.ElementLength() < n * 4) {
+            Napi::TypeError::New(env, "Scalar array too small for n").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        scalars_data = scalars.Data();
+    }
+
+    MsmIncremental* inc = msm_incremental_create(points.Data(), scalars_data, n, window_size);
+    if (inc == nullptr) {
+        Napi::Error::New(env, "Failed to create incremental MSM state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("n", Napi::Number::New(env, (double)n));
+    result.Set("_nativePtr", Napi::External<MsmIncremental>::New(env, inc));
+    // The native state borrows the points buffer; holding the typed
+    // array on the handle keeps it alive for the state's lifetime
+    result.Set("_points", points);
+    return result;
+}
+
+/**
+ * Apply one scalar delta: scalar[index] goes from oldScalar to newScalar
+ */
+Napi::Value MsmIncrementalUpdate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 4) {
+        Napi::TypeError::New(env, "Expected 4 arguments: state, index, oldScalar, newScalar").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmIncremental* inc = GetNativeIncremental(info[0].As<Napi::Object>());
+    if (inc == nullptr) {
+        Napi::TypeError::New(env, "Invalid incremental MSM state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    size_t index = info[1].As<Napi::Number>().Uint32Value();
+    Napi::BigUint64Array old_scalar = info[2].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array new_scalar = info[3].As<Napi::BigUint64Array>();
+
+    if (old_scalar.ElementLength() < 4 || new_scalar.ElementLength() < 4) {
+        Napi::TypeError::New(env, "Scalars must have 4 limbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    if (!msm_incremental_update(inc, index, old_scalar.Data(), new_scalar.Data())) {
+        Napi::Error::New(env, "Incremental MSM update failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return Napi::Boolean::New(env, true);
+}
+
+/**
+ * Produce the current commitment, re-reducing only dirty bucket chunks
+ */
+Napi::Value MsmIncrementalCommit(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmIncremental* inc = GetNativeIncremental(info[0].As<Napi::Object>());
+    if (inc == nullptr) {
+        Napi::TypeError::New(env, "Invalid incremental MSM state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    uint64_t result[12];
+    if (!msm_incremental_commit(inc, result)) {
+        Napi::Error::New(env, "Incremental MSM commit failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array out = Napi::BigUint64Array::New(env, 12);
+    memcpy(out.Data(), result, sizeof(result));
+    return out;
+}
+
+/**
+ * Async worker for the incremental MSM commit
+ *
+ * The state handle is pinned for the duration; the caller must not
+ * update the state while a commit is in flight (the object is not
+ * thread-safe).
+ */
+class MsmIncrementalCommitWorker : public PromiseWorker {
+public:
+    MsmIncrementalCommitWorker(Napi::Env env, Napi::Object inc_obj)
+        : PromiseWorker(env),
+          inc_ref_(Napi::Persistent(inc_obj)),
+          inc_(GetNativeIncremental(inc_obj)) {}
+
+    void Execute() override {
+        if (!msm_incremental_commit(inc_, result_)) {
+            SetError("Incremental MSM commit failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::BigUint64Array out = Napi::BigUint64Array::New(env, 12);
+        memcpy(out.Data(), result_, sizeof(result_));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::ObjectReference inc_ref_;
+    MsmIncremental* inc_;
+    uint64_t result_[12];
+};
+
+/**
+ * Incremental MSM commit, promise-returning
+ */
+Napi::Value MsmIncrementalCommitAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object inc_obj = info[0].As<Napi::Object>();
+    if (GetNativeIncremental(inc_obj) == nullptr) {
+        Napi::TypeError::New(env, "Invalid incremental MSM state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmIncrementalCommitWorker* worker = new MsmIncrementalCommitWorker(env, inc_obj);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Serialize the bucket state for restart
+ */
+Napi::Value MsmIncrementalSerialize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmIncremental* inc = GetNativeIncremental(info[0].As<Napi::Object>());
+    if (inc == nullptr) {
+        Napi::TypeError::New(env, "Invalid incremental MSM state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    size_t size = msm_incremental_serialize_size(inc);
+    Napi::Uint8Array out = Napi::Uint8Array::New(env, size);
+    if (!msm_incremental_serialize(inc, out.Data(), size)) {
+        Napi::Error::New(env, "Incremental MSM serialization failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return out;
+}
+
+/**
+ * Restore incremental MSM state from a serialized blob
+ *
+ * Arguments: points, n, data. points and n must match the state the
+ * blob was serialized from.
+ */
+Napi::Value MsmIncrementalDeserialize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: points, n, data").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array points = info[0].As<Napi::BigUint64Array>();
+    size_t n = info[1].As<Napi::Number>().Uint32Value();
+    Napi::Uint8Array data = info[2].As<Napi::Uint8Array>();
+
+    if (points.ElementLength() < n * 8) {
+        Napi::TypeError::New(env, "Point array too small for n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MsmIncremental* inc = msm_incremental_deserialize(points.Data(), n, data.Data(), data.ElementLength());
+    if (inc == nullptr) {
+        Napi::Error::New(env, "Invalid or mismatched incremental MSM blob").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("n", Napi::Number::New(env, (double)n));
+    result.Set("_nativePtr", Napi::External<MsmIncremental>::New(env, inc));
+    result.Set("_points", points);
+    return result;
+}
+
+/**
+ * Destroy incremental MSM state
+ */
+Napi::Value MsmIncrementalDestroy(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object inc_obj = info[0].As<Napi::Object>();
+    MsmIncremental* inc = GetNativeIncremental(inc_obj);
+    if (inc == nullptr) {
+        Napi::TypeError::New(env, "Invalid incremental MSM state").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    msm_incremental_destroy(inc);
+    inc_obj.Delete("_nativePtr");
+    inc_obj.Delete("_points");
+    return env.Undefined();
+}
+
+// ============================================================================
+// Fixed-base scalar multiplication
+// ============================================================================
+
+/**
+ * Extract the native FixedBaseTable pointer from a JS handle
+ */
+static FixedBaseTable* GetNativeFixedBase(Napi::Object tableObj) {
+    if (!tableObj.Has("_nativePtr")) {
+        return nullptr;
+    }
+    return tableObj.Get("_nativePtr").As<Napi::External<FixedBaseTable>>().Data();
+}
+
+/**
+ * Build a fixed-base table for one point
+ *
+ * Arguments: point (8 limbs), optional windowSize (default 8). The
+ * table copies the precomputed multiples, so the input array need not
+ * outlive the handle.
+ */
+Napi::Value FixedBaseTableCreate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: point").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array point = info[0].As<Napi::BigUint64Array>();
+    if (point.ElementLength() < 8) {
+        Napi::TypeError::New(env, "Point must have 8 limbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    int window_size = 8;
+    if (info.Length() >= 2 && info[1].IsNumber()) {
+        window_size = info[1].As<Napi::Number>().Int32Value();
+    }
+
+    FixedBaseTable* table = fixed_base_table_create(point.Data(), window_size);
+    if (table == nullptr) {
+        Napi::Error::New(env, "Failed to create fixed-base table").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("windowSize", Napi::Number::New(env, window_size));
+    result.Set("_nativePtr", Napi::External<FixedBaseTable>::New(env, table));
+    return result;
+}
+
+/**
+ * Multiply the table's base point by a scalar
+ */
+Napi::Value FixedBaseMul(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 2) {
+        Napi::TypeError::New(env, "Expected 2 arguments: table, scalar").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    FixedBaseTable* table = GetNativeFixedBase(info[0].As<Napi::Object>());
+    if (table == nullptr) {
+        Napi::TypeError::New(env, "Invalid fixed-base table").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array scalar = info[1].As<Napi::BigUint64Array>();
+    if (scalar.ElementLength() < 4) {
+        Napi::TypeError::New(env, "Scalar must have 4 limbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    uint64_t result[12];
+    if (!fixed_base_mul(table, scalar.Data(), result)) {
+        Napi::Error::New(env, "Fixed-base multiplication failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array out = Napi::BigUint64Array::New(env, 12);
+    memcpy(out.Data(), result, sizeof(result));
+    return out;
+}
+
+/**
+ * Serialize a fixed-base table for reuse across processes
+ */
+Napi::Value FixedBaseTableSerialize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: table").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    FixedBaseTable* table = GetNativeFixedBase(info[0].As<Napi::Object>());
+    if (table == nullptr) {
+        Napi::TypeError::New(env, "Invalid fixed-base table").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    size_t size = fixed_base_table_serialize_size(table);
+    Napi::Uint8Array out = Napi::Uint8Array::New(env, size);
+    if (!fixed_base_table_serialize(table, out.Data(), size)) {
+        Napi::Error::New(env, "Fixed-base table serialization failed").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    return out;
+}
+
+/**
+ * Restore a fixed-base table from a serialized blob
+ */
+Napi::Value FixedBaseTableDeserialize(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1) {
+        Napi::TypeError::New(env, "Expected 1 argument: data").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Uint8Array data = info[0].As<Napi::Uint8Array>();
+    FixedBaseTable* table = fixed_base_table_deserialize(data.Data(), data.ElementLength());
+    if (table == nullptr) {
+        Napi::Error::New(env, "Invalid fixed-base table blob").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("_nativePtr", Napi::External<FixedBaseTable>::New(env, table));
+    return result;
+}
+
+/**
+ * Destroy a fixed-base table
+ */
+Napi::Value FixedBaseTableDestroy(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: table").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object table_obj = info[0].As<Napi::Object>();
+    FixedBaseTable* table = GetNativeFixedBase(table_obj);
+    if (table == nullptr) {
+        Napi::TypeError::New(env, "Invalid fixed-base table").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    fixed_base_table_destroy(table);
+    table_obj.Delete("_nativePtr");
+    return env.Undefined();
+}
+
+// ============================================================================
+// CPU NTT engine
+// ============================================================================
+
+/**
+ * Create (or fetch from cache) a CPU NTT plan for a (modulus, root, n) triple
+ *
+ * Same argument shape as nttPlanCreate; the returned plan carries
+ * CPU-resident twiddle tables instead of GPU buffers and works without
+ * a Metal device.
+ */
+Napi::Value NttCpuPlanCreate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: modulus, rootOfUnity, n").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array modulus = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array root = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (modulus.ElementLength() < 4 || root.ElementLength() < 4) {
+        Napi::TypeError::New(env, "modulus and rootOfUnity must have 4 limbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    NttCpuPlan* plan = ntt_cpu_plan_create(modulus.Data(), root.Data(), n);
+    if (plan == nullptr) {
+        Napi::Error::New(env, "Failed to create CPU NTT plan").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("n", Napi::Number::New(env, (double)n));
+    result.Set("_nativePtr", Napi::External<NttCpuPlan>::New(env, plan));
+    return result;
+}
+
+/**
+ * Async worker for the CPU NTT
+ *
+ * The transform runs in place on a private copy so the caller's array
+ * is untouched, matching the other batch CPU kernels.
+ */
+class NttCpuExecuteWorker : public PromiseWorker {
+public:
+    NttCpuExecuteWorker(
+        Napi::Env env,
+        Napi::Object plan_obj,
+        Napi::BigUint64Array data,
+        bool forward
+    ) : PromiseWorker(env),
+        plan_ref_(Napi::Persistent(plan_obj)),
+        plan_(plan_obj.Get("_nativePtr").As<Napi::External<NttCpuPlan>>().Data()),
+        data_(data.Data(), data.Data() + data.ElementLength()),
+        forward_(forward) {}
+
+    void Execute() override {
+        if (!ntt_cpu_execute(plan_, data_.data(), forward_)) {
+            SetError("CPU NTT execution failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::BigUint64Array out = Napi::BigUint64Array::New(env, data_.size());
+        memcpy(out.Data(), data_.data(), data_.size() * sizeof(uint64_t));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::ObjectReference plan_ref_;
+    NttCpuPlan* plan_;
+    std::vector<uint64_t> data_;
+    bool forward_;
+};
+
+/**
+ * Execute a CPU NTT using a plan's twiddle tables, promise-returning
+ */
+Napi::Value NttCpuExecuteAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: plan, data, forward").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object plan_obj = info[0].As<Napi::Object>();
+    Napi::BigUint64Array data = info[1].As<Napi::BigUint64Array>();
+    bool forward = info[2].As<Napi::Boolean>().Value();
+
+    if (!plan_obj.Has("_nativePtr")) {
+        Napi::TypeError::New(env, "Invalid plan object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    if (!plan_obj.Has("n") || data.ElementLength() < plan_obj.Get("n").As<Napi::Number>().Uint32Value() * 4) {
+        Napi::TypeError::New(env, "Data array too small for the plan size").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    NttCpuExecuteWorker* worker = new NttCpuExecuteWorker(env, plan_obj, data, forward);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+// ============================================================================
+// Memory-mapped SRS
+// ============================================================================
+
+/**
+ * Extract the native SrsMapping pointer from a JS SRS handle
+ */
+static SrsMapping* GetSrsMapping(Napi::Object srsObj) {
+    if (!srsObj.Has("_nativePtr")) {
+        return nullptr;
+    }
+    return srsObj.Get("_nativePtr").As<Napi::External<SrsMapping>>().Data();
+}
+
+/**
+ * Map an SRS file and expose zero-copy limb views
+ *
+ * The returned points/scalars typed arrays alias the mapping — no copy
+ * into JS heap memory is made — and become invalid after srsClose.
+ */
+Napi::Value SrsOpen(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsString()) {
+        Napi::TypeError::New(env, "Expected 1 argument: path").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string path = info[0].As<Napi::String>().Utf8Value();
+    SrsMapping* srs = srs_open(path.c_str());
+    if (srs == nullptr) {
+        Napi::Error::New(env, "Failed to open SRS file").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("_nativePtr", Napi::External<SrsMapping>::New(env, srs));
+    result.Set("numPoints", Napi::Number::New(env, (double)srs->num_points));
+    result.Set("numScalars", Napi::Number::New(env, (double)srs->num_scalars));
+    result.Set("pointLimbs", Napi::Number::New(env, srs->point_limbs));
+    result.Set("scalarLimbs", Napi::Number::New(env, srs->scalar_limbs));
+    result.Set("flags", Napi::Number::New(env, srs->flags));
+
+    size_t points_elems = (size_t)(srs->num_points * srs->point_limbs);
+    Napi::ArrayBuffer points_ab = Napi::ArrayBuffer::New(
+        env, (void*)srs->points, points_elems * sizeof(uint64_t));
+    result.Set("points", Napi::BigUint64Array::New(env, points_elems, points_ab, 0));
+
+    if (srs->scalars != nullptr) {
+        size_t scalars_elems = (size_t)(srs->num_scalars * srs->scalar_limbs);
+        Napi::ArrayBuffer scalars_ab = Napi::ArrayBuffer::New(
+            env, (void*)srs->scalars, scalars_elems * sizeof(uint64_t));
+        result.Set("scalars", Napi::BigUint64Array::New(env, scalars_elems, scalars_ab, 0));
+    }
+
+    return result;
+}
+
+/**
+ * Unmap an SRS (its limb views become invalid)
+ */
+Napi::Value SrsClose(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: srs handle").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object srs_obj = info[0].As<Napi::Object>();
+    SrsMapping* srs = GetSrsMapping(srs_obj);
+    if (srs == nullptr) {
+        Napi::TypeError::New(env, "Invalid SRS handle").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    srs_close(srs);
+    // Drop the stale external so a second close cannot replay the freed
+    // mapping, and the views that alias the now-unmapped memory with it
+    srs_obj.Delete("_nativePtr");
+    srs_obj.Delete("points");
+    srs_obj.Delete("scalars");
+    return env.Undefined();
+}
+
+/**
+ * Prefetch a point range ahead of a sequential window pass
+ */
+Napi::Value SrsPrefetch(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: srs handle, startPoint, count").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    SrsMapping* srs = GetSrsMapping(info[0].As<Napi::Object>());
+    uint64_t start_point = (uint64_t)info[1].As<Napi::Number>().DoubleValue();
+    uint64_t count = (uint64_t)info[2].As<Napi::Number>().DoubleValue();
+
+    return Napi::Boolean::New(env, srs_prefetch(srs, start_point, count));
+}
+
+/**
+ * Write an SRS file (offline pre-conversion)
+ */
+Napi::Value SrsWrite(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected at least 3 arguments: path, points, pointLimbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    std::string path = info[0].As<Napi::String>().Utf8Value();
+    Napi::BigUint64Array points = info[1].As<Napi::BigUint64Array>();
+    uint32_t point_limbs = info[2].As<Napi::Number>().Uint32Value();
+
+    const uint64_t* scalars = nullptr;
+    uint64_t num_scalars = 0;
+    uint32_t scalar_limbs = 0;
+    if (info.Length() > 4 && info[3].IsTypedArray()) {
+        Napi::BigUint64Array scalars_arr = info[3].As<Napi::BigUint64Array>();
+        scalar_limbs = info[4].As<Napi::Number>().Uint32Value();
+        if (scalar_limbs == 0) {
+            Napi::TypeError::New(env, "scalarLimbs must be non-zero").ThrowAsJavaScriptException();
+            return env.Null();
+        }
+        scalars = scalars_arr.Data();
+        num_scalars = scalars_arr.ElementLength() / scalar_limbs;
+    }
+
+    uint32_t flags = info.Length() > 5 ? info[5].As<Napi::Number>().Uint32Value() : 0;
+
+    if (point_limbs == 0 || points.ElementLength() % point_limbs != 0) {
+        Napi::TypeError::New(env, "Point array length must be a multiple of pointLimbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+    uint64_t num_points = points.ElementLength() / point_limbs;
+
+    bool ok = srs_write(path.c_str(), points.Data(), num_points, point_limbs,
+                        scalars, num_scalars, scalar_limbs, flags);
+    return Napi::Boolean::New(env, ok);
+}
+
+// ============================================================================
+// Metal GPU Functions
+// ============================================================================
+
+#ifdef __APPLE__
+
+/**
+ * Extract the native GPUBuffer pointer from a JS buffer object
+ */
+static GPUBuffer* GetNativeBuffer(Napi::Object bufferObj) {
+    if (!bufferObj.Has("_nativePtr")) {
+        return nullptr;
+    }
+    Napi::External<GPUBuffer> external = bufferObj.Get("_nativePtr").As<Napi::External<GPUBuffer>>();
+    return external.Data();
+}
+
+/**
+ * Async worker for GPU MSM execution
+ *
+ * The GPU buffer wrapper objects are pinned via persistent references so
+ * the underlying MTLBuffers cannot be freed mid-dispatch.
+ */
+class MetalMsmWorker : public PromiseWorker {
+public:
+    MetalMsmWorker(
+        Napi::Env env,
+        Napi::Object scalars_obj,
+        Napi::Object points_obj,
+        Napi::Object result_obj,
+        size_t num_points,
+        int window_size
+    ) : PromiseWorker(env),
+        scalars_ref_(Napi::Persistent(scalars_obj)),
+        points_ref_(Napi::Persistent(points_obj)),
+        result_ref_(Napi::Persistent(result_obj)),
+        scalars_(GetNativeBuffer(scalars_obj)),
+        points_(GetNativeBuffer(points_obj)),
+        result_buffer_(GetNativeBuffer(result_obj)),
+        num_points_(num_points),
+        window_size_(window_size),
+        gpu_result_{false, nullptr, 0.0} {}
+
+    void Execute() override {
+        gpu_result_ = metal_gpu_msm(scalars_, points_, result_buffer_, num_points_, window_size_);
+        if (!gpu_result_.success) {
+            SetError(gpu_result_.error_message != nullptr ? gpu_result_.error_message : "MSM dispatch failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Object out = Napi::Object::New(env);
+        out.Set("success", Napi::Boolean::New(env, gpu_result_.success));
+        out.Set("executionTimeMs", Napi::Number::New(env, gpu_result_.execution_time_ms));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::ObjectReference scalars_ref_;
+    Napi::ObjectReference points_ref_;
+    Napi::ObjectReference result_ref_;
+    GPUBuffer* scalars_;
+    GPUBuffer* points_;
+    GPUBuffer* result_buffer_;
+    size_t num_points_;
+    int window_size_;
+    GPUResult gpu_result_;
+};
+
+/**
+ * Execute MSM on GPU, promise-returning
+ */
+Napi::Value MetalGpuMsmAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 4) {
+        Napi::TypeError::New(env, "Expected 4 arguments: scalarsBuffer, pointsBuffer, resultBuffer, numPoints").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object scalars_obj = info[0].As<Napi::Object>();
+    Napi::Object points_obj = info[1].As<Napi::Object>();
+    Napi::Object result_obj = info[2].As<Napi::Object>();
+    size_t num_points = info[3].As<Napi::Number>().Uint32Value();
+    int window_size = info.Length() > 4 ? info[4].As<Napi::Number>().Int32Value() : 0;
+
+    MetalMsmWorker* worker = new MetalMsmWorker(env, scalars_obj, points_obj, result_obj, num_points, window_size);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Async worker for the chunked GPU MSM
+ *
+ * Takes host-memory typed arrays rather than GPU buffers: inputs beyond
+ * the device buffer limit cannot live in a single GPU buffer, so the
+ * native side streams them in tiles.
+ */
+class MetalMsmChunkedWorker : public PromiseWorker {
+public:
+    MetalMsmChunkedWorker(
+        Napi::Env env,
+        Napi::BigUint64Array scalars,
+        Napi::BigUint64Array points,
+        size_t num_points,
+        int window_size
+    ) : PromiseWorker(env),
+        scalars_ref_(Napi::Persistent(scalars)),
+        points_ref_(Napi::Persistent(points)),
+        scalars_(scalars.Data()),
+        points_(points.Data()),
+        num_points_(num_points),
+        window_size_(window_size) {}
+
+    void Execute() override {
+        GPUResult gpu_result = metal_gpu_msm_chunked(scalars_, points_, result_, num_points_, window_size_);
+        if (!gpu_result.success) {
+            SetError(gpu_result.error_message != nullptr ? gpu_result.error_message : "Chunked MSM failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::BigUint64Array out = Napi::BigUint64Array::New(env, 12);
+        memcpy(out.Data(), result_, sizeof(result_));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::Reference<Napi::BigUint64Array> scalars_ref_;
+    Napi::Reference<Napi::BigUint64Array> points_ref_;
+    const uint64_t* scalars_;
+    const uint64_t* points_;
+    size_t num_points_;
+    int window_size_;
+    uint64_t result_[12];
+};
+
+/**
+ * Execute a chunked MSM on GPU from host memory, promise-returning
+ *
+ * points holds 72-byte affine records (9 limbs per point: x, y, and the
+ * packed infinity flag), matching the GPU AffinePoint layout.
+ */
+Napi::Value MetalGpuMsmChunkedAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: scalars, points, numPoints").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::BigUint64Array scalars = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array points = info[1].As<Napi::BigUint64Array>();
+    size_t num_points = info[2].As<Napi::Number>().Uint32Value();
+    int window_size = info.Length() > 3 ? info[3].As<Napi::Number>().Int32Value() : 0;
+
+    if (scalars.ElementLength() < num_points * 4 || points.ElementLength() < num_points * 9) {
+        Napi::TypeError::New(env, "Scalar/point arrays too small for numPoints").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MetalMsmChunkedWorker* worker = new MetalMsmChunkedWorker(env, scalars, points, num_points, window_size);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Async worker for GPU NTT execution (forward, inverse, and batch)
+ */
+class MetalNttWorker : public PromiseWorker {
+public:
+    enum class Mode { Forward, Inverse, Batch };
+
+    MetalNttWorker(
+        Napi::Env env,
+        Mode mode,
+        Napi::Object data_obj,
+        Napi::Object twiddles_obj,
+        Napi::Value n_inv_val,
+        Napi::BigUint64Array modulus,
+        size_t n,
+        size_t batch_size,
+        bool forward
+    ) : PromiseWorker(env),
+        mode_(mode),
+        data_ref_(Napi::Persistent(data_obj)),
+        twiddles_ref_(Napi::Persistent(twiddles_obj)),
+        data_(GetNativeBuffer(data_obj)),
+        twiddles_(GetNativeBuffer(twiddles_obj)),
+        n_inv_(nullptr),
+        n_(n),
+        batch_size_(batch_size),
+        forward_(forward),
+        gpu_result_{false, nullptr, 0.0} {
+        memcpy(modulus_, modulus.Data(), sizeof(modulus_));
+        if (n_inv_val.IsObject()) {
+            Napi::Object n_inv_obj = n_inv_val.As<Napi::Object>();
+            n_inv_ref_ = Napi::Persistent(n_inv_obj);
+            n_inv_ = GetNativeBuffer(n_inv_obj);
+        }
+    }
+
+    void Execute() override {
+        switch (mode_) {
+            case Mode::Forward:
+                gpu_result_ = metal_gpu_ntt_forward(data_, twiddles_, n_, modulus_);
+                break;
+            case Mode::Inverse:
+                gpu_result_ = metal_gpu_ntt_inverse(data_, twiddles_, n_inv_, n_, modulus_);
+                break;
+            case Mode::Batch:
+                gpu_result_ = metal_gpu_ntt_batch(data_, twiddles_, n_, batch_size_, forward_, modulus_);
+                break;
+        }
+        if (!gpu_result_.success) {
+            SetError(gpu_result_.error_message != nullptr ? gpu_result_.error_message : "NTT dispatch failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Object out = Napi::Object::New(env);
+        out.Set("success", Napi::Boolean::New(env, gpu_result_.success));
+        out.Set("executionTimeMs", Napi::Number::New(env, gpu_result_.execution_time_ms));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Mode mode_;
+    Napi::ObjectReference data_ref_;
+    Napi::ObjectReference twiddles_ref_;
+    Napi::ObjectReference n_inv_ref_;
+    GPUBuffer* data_;
+    GPUBuffer* twiddles_;
+    GPUBuffer* n_inv_;
+    uint64_t modulus_[4];
+    size_t n_;
+    size_t batch_size_;
+    bool forward_;
+    GPUResult gpu_result_;
+};
+
+/**
+ * Forward NTT on GPU, promise-returning
+ *
+ * Twiddle factors must be in Montgomery form (w^i * R mod modulus);
+ * data limbs stay canonical.
+ */
+Napi::Value MetalGpuNttForwardAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 4) {
+        Napi::TypeError::New(env, "Expected 4 arguments: dataBuffer, twiddlesBuffer, n, modulus").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object data_obj = info[0].As<Napi::Object>();
+    Napi::Object twiddles_obj = info[1].As<Napi::Object>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+    Napi::BigUint64Array modulus = info[3].As<Napi::BigUint64Array>();
+
+    if (modulus.ElementLength() < 4) {
+        Napi::TypeError::New(env, "modulus must have 4 limbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MetalNttWorker* worker = new MetalNttWorker(
+        env, MetalNttWorker::Mode::Forward, data_obj, twiddles_obj, env.Null(), modulus, n, 1, true);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Inverse NTT on GPU, promise-returning
+ *
+ * Inverse twiddle factors and n^-1 must be in Montgomery form; data
+ * limbs stay canonical.
+ */
+Napi::Value MetalGpuNttInverseAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 5) {
+        Napi::TypeError::New(env, "Expected 5 arguments: dataBuffer, twiddlesInvBuffer, nInvBuffer, n, modulus").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object data_obj = info[0].As<Napi::Object>();
+    Napi::Object twiddles_obj = info[1].As<Napi::Object>();
+    Napi::Value n_inv_val = info[2];
+    size_t n = info[3].As<Napi::Number>().Uint32Value();
+    Napi::BigUint64Array modulus = info[4].As<Napi::BigUint64Array>();
+
+    if (modulus.ElementLength() < 4) {
+        Napi::TypeError::New(env, "modulus must have 4 limbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    MetalNttWorker* worker = new MetalNttWorker(
+        env, MetalNttWorker::Mode::Inverse, data_obj, twiddles_obj, n_inv_val, modulus, n, 1, false);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Batch NTT on GPU, promise-returning
+ *
+ * Twiddle factors must be in Montgomery form; data limbs stay canonical.
+ */
+Napi::Value MetalGpuNttBatchAsync(const Napi::CallbackInfo& info) {
     Napi::Env env = info.Env();
-    
-    if (info.Length() < 5) {
-        Napi::TypeError::New(env, "Expected 5 arguments: a, b, m, n, k").ThrowAsJavaScriptException();
-        return Napi::Float64Array::New(env, 0);
+
+    if (info.Length() < 6) {
+        Napi::TypeError::New(env, "Expected 6 arguments: dataBuffer, twiddlesBuffer, n, batchSize, forward, modulus").ThrowAsJavaScriptException();
+        return env.Null();
     }
-    
-    if (!info[0].IsTypedArray() || !info[1].IsTypedArray()) {
-        Napi::TypeError::New(env, "First two arguments must be Float64Array").ThrowAsJavaScriptException();
-        return Napi::Float64Array::New(env, 0);
+
+    Napi::Object data_obj = info[0].As<Napi::Object>();
+    Napi::Object twiddles_obj = info[1].As<Napi::Object>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+    size_t batch_size = info[3].As<Napi::Number>().Uint32Value();
+    bool forward = info[4].As<Napi::Boolean>().Value();
+    Napi::BigUint64Array modulus = info[5].As<Napi::BigUint64Array>();
+
+    if (modulus.ElementLength() < 4) {
+        Napi::TypeError::New(env, "modulus must have 4 limbs").ThrowAsJavaScriptException();
+        return env.Null();
     }
-    
-    Napi::Float64Array a = info[0].As<Napi::Float64Array>();
-    Napi::Float64Array b = info[1].As<Napi::Float64Array>();
-    int m = info[2].As<Napi::Number>().Int32Value();
-    int n = info[3].As<Napi::Number>().Int32Value();
-    int k = info[4].As<Napi::Number>().Int32Value();
-    
-    // Validate dimensions
-    if (a.ElementLength() != (size_t)(m * k) || b.ElementLength() != (size_t)(k * n)) {
-        Napi::TypeError::New(env, "Matrix dimensions don't match").ThrowAsJavaScriptException();
-        return Napi::Float64Array::New(env, 0);
+
+    MetalNttWorker* worker = new MetalNttWorker(
+        env, MetalNttWorker::Mode::Batch, data_obj, twiddles_obj, env.Null(), modulus, n, batch_size, forward);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
+/**
+ * Create (or fetch from cache) an NTT plan for a (modulus, root, n) triple
+ *
+ * Args: modulus (BigUint64Array, 4 limbs), rootOfUnity (BigUint64Array,
+ * 4 limbs), n (number, power of 2). Returns a plan object whose twiddle
+ * tables stay resident in GPU memory across transforms.
+ */
+Napi::Value NttPlanCreate(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: modulus, rootOfUnity, n").ThrowAsJavaScriptException();
+        return env.Null();
     }
-    
-    Napi::Float64Array result = Napi::Float64Array::New(env, m * n);
-    
-    // Initialize result to zero
-    memset(result.Data(), 0, m * n * sizeof(double));
-    
-    blas_matrix_mul_f64(a.Data(), b.Data(), result.Data(), m, n, k, 1.0, 0.0);
-    
+
+    Napi::BigUint64Array modulus = info[0].As<Napi::BigUint64Array>();
+    Napi::BigUint64Array root = info[1].As<Napi::BigUint64Array>();
+    size_t n = info[2].As<Napi::Number>().Uint32Value();
+
+    if (modulus.ElementLength() < 4 || root.ElementLength() < 4) {
+        Napi::TypeError::New(env, "modulus and rootOfUnity must have 4 limbs").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    NTTPlan* plan = ntt_plan_create(modulus.Data(), root.Data(), n);
+    if (plan == nullptr) {
+        Napi::Error::New(env, "Failed to create NTT plan").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("n", Napi::Number::New(env, plan->n));
+    result.Set("_nativePtr", Napi::External<NTTPlan>::New(env, plan));
     return result;
 }
 
 /**
- * Check if NEON is available
+ * Async worker for plan-based NTT execution
  */
-Napi::Boolean NeonAvailable(const Napi::CallbackInfo& info) {
-    return Napi::Boolean::New(info.Env(), neon_available());
-}
+class NttPlanWorker : public PromiseWorker {
+public:
+    NttPlanWorker(
+        Napi::Env env,
+        Napi::Object plan_obj,
+        Napi::Object data_obj,
+        size_t batch_size,
+        bool forward
+    ) : PromiseWorker(env),
+        plan_ref_(Napi::Persistent(plan_obj)),
+        data_ref_(Napi::Persistent(data_obj)),
+        plan_(plan_obj.Get("_nativePtr").As<Napi::External<NTTPlan>>().Data()),
+        data_(GetNativeBuffer(data_obj)),
+        batch_size_(batch_size),
+        forward_(forward),
+        gpu_result_{false, nullptr, 0.0} {}
+
+    void Execute() override {
+        if (batch_size_ > 1) {
+            gpu_result_ = ntt_plan_execute_batch(plan_, data_, batch_size_, forward_);
+        } else {
+            gpu_result_ = ntt_plan_execute(plan_, data_, forward_);
+        }
+        if (!gpu_result_.success) {
+            SetError(gpu_result_.error_message != nullptr ? gpu_result_.error_message : "NTT plan execution failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Object out = Napi::Object::New(env);
+        out.Set("success", Napi::Boolean::New(env, gpu_result_.success));
+        out.Set("executionTimeMs", Napi::Number::New(env, gpu_result_.execution_time_ms));
+        deferred_.Resolve(out);
+    }
+
+private:
+    Napi::ObjectReference plan_ref_;
+    Napi::ObjectReference data_ref_;
+    NTTPlan* plan_;
+    GPUBuffer* data_;
+    size_t batch_size_;
+    bool forward_;
+    GPUResult gpu_result_;
+};
 
 /**
- * Check if SME is available
+ * Execute an NTT using a plan's resident twiddle tables, promise-returning
  */
-Napi::Boolean SmeAvailable(const Napi::CallbackInfo& info) {
-    return Napi::Boolean::New(info.Env(), sme_available());
+Napi::Value NttPlanExecuteAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3) {
+        Napi::TypeError::New(env, "Expected 3 arguments: plan, dataBuffer, forward").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object plan_obj = info[0].As<Napi::Object>();
+    Napi::Object data_obj = info[1].As<Napi::Object>();
+    bool forward = info[2].As<Napi::Boolean>().Value();
+
+    if (!plan_obj.Has("_nativePtr")) {
+        Napi::TypeError::New(env, "Invalid plan object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    NttPlanWorker* worker = new NttPlanWorker(env, plan_obj, data_obj, 1, forward);
+    worker->Queue();
+    return worker->GetPromise();
 }
 
-// ============================================================================
-// Metal GPU Functions
-// ============================================================================
+/**
+ * Execute a batch of same-size NTTs in a single dispatch sequence,
+ * promise-returning
+ */
+Napi::Value NttPlanExecuteBatchAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
 
-#ifdef __APPLE__
+    if (info.Length() < 4) {
+        Napi::TypeError::New(env, "Expected 4 arguments: plan, dataBuffer, batchSize, forward").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object plan_obj = info[0].As<Napi::Object>();
+    Napi::Object data_obj = info[1].As<Napi::Object>();
+    size_t batch_size = info[2].As<Napi::Number>().Uint32Value();
+    bool forward = info[3].As<Napi::Boolean>().Value();
+
+    if (!plan_obj.Has("_nativePtr")) {
+        Napi::TypeError::New(env, "Invalid plan object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    NttPlanWorker* worker = new NttPlanWorker(env, plan_obj, data_obj, batch_size, forward);
+    worker->Queue();
+    return worker->GetPromise();
+}
 
 /**
  * Initialize Metal GPU
@@ -251,12 +2235,64 @@ Napi::Object MetalGpuGetStatus(const Napi::CallbackInfo& info) {
     result.Set("deviceAvailable", Napi::Boolean::New(env, status.device_available));
     result.Set("unifiedMemory", Napi::Boolean::New(env, status.unified_memory));
     result.Set("maxThreadsPerGroup", Napi::Number::New(env, status.max_threads_per_group));
-    result.Set("maxBufferLength", Napi::Number::New(env, status.max_buffer_length));
+    result.Set("maxBufferLength", Napi::Number::New(env, (double)status.max_buffer_length));
     result.Set("deviceName", Napi::String::New(env, status.device_name));
-    
+
     return result;
 }
 
+/**
+ * Enable or disable GPU stage profiling
+ */
+Napi::Value MetalGpuProfilingSetEnabled(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsBoolean()) {
+        Napi::TypeError::New(env, "Expected 1 argument: enabled").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    metal_gpu_profiling_set_enabled(info[0].As<Napi::Boolean>().Value());
+    return env.Undefined();
+}
+
+/**
+ * Snapshot per-stage GPU timestamp statistics
+ *
+ * Returns [{ stage, count, gpuMs, occupancy, threadsPerGroup,
+ * maxThreadsPerGroup }], one entry per profiled compute stage. Empty
+ * unless profiling is enabled (metalGpuProfilingSetEnabled or
+ * ZK_ACCELERATE_GPU_PROFILE=1).
+ */
+Napi::Value MetalGpuProfilingSnapshot(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    GPUStageStats stats[128];
+    size_t count = metal_gpu_profiling_snapshot(stats, 128);
+
+    Napi::Array stages = Napi::Array::New(env, count);
+    for (size_t i = 0; i < count; i++) {
+        Napi::Object stage = Napi::Object::New(env);
+        stage.Set("stage", Napi::String::New(env, stats[i].stage));
+        stage.Set("count", Napi::Number::New(env, (double)stats[i].count));
+        stage.Set("gpuMs", Napi::Number::New(env, stats[i].gpu_ms));
+        stage.Set("occupancy", Napi::Number::New(env, stats[i].occupancy));
+        stage.Set("threadsPerGroup", Napi::Number::New(env, stats[i].threads_per_group));
+        stage.Set("maxThreadsPerGroup", Napi::Number::New(env, stats[i].max_threads_per_group));
+        stages.Set((uint32_t)i, stage);
+    }
+
+    return stages;
+}
+
+/**
+ * Reset the GPU stage statistics
+ */
+Napi::Value MetalGpuProfilingReset(const Napi::CallbackInfo& info) {
+    metal_gpu_profiling_reset();
+    return info.Env().Undefined();
+}
+
 /**
  * Allocate a GPU buffer
  */
@@ -308,6 +2344,32 @@ void MetalGpuFreeBuffer(const Napi::CallbackInfo& info) {
     metal_gpu_free_buffer(buffer);
 }
 
+/**
+ * Get buffer pool statistics
+ */
+Napi::Object MetalGpuPoolStats(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    GPUPoolStats stats = metal_gpu_pool_stats();
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("hits", Napi::Number::New(env, (double)stats.hits));
+    result.Set("misses", Napi::Number::New(env, (double)stats.misses));
+    result.Set("releases", Napi::Number::New(env, (double)stats.releases));
+    result.Set("evictions", Napi::Number::New(env, (double)stats.evictions));
+    result.Set("buffersPooled", Napi::Number::New(env, (double)stats.buffers_pooled));
+    result.Set("bytesPooled", Napi::Number::New(env, (double)stats.bytes_pooled));
+
+    return result;
+}
+
+/**
+ * Release all idle pooled buffers
+ */
+void MetalGpuPoolTrim(const Napi::CallbackInfo& info) {
+    metal_gpu_pool_trim();
+}
+
 /**
  * Copy data to GPU buffer
  */
@@ -366,6 +2428,105 @@ Napi::Value MetalGpuCopyFromBuffer(const Napi::CallbackInfo& info) {
     return result;
 }
 
+/**
+ * Copy data from GPU buffer into a caller-provided typed array
+ *
+ * Out-parameter variant of metalGpuCopyFromBuffer that avoids allocating
+ * a fresh Uint8Array per read.
+ */
+Napi::Boolean MetalGpuCopyFromBufferInto(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 3 || !info[1].IsTypedArray()) {
+        Napi::TypeError::New(env, "Expected 3 arguments: buffer, target, offset").ThrowAsJavaScriptException();
+        return Napi::Boolean::New(env, false);
+    }
+
+    Napi::Object bufferObj = info[0].As<Napi::Object>();
+    GPUBuffer* buffer = GetNativeBuffer(bufferObj);
+    if (buffer == nullptr) {
+        return Napi::Boolean::New(env, false);
+    }
+
+    Napi::TypedArray target = info[1].As<Napi::TypedArray>();
+    size_t offset = info[2].As<Napi::Number>().Uint32Value();
+
+    uint8_t* data = (uint8_t*)target.ArrayBuffer().Data() + target.ByteOffset();
+    bool success = metal_gpu_copy_from_buffer(buffer, data, target.ByteLength(), offset);
+    return Napi::Boolean::New(env, success);
+}
+
+/**
+ * Wrap an ArrayBuffer as a GPU buffer without copying
+ *
+ * On unified-memory machines the GPU reads and writes the ArrayBuffer's
+ * memory directly (newBufferWithBytesNoCopy). Returns null if the memory
+ * is not page-aligned or sized, in which case the caller should fall
+ * back to an allocated buffer and staged copies. The returned wrapper
+ * retains the ArrayBuffer so it outlives pending dispatches.
+ */
+Napi::Value MetalGpuWrapArrayBuffer(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsArrayBuffer()) {
+        Napi::TypeError::New(env, "Expected an ArrayBuffer argument").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::ArrayBuffer array_buffer = info[0].As<Napi::ArrayBuffer>();
+
+    GPUBuffer* buffer = metal_gpu_wrap_external(array_buffer.Data(), array_buffer.ByteLength());
+    if (buffer == nullptr) {
+        return env.Null();
+    }
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("id", Napi::Number::New(env, buffer->id));
+    result.Set("size", Napi::Number::New(env, buffer->size));
+    result.Set("isShared", Napi::Boolean::New(env, buffer->is_shared));
+    result.Set("isZeroCopy", Napi::Boolean::New(env, true));
+
+    // Keep the backing ArrayBuffer reachable through the wrapper
+    result.Set("_backingBuffer", array_buffer);
+    result.Set("_nativePtr", Napi::External<GPUBuffer>::New(env, buffer));
+
+    return result;
+}
+
+/**
+ * Zero-copy BigUint64Array view over a shared GPU buffer's contents
+ *
+ * On unified-memory machines the returned view aliases the memory the
+ * GPU reads and writes, so CPU kernels (neonBatchMontgomeryMul,
+ * msmRecodeScalars, batch inversion) can produce their output directly
+ * in the buffer and the staging copies through metalGpuCopyToBuffer
+ * disappear. The view is only valid while the buffer object is alive
+ * and not freed; returns null for buffers without CPU-visible contents.
+ */
+Napi::Value MetalGpuBufferContents(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 1 || !info[0].IsObject()) {
+        Napi::TypeError::New(env, "Expected 1 argument: buffer").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object bufferObj = info[0].As<Napi::Object>();
+    GPUBuffer* buffer = GetNativeBuffer(bufferObj);
+    if (buffer == nullptr) {
+        return env.Null();
+    }
+
+    void* contents = metal_gpu_get_buffer_contents(buffer);
+    if (contents == nullptr) {
+        return env.Null();
+    }
+
+    size_t elems = buffer->size / sizeof(uint64_t);
+    Napi::ArrayBuffer contents_ab = Napi::ArrayBuffer::New(env, contents, elems * sizeof(uint64_t));
+    return Napi::BigUint64Array::New(env, elems, contents_ab, 0);
+}
+
 /**
  * Compile a Metal shader
  */
@@ -507,8 +2668,154 @@ void MetalGpuSynchronize(const Napi::CallbackInfo& info) {
     metal_gpu_synchronize();
 }
 
+/**
+ * Async worker that waits on an already-committed dispatch handle
+ *
+ * The dispatch itself is committed on the JS thread, so consecutive
+ * metalGpuDispatchAsync calls queue overlapping command buffers; only
+ * the completion wait moves to the thread pool.
+ */
+class DispatchWaitWorker : public PromiseWorker {
+public:
+    DispatchWaitWorker(
+        Napi::Env env,
+        GPUDispatchHandle* handle,
+        Napi::Object pipeline_obj,
+        Napi::Array buffers_array
+    ) : PromiseWorker(env),
+        handle_(handle),
+        pipeline_ref_(Napi::Persistent(pipeline_obj)),
+        buffers_ref_(Napi::Persistent(buffers_array)),
+        gpu_result_{false, nullptr, 0.0} {}
+
+    void Execute() override {
+        gpu_result_ = metal_gpu_wait(handle_);
+        if (!gpu_result_.success) {
+            SetError(gpu_result_.error_message != nullptr ? gpu_result_.error_message : "Dispatch failed");
+        }
+    }
+
+    void OnOK() override {
+        Napi::Env env = Env();
+        Napi::Object out = Napi::Object::New(env);
+        out.Set("success", Napi::Boolean::New(env, gpu_result_.success));
+        out.Set("executionTimeMs", Napi::Number::New(env, gpu_result_.execution_time_ms));
+        deferred_.Resolve(out);
+    }
+
+private:
+    GPUDispatchHandle* handle_;
+    Napi::ObjectReference pipeline_ref_;
+    Napi::Reference<Napi::Array> buffers_ref_;
+    GPUResult gpu_result_;
+};
+
+/**
+ * Dispatch a compute kernel without blocking, promise-returning
+ */
+Napi::Value MetalGpuDispatchAsync(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    if (info.Length() < 4) {
+        Napi::TypeError::New(env, "Expected 4 arguments: pipeline, buffers, gridSize, groupSize").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::Object pipelineObj = info[0].As<Napi::Object>();
+    if (!pipelineObj.Has("_nativePtr")) {
+        Napi::TypeError::New(env, "Invalid pipeline object").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    Napi::External<GPUPipeline> pipelineExt = pipelineObj.Get("_nativePtr").As<Napi::External<GPUPipeline>>();
+    GPUPipeline* pipeline = pipelineExt.Data();
+
+    Napi::Array buffersArray = info[1].As<Napi::Array>();
+    size_t bufferCount = buffersArray.Length();
+    std::vector<GPUBuffer*> buffers(bufferCount);
+
+    for (size_t i = 0; i < bufferCount; i++) {
+        Napi::Object bufferObj = buffersArray.Get(i).As<Napi::Object>();
+        buffers[i] = GetNativeBuffer(bufferObj);
+    }
+
+    size_t gridSize = info[2].As<Napi::Number>().Uint32Value();
+    size_t groupSize = info[3].As<Napi::Number>().Uint32Value();
+
+    GPUDispatchHandle* handle = metal_gpu_dispatch_async(pipeline, buffers.data(), bufferCount, gridSize, groupSize);
+    if (handle == nullptr) {
+        Napi::Error::New(env, "Failed to submit dispatch").ThrowAsJavaScriptException();
+        return env.Null();
+    }
+
+    DispatchWaitWorker* worker = new DispatchWaitWorker(env, handle, pipelineObj, buffersArray);
+    worker->Queue();
+    return worker->GetPromise();
+}
+
 #endif // __APPLE__
 
+// ============================================================================
+// Performance Counters
+// ============================================================================
+
+/**
+ * Snapshot the native performance counters
+ *
+ * Returns { kernels: [{ name, count, totalMs, minMs, maxMs, p50Ms,
+ * p95Ms, p99Ms }], bytesToGpu, bytesFromGpu, pool? } where pool carries
+ * the GPU buffer pool hit statistics on Apple platforms.
+ */
+Napi::Value GetPerfCounters(const Napi::CallbackInfo& info) {
+    Napi::Env env = info.Env();
+
+    PerfKernelStats stats[128];
+    size_t count = perf_counters_snapshot(stats, 128);
+
+    Napi::Array kernels = Napi::Array::New(env, count);
+    for (size_t i = 0; i < count; i++) {
+        Napi::Object kernel = Napi::Object::New(env);
+        kernel.Set("name", Napi::String::New(env, stats[i].name));
+        kernel.Set("count", Napi::Number::New(env, (double)stats[i].count));
+        kernel.Set("totalMs", Napi::Number::New(env, stats[i].total_ms));
+        kernel.Set("minMs", Napi::Number::New(env, stats[i].min_ms));
+        kernel.Set("maxMs", Napi::Number::New(env, stats[i].max_ms));
+        kernel.Set("p50Ms", Napi::Number::New(env, stats[i].p50_ms));
+        kernel.Set("p95Ms", Napi::Number::New(env, stats[i].p95_ms));
+        kernel.Set("p99Ms", Napi::Number::New(env, stats[i].p99_ms));
+        kernels.Set((uint32_t)i, kernel);
+    }
+
+    PerfTransferStats transfers = perf_counters_transfers();
+
+    Napi::Object result = Napi::Object::New(env);
+    result.Set("kernels", kernels);
+    result.Set("bytesToGpu", Napi::Number::New(env, (double)transfers.bytes_to_gpu));
+    result.Set("bytesFromGpu", Napi::Number::New(env, (double)transfers.bytes_from_gpu));
+
+#ifdef __APPLE__
+    GPUPoolStats pool_stats = metal_gpu_pool_stats();
+    Napi::Object pool = Napi::Object::New(env);
+    pool.Set("hits", Napi::Number::New(env, (double)pool_stats.hits));
+    pool.Set("misses", Napi::Number::New(env, (double)pool_stats.misses));
+    pool.Set("releases", Napi::Number::New(env, (double)pool_stats.releases));
+    pool.Set("evictions", Napi::Number::New(env, (double)pool_stats.evictions));
+    pool.Set("buffersPooled", Napi::Number::New(env, (double)pool_stats.buffers_pooled));
+    pool.Set("bytesPooled", Napi::Number::New(env, (double)pool_stats.bytes_pooled));
+    result.Set("pool", pool);
+#endif
+
+    return result;
+}
+
+/**
+ * Reset all native performance counters
+ */
+Napi::Value ResetPerfCounters(const Napi::CallbackInfo& info) {
+    perf_counters_reset();
+    return info.Env().Undefined();
+}
+
 /**
  * Initialize the native addon
  */
@@ -525,13 +2832,63 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("vdspVectorAdd", Napi::Function::New(env, VdspVectorAdd));
     exports.Set("vdspVectorMul", Napi::Function::New(env, VdspVectorMul));
     exports.Set("vdspVectorSub", Napi::Function::New(env, VdspVectorSub));
+    exports.Set("vdspVectorAddInto", Napi::Function::New(env, VdspVectorAddInto));
+    exports.Set("vdspVectorMulInto", Napi::Function::New(env, VdspVectorMulInto));
+    exports.Set("vdspVectorSubInto", Napi::Function::New(env, VdspVectorSubInto));
     
     // BLAS operations
     exports.Set("blasMatrixMul", Napi::Function::New(env, BlasMatrixMul));
     
+    // NEON operations
+    exports.Set("neonBatchMontgomeryMul", Napi::Function::New(env, NeonBatchMontgomeryMul));
+    exports.Set("neonBatchMontgomeryMulAsync", Napi::Function::New(env, NeonBatchMontgomeryMulAsync));
+    exports.Set("neonBatchMontgomeryMulSoa", Napi::Function::New(env, NeonBatchMontgomeryMulSoa));
+    exports.Set("neonBatchFp2MontgomeryMul", Napi::Function::New(env, NeonBatchFp2MontgomeryMul));
+    exports.Set("neonBatchInverse", Napi::Function::New(env, NeonBatchInverse));
+
+    // End-to-end MSM
+    exports.Set("msmExecute", Napi::Function::New(env, MsmExecute));
+    exports.Set("msmExecuteAsync", Napi::Function::New(env, MsmExecuteAsync));
+    exports.Set("msmExecuteBls12381", Napi::Function::New(env, MsmExecuteBls12381));
+    exports.Set("msmExecuteBls12381Async", Napi::Function::New(env, MsmExecuteBls12381Async));
+    exports.Set("msmExecuteG2", Napi::Function::New(env, MsmExecuteG2));
+    exports.Set("msmExecuteG2Async", Napi::Function::New(env, MsmExecuteG2Async));
+    exports.Set("msmRecodeScalars", Napi::Function::New(env, MsmRecodeScalars));
+    exports.Set("msmIncrementalCreate", Napi::Function::New(env, MsmIncrementalCreate));
+    exports.Set("msmIncrementalUpdate", Napi::Function::New(env, MsmIncrementalUpdate));
+    exports.Set("msmIncrementalCommit", Napi::Function::New(env, MsmIncrementalCommit));
+    exports.Set("msmIncrementalCommitAsync", Napi::Function::New(env, MsmIncrementalCommitAsync));
+    exports.Set("msmIncrementalSerialize", Napi::Function::New(env, MsmIncrementalSerialize));
+    exports.Set("msmIncrementalDeserialize", Napi::Function::New(env, MsmIncrementalDeserialize));
+    exports.Set("msmIncrementalDestroy", Napi::Function::New(env, MsmIncrementalDestroy));
+    exports.Set("fixedBaseTableCreate", Napi::Function::New(env, FixedBaseTableCreate));
+    exports.Set("fixedBaseMul", Napi::Function::New(env, FixedBaseMul));
+    exports.Set("fixedBaseTableSerialize", Napi::Function::New(env, FixedBaseTableSerialize));
+    exports.Set("fixedBaseTableDeserialize", Napi::Function::New(env, FixedBaseTableDeserialize));
+    exports.Set("fixedBaseTableDestroy", Napi::Function::New(env, FixedBaseTableDestroy));
+    exports.Set("autotuneWarmup", Napi::Function::New(env, AutotuneWarmup));
+    exports.Set("autotuneGetProfile", Napi::Function::New(env, AutotuneGetProfile));
+    exports.Set("nttCpuPlanCreate", Napi::Function::New(env, NttCpuPlanCreate));
+    exports.Set("nttCpuExecuteAsync", Napi::Function::New(env, NttCpuExecuteAsync));
+    exports.Set("arenaCreate", Napi::Function::New(env, ArenaCreate));
+    exports.Set("arenaInstall", Napi::Function::New(env, ArenaInstall));
+    exports.Set("arenaReset", Napi::Function::New(env, ArenaReset));
+    exports.Set("arenaDestroy", Napi::Function::New(env, ArenaDestroy));
+    exports.Set("arenaGetStats", Napi::Function::New(env, ArenaGetStats));
+
     // Feature detection
     exports.Set("neonAvailable", Napi::Function::New(env, NeonAvailable));
     exports.Set("smeAvailable", Napi::Function::New(env, SmeAvailable));
+
+    // Performance counters
+    exports.Set("getPerfCounters", Napi::Function::New(env, GetPerfCounters));
+    exports.Set("resetPerfCounters", Napi::Function::New(env, ResetPerfCounters));
+
+    // Memory-mapped SRS
+    exports.Set("srsOpen", Napi::Function::New(env, SrsOpen));
+    exports.Set("srsClose", Napi::Function::New(env, SrsClose));
+    exports.Set("srsPrefetch", Napi::Function::New(env, SrsPrefetch));
+    exports.Set("srsWrite", Napi::Function::New(env, SrsWrite));
     
 #ifdef __APPLE__
     // Metal GPU functions
@@ -539,16 +2896,35 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports.Set("metalGpuShutdown", Napi::Function::New(env, MetalGpuShutdown));
     exports.Set("metalGpuIsAvailable", Napi::Function::New(env, MetalGpuIsAvailable));
     exports.Set("metalGpuGetStatus", Napi::Function::New(env, MetalGpuGetStatus));
+    exports.Set("metalGpuProfilingSetEnabled", Napi::Function::New(env, MetalGpuProfilingSetEnabled));
+    exports.Set("metalGpuProfilingSnapshot", Napi::Function::New(env, MetalGpuProfilingSnapshot));
+    exports.Set("metalGpuProfilingReset", Napi::Function::New(env, MetalGpuProfilingReset));
     exports.Set("metalGpuAllocBuffer", Napi::Function::New(env, MetalGpuAllocBuffer));
     exports.Set("metalGpuFreeBuffer", Napi::Function::New(env, MetalGpuFreeBuffer));
+    exports.Set("metalGpuPoolStats", Napi::Function::New(env, MetalGpuPoolStats));
+    exports.Set("metalGpuPoolTrim", Napi::Function::New(env, MetalGpuPoolTrim));
     exports.Set("metalGpuCopyToBuffer", Napi::Function::New(env, MetalGpuCopyToBuffer));
     exports.Set("metalGpuCopyFromBuffer", Napi::Function::New(env, MetalGpuCopyFromBuffer));
+    exports.Set("metalGpuCopyFromBufferInto", Napi::Function::New(env, MetalGpuCopyFromBufferInto));
+    exports.Set("metalGpuWrapArrayBuffer", Napi::Function::New(env, MetalGpuWrapArrayBuffer));
+    exports.Set("metalGpuBufferContents", Napi::Function::New(env, MetalGpuBufferContents));
     exports.Set("metalGpuCompileShader", Napi::Function::New(env, MetalGpuCompileShader));
     exports.Set("metalGpuGetCachedPipeline", Napi::Function::New(env, MetalGpuGetCachedPipeline));
     exports.Set("metalGpuFreePipeline", Napi::Function::New(env, MetalGpuFreePipeline));
     exports.Set("metalGpuClearShaderCache", Napi::Function::New(env, MetalGpuClearShaderCache));
     exports.Set("metalGpuDispatch", Napi::Function::New(env, MetalGpuDispatch));
     exports.Set("metalGpuSynchronize", Napi::Function::New(env, MetalGpuSynchronize));
+
+    // Async (promise-returning) GPU kernels
+    exports.Set("metalGpuDispatchAsync", Napi::Function::New(env, MetalGpuDispatchAsync));
+    exports.Set("metalGpuMsmAsync", Napi::Function::New(env, MetalGpuMsmAsync));
+    exports.Set("metalGpuMsmChunkedAsync", Napi::Function::New(env, MetalGpuMsmChunkedAsync));
+    exports.Set("metalGpuNttForwardAsync", Napi::Function::New(env, MetalGpuNttForwardAsync));
+    exports.Set("metalGpuNttInverseAsync", Napi::Function::New(env, MetalGpuNttInverseAsync));
+    exports.Set("metalGpuNttBatchAsync", Napi::Function::New(env, MetalGpuNttBatchAsync));
+    exports.Set("nttPlanCreate", Napi::Function::New(env, NttPlanCreate));
+    exports.Set("nttPlanExecuteAsync", Napi::Function::New(env, NttPlanExecuteAsync));
+    exports.Set("nttPlanExecuteBatchAsync", Napi::Function::New(env, NttPlanExecuteBatchAsync));
 #endif
     
     return exports;
@@ -0,0 +1,317 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Runtime autotuner implementation
+ *
+ * Benchmarks the NEON batch multiplier, the BLAS path and the Metal MSM
+ * dispatch at a few problem sizes, derives the CPU/GPU crossover and
+ * per-bracket Pippenger window sizes, and caches the profile per
+ * machine. Benchmark inputs are pseudo-random field limbs: point
+ * validity does not affect the timing of the add formulas, so no scalar
+ * multiplications are spent on generating real curve points.
+ *
+ * Requirements: 2.6, 9.1
+ */
+
+#include "../include/autotune.h"
+#include "../include/zk_accelerate.h"
+#include "../include/cpu_accelerate.h"
+#include "point_ops.h"
+
+#ifdef __APPLE__
+#include "../include/metal_gpu.h"
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+static std::mutex g_autotune_mutex;
+static AutotuneProfile g_profile;
+static bool g_profile_valid = false;
+static bool g_load_attempted = false;
+
+/**
+ * Hardware fingerprint tying a cached profile to this machine
+ */
+static void autotune_fingerprint(char* out, size_t out_size) {
+    HardwareCapabilities caps = detect_hardware_capabilities();
+    snprintf(out, out_size, "%s/%d/%d",
+             caps.metal_device_name[0] != '\0' ? caps.metal_device_name : "cpu",
+             caps.cpu_cores, caps.gpu_cores);
+}
+
+/**
+ * Resolve the cache file path (ZK_ACCELERATE_AUTOTUNE_CACHE overrides)
+ */
+static std::string autotune_cache_path(void) {
+    const char* env = std::getenv("ZK_ACCELERATE_AUTOTUNE_CACHE");
+    if (env != nullptr && env[0] != '\0') {
+        return std::string(env);
+    }
+
+    const char* home = std::getenv("HOME");
+    if (home == nullptr || home[0] == '\0') {
+        return std::string();
+    }
+    return std::string(home) + "/.cache/zk-accelerate/autotune.bin";
+}
+
+static bool autotune_profile_valid(const AutotuneProfile& profile) {
+    if (memcmp(profile.magic, AUTOTUNE_MAGIC, sizeof(profile.magic)) != 0) {
+        return false;
+    }
+    if (profile.version != AUTOTUNE_VERSION) {
+        return false;
+    }
+
+    char fingerprint[sizeof(profile.fingerprint)];
+    autotune_fingerprint(fingerprint, sizeof(fingerprint));
+    return strncmp(profile.fingerprint, fingerprint, sizeof(fingerprint)) == 0;
+}
+
+/**
+ * Load the cached profile if one exists for this machine
+ * Caller holds g_autotune_mutex.
+ */
+static void autotune_load_locked(void) {
+    if (g_load_attempted) {
+        return;
+    }
+    g_load_attempted = true;
+
+    std::string path = autotune_cache_path();
+    if (path.empty()) {
+        return;
+    }
+
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return;
+    }
+
+    AutotuneProfile profile;
+    bool ok = fread(&profile, sizeof(profile), 1, file) == 1;
+    fclose(file);
+
+    if (ok && autotune_profile_valid(profile)) {
+        g_profile = profile;
+        g_profile_valid = true;
+    }
+}
+
+/**
+ * Persist the profile; failures are non-fatal (the in-memory profile
+ * still applies for the life of the process)
+ */
+static void autotune_store(const AutotuneProfile& profile) {
+    std::string path = autotune_cache_path();
+    if (path.empty()) {
+        return;
+    }
+
+#ifndef _WIN32
+    // Create the cache directory chain if missing
+    for (size_t pos = 1; (pos = path.find('/', pos)) != std::string::npos; pos++) {
+        mkdir(path.substr(0, pos).c_str(), 0755);
+    }
+#endif
+
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return;
+    }
+    bool ok = fwrite(&profile, sizeof(profile), 1, file) == 1;
+    if (fclose(file) != 0 || !ok) {
+        remove(path.c_str());
+    }
+}
+
+static double now_ms(void) {
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Fill a limb array with pseudo-random field elements below the BN254
+ * base field modulus (top limb masked under the modulus high limb)
+ */
+static void random_limbs(std::vector<uint64_t>& limbs, std::mt19937_64& rng, int limbs_per_elem) {
+    for (size_t i = 0; i < limbs.size(); i++) {
+        limbs[i] = rng();
+        if ((int)(i % limbs_per_elem) == limbs_per_elem - 1) {
+            limbs[i] &= 0x0FFFFFFFFFFFFFFFULL;
+        }
+    }
+}
+
+/**
+ * The MSM sizes measured during warmup (log2 of point count)
+ *
+ * Brackets between the measured ones keep the static heuristic; the
+ * crossover fit interpolates between neighboring measurements.
+ */
+static const int kMsmBrackets[] = {10, 12, 14, 16};
+static const int kNumMsmBrackets = (int)(sizeof(kMsmBrackets) / sizeof(kMsmBrackets[0]));
+
+bool autotune_warmup(void) {
+    AutotuneProfile profile;
+    memset(&profile, 0, sizeof(profile));
+    memcpy(profile.magic, AUTOTUNE_MAGIC, sizeof(profile.magic));
+    profile.version = AUTOTUNE_VERSION;
+    autotune_fingerprint(profile.fingerprint, sizeof(profile.fingerprint));
+    profile.msm_gpu_crossover = UINT64_MAX;
+
+    std::mt19937_64 rng(0x5A6B7C8D9E0F1A2BULL);
+
+    // NEON batch multiplier: ns per 4-limb Montgomery multiplication
+    {
+        const size_t count = 1 << 15;
+        std::vector<uint64_t> a(count * 4), b(count * 4), out(count * 4);
+        random_limbs(a, rng, 4);
+        random_limbs(b, rng, 4);
+
+        double start = now_ms();
+        neon_batch_montgomery_mul(a.data(), b.data(), BN254_FQ_MODULUS, BN254_FQ_MU,
+                                  out.data(), count, 4);
+        profile.neon_mul_ns_per_op = (now_ms() - start) * 1e6 / (double)count;
+    }
+
+    // BLAS path: dgemm throughput at a proving-typical tile size
+    {
+        const int dim = 192;
+        std::vector<double> a(dim * dim, 1.0), b(dim * dim, 1.0), c(dim * dim, 0.0);
+
+        double start = now_ms();
+        blas_matrix_mul_f64(a.data(), b.data(), c.data(), dim, dim, dim, 1.0, 0.0);
+        double elapsed_ms = now_ms() - start;
+        if (elapsed_ms > 0.0) {
+            profile.blas_gflops = 2.0 * dim * (double)dim * dim / (elapsed_ms * 1e6);
+        }
+    }
+
+    // MSM: per-bracket window size on the CPU engine, and the CPU
+    // baseline times the GPU comparison below reuses
+    double cpu_ms[kNumMsmBrackets] = {0};
+    {
+        size_t max_n = (size_t)1 << kMsmBrackets[kNumMsmBrackets - 1];
+        std::vector<uint64_t> points(max_n * 8), scalars(max_n * 4);
+        random_limbs(points, rng, 4);
+        random_limbs(scalars, rng, 4);
+        uint64_t result[12];
+
+        for (int bi = 0; bi < kNumMsmBrackets; bi++) {
+            int bracket = kMsmBrackets[bi];
+            size_t n = (size_t)1 << bracket;
+            int heuristic = msm_optimal_window_size(n);
+
+            int best_window = heuristic;
+            double best_ms = 0.0;
+
+            for (int delta = -2; delta <= 2; delta += 2) {
+                int window = heuristic + delta;
+                if (window < 4 || window > 16) {
+                    continue;
+                }
+
+                double start = now_ms();
+                if (!msm_execute_with_window(points.data(), scalars.data(), n, result, window)) {
+                    continue;
+                }
+                double elapsed = now_ms() - start;
+
+                if (best_ms == 0.0 || elapsed < best_ms) {
+                    best_ms = elapsed;
+                    best_window = window;
+                }
+            }
+
+            profile.msm_window_size[bracket] = (uint32_t)best_window;
+            cpu_ms[bi] = best_ms;
+        }
+    }
+
+#ifdef __APPLE__
+    // Metal MSM dispatch at the same sizes: the crossover is the first
+    // measured size where the GPU wins and keeps winning
+    if (metal_gpu_is_available()) {
+        size_t max_n = (size_t)1 << kMsmBrackets[kNumMsmBrackets - 1];
+        std::vector<uint64_t> affine(max_n * 9), scalars(max_n * 4);
+        random_limbs(scalars, rng, 4);
+        for (size_t i = 0; i < max_n; i++) {
+            for (int j = 0; j < 8; j++) {
+                affine[i * 9 + j] = rng() & (j % 4 == 3 ? 0x0FFFFFFFFFFFFFFFULL : ~0ULL);
+            }
+            affine[i * 9 + 8] = 0; // is_infinity + padding
+        }
+        uint64_t result[12];
+
+        for (int bi = 0; bi < kNumMsmBrackets; bi++) {
+            size_t n = (size_t)1 << kMsmBrackets[bi];
+
+            double start = now_ms();
+            GPUResult gpu = metal_gpu_msm_chunked(scalars.data(), affine.data(), result, n, 0);
+            double elapsed = now_ms() - start;
+
+            if (!gpu.success) {
+                break;
+            }
+            if (bi == 0) {
+                profile.gpu_msm_base_ms = elapsed;
+            }
+
+            if (elapsed < cpu_ms[bi] && cpu_ms[bi] > 0.0) {
+                if (profile.msm_gpu_crossover == UINT64_MAX) {
+                    profile.msm_gpu_crossover = n;
+                }
+            } else {
+                // GPU lost again at a larger size: push the crossover up
+                profile.msm_gpu_crossover = UINT64_MAX;
+            }
+        }
+    }
+#endif
+
+    {
+        std::lock_guard<std::mutex> lock(g_autotune_mutex);
+        g_profile = profile;
+        g_profile_valid = true;
+        g_load_attempted = true;
+    }
+
+    autotune_store(profile);
+    return true;
+}
+
+const AutotuneProfile* autotune_get_profile(void) {
+    std::lock_guard<std::mutex> lock(g_autotune_mutex);
+    autotune_load_locked();
+    return g_profile_valid ? &g_profile : nullptr;
+}
+
+int autotune_msm_window_size(size_t n) {
+    const AutotuneProfile* profile = autotune_get_profile();
+    if (profile != nullptr && n > 0) {
+        int bracket = 0;
+        for (size_t v = n; v > 1; v >>= 1) {
+            bracket++;
+        }
+        if (bracket < AUTOTUNE_MAX_BRACKETS && profile->msm_window_size[bracket] != 0) {
+            return (int)profile->msm_window_size[bracket];
+        }
+    }
+    return msm_optimal_window_size(n);
+}
+
+bool autotune_msm_prefer_gpu(size_t n) {
+    const AutotuneProfile* profile = autotune_get_profile();
+    return profile != nullptr && (uint64_t)n >= profile->msm_gpu_crossover;
+}
@@ -10,6 +10,7 @@
  */
 
 #include "../include/cpu_accelerate.h"
+#include "../include/arena.h"
 #include <cstring>
 #include <cstdlib>
 
@@ -135,8 +136,11 @@ void blas_matrix_vector_mul_f64(
  *    goes into bucket j
  * 2. Use matrix multiplication to accumulate: buckets = M^T * points
  *
- * For efficiency, we use a dense representation when the number of
- * buckets is small, and sparse operations otherwise.
+ * The indicator matrix is quadratic in memory and the sums are plain
+ * f64 coordinate adds, so this stays an AMX throughput experiment capped
+ * at small sizes; real bucket accumulation is sparse_bucket_accumulate
+ * in msm_execute.cc, which works on limb-form points with curve
+ * additions and scales linearly.
  */
 void blas_bucket_accumulate(
     const uint32_t* bucket_indices,
@@ -150,12 +154,14 @@ void blas_bucket_accumulate(
     // This leverages AMX effectively
     if (num_buckets <= 1024 && num_points <= 4096) {
 #ifdef __APPLE__
-        // Create indicator matrix (num_points x num_buckets)
-        double* indicator = (double*)calloc(num_points * num_buckets, sizeof(double));
+        // Create indicator matrix (num_points x num_buckets); scratch
+        // comes from the session arena when one is installed
+        double* indicator = (double*)arena_scratch_alloc(num_points * num_buckets * sizeof(double));
         if (indicator == NULL) {
             goto fallback;
         }
-        
+        memset(indicator, 0, num_points * num_buckets * sizeof(double));
+
         // Fill indicator matrix
         for (size_t i = 0; i < num_points; i++) {
             uint32_t bucket = bucket_indices[i];
@@ -171,13 +177,13 @@ void blas_bucket_accumulate(
         
         for (size_t c = 0; c < coord_size; c++) {
             // Extract column c from point_coords into a temporary vector
-            double* point_col = (double*)malloc(num_points * sizeof(double));
-            double* bucket_col = (double*)malloc(num_buckets * sizeof(double));
-            
+            double* point_col = (double*)arena_scratch_alloc(num_points * sizeof(double));
+            double* bucket_col = (double*)arena_scratch_alloc(num_buckets * sizeof(double));
+
             if (point_col == NULL || bucket_col == NULL) {
-                free(point_col);
-                free(bucket_col);
-                free(indicator);
+                arena_scratch_free(point_col);
+                arena_scratch_free(bucket_col);
+                arena_scratch_free(indicator);
                 goto fallback;
             }
             
@@ -210,11 +216,11 @@ void blas_bucket_accumulate(
                 bucket_accum[b * coord_size + c] += bucket_col[b];
             }
             
-            free(point_col);
-            free(bucket_col);
+            arena_scratch_free(point_col);
+            arena_scratch_free(bucket_col);
         }
-        
-        free(indicator);
+
+        arena_scratch_free(indicator);
         return;
 #endif
     }
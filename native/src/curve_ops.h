@@ -0,0 +1,549 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Curve-generic field and point arithmetic (internal)
+ *
+ * Templated generalization of the BN254 primitives in point_ops.h over a
+ * compile-time curve descriptor: limb count, modulus, Montgomery
+ * constants and the curve b coefficient. The Jacobian formulas
+ * (dbl-2009-l, add-2007-bl, madd-2007-bl) only assume a short
+ * Weierstrass curve with a = 0, so one set of routines serves every
+ * limb width; the Montgomery multiplication dispatches to the matching
+ * NEON kernel at compile time. Descriptors are provided for the two
+ * production curves, BN254 (4-limb base field) and BLS12-381 (6-limb
+ * base field). Scalars are 4 limbs on both: Fr is 254 and 255 bits
+ * respectively.
+ *
+ * This header is internal to the native layer and is not part of the
+ * public C API in include/.
+ */
+
+#ifndef CURVE_OPS_H
+#define CURVE_OPS_H
+
+#include "../include/cpu_accelerate.h"
+#include <cstdint>
+#include <cstring>
+
+// ============================================================================
+// Curve descriptors
+// ============================================================================
+
+/**
+ * BN254 G1: y^2 = x^3 + 3 over the 254-bit base field
+ *
+ * Constants match point_ops.h; the descriptor exists so curve-generic
+ * code can be checked against the specialized BN254 engine.
+ */
+struct CurveBn254G1 {
+    static constexpr int LIMBS = 4;
+    static constexpr int SCALAR_BITS = 254;
+
+    // Base field modulus p (little-endian limbs)
+    static constexpr uint64_t MODULUS[4] = {
+        0x3C208C16D87CFD47ULL,
+        0x97816A916871CA8DULL,
+        0xB85045B68181585DULL,
+        0x30644E72E131A029ULL
+    };
+
+    // Montgomery constant mu = -p^(-1) mod 2^64
+    static constexpr uint64_t MU = 0x87D20782E4866389ULL;
+
+    // R mod p (Montgomery representation of 1)
+    static constexpr uint64_t MONT_ONE[4] = {
+        0xD35D438DC58F0D9DULL,
+        0x0A78EB28F5C70B3DULL,
+        0x666EA36F7879462CULL,
+        0x0E0A77C19A07DF2FULL
+    };
+
+    // Curve coefficient b = 3 in Montgomery form
+    static constexpr uint64_t B_MONT[4] = {
+        0x7A17CAA950AD28D7ULL,
+        0x1F6AC17AE15521B9ULL,
+        0x334BEA4E696BD284ULL,
+        0x2A1F6744CE179D8EULL
+    };
+};
+
+/**
+ * BLS12-381 G1: y^2 = x^3 + 4 over the 381-bit base field
+ */
+struct CurveBls12381G1 {
+    static constexpr int LIMBS = 6;
+    static constexpr int SCALAR_BITS = 255;
+
+    // Base field modulus p (little-endian limbs)
+    static constexpr uint64_t MODULUS[6] = {
+        0xB9FEFFFFFFFFAAABULL,
+        0x1EABFFFEB153FFFFULL,
+        0x6730D2A0F6B0F624ULL,
+        0x64774B84F38512BFULL,
+        0x4B1BA7B6434BACD7ULL,
+        0x1A0111EA397FE69AULL
+    };
+
+    // Montgomery constant mu = -p^(-1) mod 2^64 (R = 2^384)
+    static constexpr uint64_t MU = 0x89F3FFFCFFFCFFFDULL;
+
+    // R mod p (Montgomery representation of 1)
+    static constexpr uint64_t MONT_ONE[6] = {
+        0x760900000002FFFDULL,
+        0xEBF4000BC40C0002ULL,
+        0x5F48985753C758BAULL,
+        0x77CE585370525745ULL,
+        0x5C071A97A256EC6DULL,
+        0x15F65EC3FA80E493ULL
+    };
+
+    // Curve coefficient b = 4 in Montgomery form
+    static constexpr uint64_t B_MONT[6] = {
+        0xAA270000000CFFF3ULL,
+        0x53CC0032FC34000AULL,
+        0x478FE97A6B0A807FULL,
+        0xB1D37EBEE6BA24D7ULL,
+        0x8EC9733BBF78AB2FULL,
+        0x09D645513D83DE7EULL
+    };
+};
+
+// ============================================================================
+// Field and point types
+// ============================================================================
+
+template <typename Curve>
+struct CurveFq {
+    uint64_t limbs[Curve::LIMBS];
+};
+
+// Jacobian point (X, Y, Z), identity encoded as Z = 0
+template <typename Curve>
+struct CurveJacobianPoint {
+    CurveFq<Curve> x;
+    CurveFq<Curve> y;
+    CurveFq<Curve> z;
+};
+
+// Affine point, layout matches the Metal AffinePoint struct
+template <typename Curve>
+struct CurveAffinePoint {
+    CurveFq<Curve> x;
+    CurveFq<Curve> y;
+    uint32_t is_infinity;
+    uint32_t padding;
+};
+
+// ============================================================================
+// Field operations
+// ============================================================================
+
+template <typename Curve>
+static inline void curve_fq_copy(CurveFq<Curve>& dst, const CurveFq<Curve>& src) {
+    memcpy(dst.limbs, src.limbs, sizeof(dst.limbs));
+}
+
+template <typename Curve>
+static inline bool curve_fq_is_zero(const CurveFq<Curve>& a) {
+    uint64_t bits = 0;
+    for (int i = 0; i < Curve::LIMBS; i++) {
+        bits |= a.limbs[i];
+    }
+    return bits == 0;
+}
+
+template <typename Curve>
+static inline void curve_fq_zero(CurveFq<Curve>& a) {
+    memset(a.limbs, 0, sizeof(a.limbs));
+}
+
+template <typename Curve>
+static inline void curve_fq_one(CurveFq<Curve>& a) {
+    memcpy(a.limbs, Curve::MONT_ONE, sizeof(a.limbs));
+}
+
+template <typename Curve>
+static inline bool curve_fq_equal(const CurveFq<Curve>& a, const CurveFq<Curve>& b) {
+    return memcmp(a.limbs, b.limbs, sizeof(a.limbs)) == 0;
+}
+
+template <typename Curve>
+static inline int curve_fq_cmp_modulus(const CurveFq<Curve>& a) {
+    for (int i = Curve::LIMBS - 1; i >= 0; i--) {
+        if (a.limbs[i] < Curve::MODULUS[i]) return -1;
+        if (a.limbs[i] > Curve::MODULUS[i]) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Field addition: result = (a + b) mod p
+ */
+template <typename Curve>
+static inline void curve_fq_add(CurveFq<Curve>& result, const CurveFq<Curve>& a, const CurveFq<Curve>& b) {
+    uint64_t carry = 0;
+    for (int i = 0; i < Curve::LIMBS; i++) {
+        __uint128_t sum = (__uint128_t)a.limbs[i] + b.limbs[i] + carry;
+        result.limbs[i] = (uint64_t)sum;
+        carry = (uint64_t)(sum >> 64);
+    }
+
+    if (carry || curve_fq_cmp_modulus<Curve>(result) >= 0) {
+        uint64_t borrow = 0;
+        for (int i = 0; i < Curve::LIMBS; i++) {
+            __uint128_t diff = (__uint128_t)result.limbs[i] - Curve::MODULUS[i] - borrow;
+            result.limbs[i] = (uint64_t)diff;
+            borrow = (diff >> 64) ? 1 : 0;
+        }
+    }
+}
+
+/**
+ * Field subtraction: result = (a - b) mod p
+ */
+template <typename Curve>
+static inline void curve_fq_sub(CurveFq<Curve>& result, const CurveFq<Curve>& a, const CurveFq<Curve>& b) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < Curve::LIMBS; i++) {
+        __uint128_t diff = (__uint128_t)a.limbs[i] - b.limbs[i] - borrow;
+        result.limbs[i] = (uint64_t)diff;
+        borrow = (diff >> 64) ? 1 : 0;
+    }
+
+    if (borrow) {
+        uint64_t carry = 0;
+        for (int i = 0; i < Curve::LIMBS; i++) {
+            __uint128_t sum = (__uint128_t)result.limbs[i] + Curve::MODULUS[i] + carry;
+            result.limbs[i] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+    }
+}
+
+/**
+ * Field negation: result = -a mod p
+ */
+template <typename Curve>
+static inline void curve_fq_neg(CurveFq<Curve>& result, const CurveFq<Curve>& a) {
+    if (curve_fq_is_zero<Curve>(a)) {
+        curve_fq_zero<Curve>(result);
+        return;
+    }
+    uint64_t borrow = 0;
+    for (int i = 0; i < Curve::LIMBS; i++) {
+        __uint128_t diff = (__uint128_t)Curve::MODULUS[i] - a.limbs[i] - borrow;
+        result.limbs[i] = (uint64_t)diff;
+        borrow = (diff >> 64) ? 1 : 0;
+    }
+}
+
+/**
+ * Field multiplication (Montgomery): result = a * b * R^(-1) mod p
+ *
+ * Dispatches to the NEON kernel for the descriptor's limb width at
+ * compile time.
+ */
+template <typename Curve>
+static inline void curve_fq_mul(CurveFq<Curve>& result, const CurveFq<Curve>& a, const CurveFq<Curve>& b) {
+    if constexpr (Curve::LIMBS == 4) {
+        neon_montgomery_mul_4limb(a.limbs, b.limbs, Curve::MODULUS, Curve::MU, result.limbs);
+    } else {
+        static_assert(Curve::LIMBS == 6, "no Montgomery kernel for this limb width");
+        neon_montgomery_mul_6limb(a.limbs, b.limbs, Curve::MODULUS, Curve::MU, result.limbs);
+    }
+}
+
+/**
+ * Field squaring: result = a^2 * R^(-1) mod p
+ */
+template <typename Curve>
+static inline void curve_fq_sqr(CurveFq<Curve>& result, const CurveFq<Curve>& a) {
+    curve_fq_mul<Curve>(result, a, a);
+}
+
+/**
+ * Field doubling: result = 2a mod p
+ */
+template <typename Curve>
+static inline void curve_fq_dbl(CurveFq<Curve>& result, const CurveFq<Curve>& a) {
+    curve_fq_add<Curve>(result, a, a);
+}
+
+// ============================================================================
+// Point operations (Jacobian coordinates, curve y^2 = x^3 + b)
+// ============================================================================
+
+template <typename Curve>
+static inline bool curve_point_is_identity(const CurveJacobianPoint<Curve>& p) {
+    return curve_fq_is_zero<Curve>(p.z);
+}
+
+template <typename Curve>
+static inline void curve_point_set_identity(CurveJacobianPoint<Curve>& p) {
+    curve_fq_one<Curve>(p.x);
+    curve_fq_one<Curve>(p.y);
+    curve_fq_zero<Curve>(p.z);
+}
+
+template <typename Curve>
+static inline void curve_point_copy(CurveJacobianPoint<Curve>& dst, const CurveJacobianPoint<Curve>& src) {
+    memcpy(&dst, &src, sizeof(CurveJacobianPoint<Curve>));
+}
+
+/**
+ * Point negation: (X, Y, Z) -> (X, -Y, Z)
+ */
+template <typename Curve>
+static inline void curve_point_neg(CurveJacobianPoint<Curve>& result, const CurveJacobianPoint<Curve>& p) {
+    curve_fq_copy<Curve>(result.x, p.x);
+    curve_fq_neg<Curve>(result.y, p.y);
+    curve_fq_copy<Curve>(result.z, p.z);
+}
+
+/**
+ * Point doubling: result = 2p
+ *
+ * Uses the dbl-2009-l formulas (valid for a = 0 curves).
+ */
+template <typename Curve>
+static inline void curve_point_double(CurveJacobianPoint<Curve>& result, const CurveJacobianPoint<Curve>& p) {
+    if (curve_point_is_identity<Curve>(p)) {
+        curve_point_set_identity<Curve>(result);
+        return;
+    }
+
+    CurveFq<Curve> a, b, c, d, e, f, t0, t1;
+
+    curve_fq_sqr<Curve>(a, p.x);                  // A = X^2
+    curve_fq_sqr<Curve>(b, p.y);                  // B = Y^2
+    curve_fq_sqr<Curve>(c, b);                    // C = B^2
+
+    curve_fq_add<Curve>(t0, p.x, b);              // X + B
+    curve_fq_sqr<Curve>(t0, t0);                  // (X + B)^2
+    curve_fq_sub<Curve>(t0, t0, a);
+    curve_fq_sub<Curve>(t0, t0, c);
+    curve_fq_dbl<Curve>(d, t0);                   // D = 2((X + B)^2 - A - C)
+
+    curve_fq_dbl<Curve>(e, a);
+    curve_fq_add<Curve>(e, e, a);                 // E = 3A
+    curve_fq_sqr<Curve>(f, e);                    // F = E^2
+
+    curve_fq_dbl<Curve>(t0, d);
+    curve_fq_sub<Curve>(result.x, f, t0);         // X3 = F - 2D
+
+    curve_fq_sub<Curve>(t0, d, result.x);
+    curve_fq_mul<Curve>(t0, e, t0);               // E * (D - X3)
+    curve_fq_dbl<Curve>(t1, c);
+    curve_fq_dbl<Curve>(t1, t1);
+    curve_fq_dbl<Curve>(t1, t1);                  // 8C
+    CurveFq<Curve> y3;
+    curve_fq_sub<Curve>(y3, t0, t1);              // Y3 = E(D - X3) - 8C
+
+    curve_fq_mul<Curve>(t0, p.y, p.z);
+    curve_fq_dbl<Curve>(result.z, t0);            // Z3 = 2YZ
+
+    curve_fq_copy<Curve>(result.y, y3);
+}
+
+/**
+ * Point addition: result = p + q (general Jacobian + Jacobian)
+ *
+ * Uses the add-2007-bl formulas with identity and doubling handling.
+ */
+template <typename Curve>
+static inline void curve_point_add(
+    CurveJacobianPoint<Curve>& result,
+    const CurveJacobianPoint<Curve>& p,
+    const CurveJacobianPoint<Curve>& q
+) {
+    if (curve_point_is_identity<Curve>(p)) {
+        curve_point_copy<Curve>(result, q);
+        return;
+    }
+    if (curve_point_is_identity<Curve>(q)) {
+        curve_point_copy<Curve>(result, p);
+        return;
+    }
+
+    CurveFq<Curve> z1z1, z2z2, u1, u2, s1, s2;
+
+    curve_fq_sqr<Curve>(z1z1, p.z);               // Z1^2
+    curve_fq_sqr<Curve>(z2z2, q.z);               // Z2^2
+    curve_fq_mul<Curve>(u1, p.x, z2z2);           // U1 = X1 * Z2^2
+    curve_fq_mul<Curve>(u2, q.x, z1z1);           // U2 = X2 * Z1^2
+
+    curve_fq_mul<Curve>(s1, q.z, z2z2);
+    curve_fq_mul<Curve>(s1, p.y, s1);             // S1 = Y1 * Z2^3
+    curve_fq_mul<Curve>(s2, p.z, z1z1);
+    curve_fq_mul<Curve>(s2, q.y, s2);             // S2 = Y2 * Z1^3
+
+    if (curve_fq_equal<Curve>(u1, u2)) {
+        if (curve_fq_equal<Curve>(s1, s2)) {
+            curve_point_double<Curve>(result, p);
+        } else {
+            curve_point_set_identity<Curve>(result);
+        }
+        return;
+    }
+
+    CurveFq<Curve> h, i, j, r, v, t0, t1;
+
+    curve_fq_sub<Curve>(h, u2, u1);               // H = U2 - U1
+    curve_fq_dbl<Curve>(i, h);
+    curve_fq_sqr<Curve>(i, i);                    // I = (2H)^2
+    curve_fq_mul<Curve>(j, h, i);                 // J = H * I
+    curve_fq_sub<Curve>(r, s2, s1);
+    curve_fq_dbl<Curve>(r, r);                    // r = 2(S2 - S1)
+    curve_fq_mul<Curve>(v, u1, i);                // V = U1 * I
+
+    curve_fq_sqr<Curve>(t0, r);
+    curve_fq_sub<Curve>(t0, t0, j);
+    curve_fq_dbl<Curve>(t1, v);
+    curve_fq_sub<Curve>(result.x, t0, t1);        // X3 = r^2 - J - 2V
+
+    curve_fq_sub<Curve>(t0, v, result.x);
+    curve_fq_mul<Curve>(t0, r, t0);               // r * (V - X3)
+    curve_fq_mul<Curve>(t1, s1, j);
+    curve_fq_dbl<Curve>(t1, t1);                  // 2 * S1 * J
+    CurveFq<Curve> y3;
+    curve_fq_sub<Curve>(y3, t0, t1);              // Y3 = r(V - X3) - 2*S1*J
+
+    curve_fq_add<Curve>(t0, p.z, q.z);
+    curve_fq_sqr<Curve>(t0, t0);
+    curve_fq_sub<Curve>(t0, t0, z1z1);
+    curve_fq_sub<Curve>(t0, t0, z2z2);
+    curve_fq_mul<Curve>(result.z, t0, h);         // Z3 = ((Z1 + Z2)^2 - Z1^2 - Z2^2) * H
+
+    curve_fq_copy<Curve>(result.y, y3);
+}
+
+/**
+ * Mixed addition: result = p + q where q is affine (Z2 = 1)
+ *
+ * Uses the madd-2007-bl formulas, saving 4 multiplications over the
+ * general addition. This is the hot operation in bucket accumulation.
+ */
+template <typename Curve>
+static inline void curve_point_add_mixed(
+    CurveJacobianPoint<Curve>& result,
+    const CurveJacobianPoint<Curve>& p,
+    const CurveAffinePoint<Curve>& q
+) {
+    if (q.is_infinity) {
+        curve_point_copy<Curve>(result, p);
+        return;
+    }
+    if (curve_point_is_identity<Curve>(p)) {
+        curve_fq_copy<Curve>(result.x, q.x);
+        curve_fq_copy<Curve>(result.y, q.y);
+        curve_fq_one<Curve>(result.z);
+        return;
+    }
+
+    CurveFq<Curve> z1z1, u2, s2;
+
+    curve_fq_sqr<Curve>(z1z1, p.z);               // Z1^2
+    curve_fq_mul<Curve>(u2, q.x, z1z1);           // U2 = X2 * Z1^2
+    curve_fq_mul<Curve>(s2, p.z, z1z1);
+    curve_fq_mul<Curve>(s2, q.y, s2);             // S2 = Y2 * Z1^3
+
+    if (curve_fq_equal<Curve>(p.x, u2)) {
+        if (curve_fq_equal<Curve>(p.y, s2)) {
+            curve_point_double<Curve>(result, p);
+        } else {
+            curve_point_set_identity<Curve>(result);
+        }
+        return;
+    }
+
+    CurveFq<Curve> h, hh, i, j, r, v, t0, t1;
+
+    curve_fq_sub<Curve>(h, u2, p.x);              // H = U2 - X1
+    curve_fq_sqr<Curve>(hh, h);                   // HH = H^2
+    curve_fq_dbl<Curve>(i, hh);
+    curve_fq_dbl<Curve>(i, i);                    // I = 4 * HH
+    curve_fq_mul<Curve>(j, h, i);                 // J = H * I
+    curve_fq_sub<Curve>(r, s2, p.y);
+    curve_fq_dbl<Curve>(r, r);                    // r = 2(S2 - Y1)
+    curve_fq_mul<Curve>(v, p.x, i);               // V = X1 * I
+
+    curve_fq_sqr<Curve>(t0, r);
+    curve_fq_sub<Curve>(t0, t0, j);
+    curve_fq_dbl<Curve>(t1, v);
+    curve_fq_sub<Curve>(result.x, t0, t1);        // X3 = r^2 - J - 2V
+
+    curve_fq_sub<Curve>(t0, v, result.x);
+    curve_fq_mul<Curve>(t0, r, t0);               // r * (V - X3)
+    curve_fq_mul<Curve>(t1, p.y, j);
+    curve_fq_dbl<Curve>(t1, t1);                  // 2 * Y1 * J
+    CurveFq<Curve> y3;
+    curve_fq_sub<Curve>(y3, t0, t1);              // Y3 = r(V - X3) - 2*Y1*J
+
+    curve_fq_add<Curve>(t0, p.z, h);
+    curve_fq_sqr<Curve>(t0, t0);
+    curve_fq_sub<Curve>(t0, t0, z1z1);
+    curve_fq_sub<Curve>(result.z, t0, hh);        // Z3 = (Z1 + H)^2 - Z1^2 - HH
+
+    curve_fq_copy<Curve>(result.y, y3);
+}
+
+/**
+ * Load an affine point from a packed 2*LIMBS (x, y) buffer
+ *
+ * The point at infinity is encoded as x = y = 0 (not a valid curve
+ * point otherwise, since b != 0).
+ */
+template <typename Curve>
+static inline void curve_affine_from_limbs(CurveAffinePoint<Curve>& point, const uint64_t* limbs) {
+    memcpy(point.x.limbs, limbs, Curve::LIMBS * sizeof(uint64_t));
+    memcpy(point.y.limbs, limbs + Curve::LIMBS, Curve::LIMBS * sizeof(uint64_t));
+    point.is_infinity =
+        (curve_fq_is_zero<Curve>(point.x) && curve_fq_is_zero<Curve>(point.y)) ? 1 : 0;
+    point.padding = 0;
+}
+
+/**
+ * Check that an affine point satisfies y^2 = x^3 + b (Montgomery form)
+ *
+ * Input validation / debugging helper; the identity encoding passes.
+ */
+template <typename Curve>
+static inline bool curve_affine_on_curve(const CurveAffinePoint<Curve>& point) {
+    if (point.is_infinity) {
+        return true;
+    }
+
+    CurveFq<Curve> lhs, rhs, b;
+    curve_fq_sqr<Curve>(lhs, point.y);            // y^2
+    curve_fq_sqr<Curve>(rhs, point.x);
+    curve_fq_mul<Curve>(rhs, rhs, point.x);       // x^3
+    memcpy(b.limbs, Curve::B_MONT, sizeof(b.limbs));
+    curve_fq_add<Curve>(rhs, rhs, b);             // x^3 + b
+    return curve_fq_equal<Curve>(lhs, rhs);
+}
+
+// ============================================================================
+// Scalar windowing
+// ============================================================================
+
+/**
+ * Extract a window of bits from a 4-limb scalar
+ *
+ * Both supported curves have scalar fields under 256 bits, so scalars
+ * are 4 limbs regardless of the base field width.
+ */
+template <typename Curve>
+static inline uint32_t curve_scalar_get_window(const uint64_t* scalar, int window_index, int window_size) {
+    int start_bit = window_index * window_size;
+    uint32_t value = 0;
+
+    for (int i = 0; i < window_size && (start_bit + i) < 256; i++) {
+        int limb_index = (start_bit + i) / 64;
+        int bit_offset = (start_bit + i) % 64;
+        uint32_t bit = (uint32_t)((scalar[limb_index] >> bit_offset) & 1);
+        value |= bit << i;
+    }
+
+    return value;
+}
+
+#endif /* CURVE_OPS_H */
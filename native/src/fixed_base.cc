@@ -0,0 +1,206 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Fixed-base scalar multiplication tables
+ *
+ * Verifier-tier workloads multiply the same few generator points by
+ * fresh scalars at high rates; the general double-and-add path redoes
+ * ~254 doublings per call for a base that never changes. A fixed-base
+ * table precomputes d * 2^(w * window_size) * P for every window w and
+ * digit d, stored as affine points in one contiguous block, so a
+ * multiplication is one table lookup plus one mixed addition per
+ * window and no doublings at all.
+ *
+ * Table construction normalizes the Jacobian multiples to affine with
+ * one Montgomery-trick batch inversion (neon_batch_inverse), and tables
+ * serialize to a compact blob for reuse across processes.
+ *
+ * Requirements: 2.6, 4.6
+ */
+
+#include "../include/zk_accelerate.h"
+#include "../include/cpu_accelerate.h"
+#include "../include/perf_counters.h"
+#include "point_ops.h"
+
+#include <vector>
+#include <cstring>
+#include <chrono>
+
+// Serialized table header (little-endian, followed by the raw affine limbs)
+#define FIXED_BASE_MAGIC "ZKACCFBT"
+#define FIXED_BASE_VERSION 1
+
+struct FixedBaseHeader {
+    char magic[8];               // "ZKACCFBT"
+    uint32_t version;            // FIXED_BASE_VERSION
+    uint32_t window_size;        // Window size in bits
+    uint32_t num_windows;
+    uint32_t entries_per_window; // 2^window_size - 1
+};
+
+struct FixedBaseTable {
+    int window_size;
+    int num_windows;
+    size_t entries_per_window;
+
+    // entries[w * entries_per_window + (d - 1)] = d * 2^(w * window_size) * P,
+    // affine, 8 limbs each (x, y in Montgomery form)
+    std::vector<uint64_t> entries;
+};
+
+FixedBaseTable* fixed_base_table_create(const uint64_t* point, int window_size) {
+    if (point == nullptr || window_size < 2 || window_size > 16) {
+        return nullptr;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    FixedBaseTable* table = new FixedBaseTable();
+    table->window_size = window_size;
+    table->num_windows = (BN254_SCALAR_BITS + window_size - 1) / window_size;
+    table->entries_per_window = ((size_t)1 << window_size) - 1;
+
+    size_t total = (size_t)table->num_windows * table->entries_per_window;
+    table->entries.assign(total * 8, 0);
+
+    AffinePointG1 base;
+    affine_from_limbs(base, point);
+    if (base.is_infinity) {
+        // Every multiple of the identity is the identity; the all-zero
+        // table encodes that directly
+        return table;
+    }
+
+    // Jacobian multiples: entry d of window w is (d-1 entries back) + base_w,
+    // with base_w = 2^(w * window_size) * P carried across windows
+    std::vector<JacobianPointG1> multiples(total);
+    JacobianPointG1 window_base;
+    fq_copy(window_base.x, base.x);
+    fq_copy(window_base.y, base.y);
+    fq_one(window_base.z);
+
+    for (int w = 0; w < table->num_windows; w++) {
+        size_t offset = (size_t)w * table->entries_per_window;
+        point_copy(multiples[offset], window_base);
+        for (size_t d = 1; d < table->entries_per_window; d++) {
+            point_add(multiples[offset + d], multiples[offset + d - 1], window_base);
+        }
+
+        for (int k = 0; k < window_size; k++) {
+            point_double(window_base, window_base);
+        }
+    }
+
+    // Batch-normalize to affine: one Fermat inversion plus ~3 multiplies
+    // per point via Montgomery's trick
+    std::vector<uint64_t> zs(total * 4), z_invs(total * 4);
+    for (size_t i = 0; i < total; i++) {
+        memcpy(&zs[i * 4], multiples[i].z.limbs, 32);
+    }
+    neon_batch_inverse(zs.data(), BN254_FQ_MODULUS, BN254_FQ_MU, z_invs.data(), total, 4);
+
+    for (size_t i = 0; i < total; i++) {
+        if (point_is_identity(multiples[i])) {
+            continue;  // stays all-zero (the affine infinity encoding)
+        }
+
+        Fq zinv, zinv2, zinv3, x, y;
+        memcpy(zinv.limbs, &z_invs[i * 4], 32);
+        fq_sqr(zinv2, zinv);
+        fq_mul(zinv3, zinv2, zinv);
+        fq_mul(x, multiples[i].x, zinv2);
+        fq_mul(y, multiples[i].y, zinv3);
+        memcpy(&table->entries[i * 8], x.limbs, 32);
+        memcpy(&table->entries[i * 8 + 4], y.limbs, 32);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    perf_counters_record("fixed_base_table_create", std::chrono::duration<double, std::milli>(end - start).count());
+    return table;
+}
+
+bool fixed_base_mul(const FixedBaseTable* table, const uint64_t* scalar, uint64_t* result) {
+    if (table == nullptr || scalar == nullptr || result == nullptr) {
+        return false;
+    }
+
+    JacobianPointG1 acc;
+    point_set_identity(acc);
+
+    for (int w = 0; w < table->num_windows; w++) {
+        uint32_t digit = scalar_get_window(scalar, w, table->window_size);
+        if (digit == 0) {
+            continue;
+        }
+
+        AffinePointG1 entry;
+        affine_from_limbs(entry, table->entries.data() +
+                          ((size_t)w * table->entries_per_window + (digit - 1)) * 8);
+        point_add_mixed(acc, acc, entry);
+    }
+
+    memcpy(result, &acc, sizeof(JacobianPointG1));
+    return true;
+}
+
+size_t fixed_base_table_serialize_size(const FixedBaseTable* table) {
+    if (table == nullptr) {
+        return 0;
+    }
+    return sizeof(FixedBaseHeader) + table->entries.size() * sizeof(uint64_t);
+}
+
+bool fixed_base_table_serialize(const FixedBaseTable* table, uint8_t* out, size_t size) {
+    if (table == nullptr || out == nullptr || size < fixed_base_table_serialize_size(table)) {
+        return false;
+    }
+
+    FixedBaseHeader header;
+    memcpy(header.magic, FIXED_BASE_MAGIC, 8);
+    header.version = FIXED_BASE_VERSION;
+    header.window_size = (uint32_t)table->window_size;
+    header.num_windows = (uint32_t)table->num_windows;
+    header.entries_per_window = (uint32_t)table->entries_per_window;
+
+    memcpy(out, &header, sizeof(header));
+    memcpy(out + sizeof(header), table->entries.data(), table->entries.size() * sizeof(uint64_t));
+    return true;
+}
+
+FixedBaseTable* fixed_base_table_deserialize(const uint8_t* data, size_t size) {
+    if (data == nullptr || size < sizeof(FixedBaseHeader)) {
+        return nullptr;
+    }
+
+    FixedBaseHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, FIXED_BASE_MAGIC, 8) != 0 ||
+        header.version != FIXED_BASE_VERSION ||
+        header.window_size < 2 || header.window_size > 16) {
+        return nullptr;
+    }
+
+    int num_windows = (BN254_SCALAR_BITS + header.window_size - 1) / header.window_size;
+    size_t entries_per_window = ((size_t)1 << header.window_size) - 1;
+    if (header.num_windows != (uint32_t)num_windows ||
+        header.entries_per_window != (uint32_t)entries_per_window) {
+        return nullptr;
+    }
+
+    size_t total_limbs = (size_t)num_windows * entries_per_window * 8;
+    if (size < sizeof(header) + total_limbs * sizeof(uint64_t)) {
+        return nullptr;
+    }
+
+    FixedBaseTable* table = new FixedBaseTable();
+    table->window_size = (int)header.window_size;
+    table->num_windows = num_windows;
+    table->entries_per_window = entries_per_window;
+    table->entries.resize(total_limbs);
+    memcpy(table->entries.data(), data + sizeof(header), total_limbs * sizeof(uint64_t));
+    return table;
+}
+
+void fixed_base_table_destroy(FixedBaseTable* table) {
+    delete table;
+}
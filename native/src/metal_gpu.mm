@@ -10,10 +10,14 @@
 #import <Metal/Metal.h>
 #import <Foundation/Foundation.h>
 #include "../include/metal_gpu.h"
+#include "../include/perf_counters.h"
 #include <unordered_map>
 #include <string>
+#include <vector>
 #include <mutex>
 #include <atomic>
+#include <unistd.h>
+#include <dlfcn.h>
 
 // ============================================================================
 // Global State
@@ -48,11 +52,13 @@ static void debug_log(const char* format, ...) {
 // Initialization and Status
 // ============================================================================
 
+static void load_precompiled_pipelines(void);
+
 bool metal_gpu_init(void) {
     if (g_initialized) {
         return true;
     }
-    
+
     @autoreleasepool {
         // Get default Metal device
         g_device = MTLCreateSystemDefaultDevice();
@@ -80,7 +86,11 @@ bool metal_gpu_init(void) {
         debug_log("Metal GPU initialized: %s", [[g_device name] UTF8String]);
         debug_log("Unified memory: %s", [g_device hasUnifiedMemory] ? "yes" : "no");
         debug_log("Max threads per threadgroup: %lu", (unsigned long)[g_device maxThreadsPerThreadgroup].width);
-        
+
+        // Populate the pipeline cache from the shipped metallib so the
+        // MSM/NTT paths skip runtime MSL compilation
+        load_precompiled_pipelines();
+
         return true;
     }
 }
@@ -93,7 +103,11 @@ void metal_gpu_shutdown(void) {
     @autoreleasepool {
         // Clear pipeline cache
         metal_gpu_clear_shader_cache();
-        
+
+        // Release cached NTT plans, then pooled buffers
+        ntt_plan_cache_clear();
+        metal_gpu_pool_trim();
+
         // Release resources
         g_default_library = nil;
         g_command_queue = nil;
@@ -125,7 +139,7 @@ MetalGPUStatus metal_gpu_get_status(void) {
         status.device_available = (g_device != nil);
         status.unified_memory = [g_device hasUnifiedMemory];
         status.max_threads_per_group = (int)[g_device maxThreadsPerThreadgroup].width;
-        status.max_buffer_length = (int)[g_device maxBufferLength];
+        status.max_buffer_length = (int64_t)[g_device maxBufferLength];
         
         NSString* name = [g_device name];
         if (name != nil) {
@@ -141,11 +155,87 @@ MetalGPUStatus metal_gpu_get_status(void) {
 // Buffer Management
 // ============================================================================
 
+// Proving workloads allocate and free the same handful of buffer sizes
+// (point arrays, bucket arrays, twiddle tables) thousands of times per
+// proof. Freed buffers are parked in per-size-class free lists and
+// recycled on the next allocation instead of hitting the Metal allocator.
+
+// Maximum bytes held idle in the pool (override via ZK_ACCELERATE_POOL_MAX_MB)
+static const size_t kDefaultPoolMaxBytes = 256ULL * 1024 * 1024;
+
+static std::unordered_map<size_t, std::vector<GPUBuffer*>> g_buffer_pool;
+static std::mutex g_pool_mutex;
+static size_t g_pool_bytes = 0;
+static size_t g_pool_buffer_count = 0;
+static GPUPoolStats g_pool_stats = {};
+
+/**
+ * Round a requested size up to its pool size class (next power of two,
+ * 4 KB minimum so page-sized allocations share a class)
+ */
+static size_t pool_size_class(size_t size) {
+    size_t cls = 4096;
+    while (cls < size) {
+        cls <<= 1;
+    }
+    return cls;
+}
+
+static size_t pool_max_bytes(void) {
+    static size_t max_bytes = 0;
+    if (max_bytes == 0) {
+        max_bytes = kDefaultPoolMaxBytes;
+        const char* env = getenv("ZK_ACCELERATE_POOL_MAX_MB");
+        if (env != nullptr) {
+            long mb = atol(env);
+            if (mb >= 0) {
+                max_bytes = (size_t)mb * 1024 * 1024;
+            }
+        }
+    }
+    return max_bytes;
+}
+
+/**
+ * Release a buffer's MTLBuffer and handle without touching the pool
+ */
+static void buffer_release(GPUBuffer* buffer) {
+    @autoreleasepool {
+        if (buffer->ptr != nullptr) {
+            id<MTLBuffer> mtl_buffer = (__bridge_transfer id<MTLBuffer>)buffer->ptr;
+            mtl_buffer = nil; // Release
+        }
+        delete buffer;
+    }
+}
+
 GPUBuffer* metal_gpu_alloc_buffer(size_t size, bool shared) {
     if (!metal_gpu_is_available() || size == 0) {
         return nullptr;
     }
-    
+
+    size_t capacity = pool_size_class(size);
+
+    // Try to recycle an idle buffer of the same size class
+    {
+        std::lock_guard<std::mutex> lock(g_pool_mutex);
+        auto it = g_buffer_pool.find(capacity);
+        if (it != g_buffer_pool.end() && !it->second.empty()) {
+            GPUBuffer* buffer = it->second.back();
+            it->second.pop_back();
+            g_pool_bytes -= buffer->capacity;
+            g_pool_buffer_count--;
+            g_pool_stats.hits++;
+
+            buffer->size = size;
+            buffer->is_shared = shared;
+
+            debug_log("Recycled buffer %u: %zu bytes (class %zu)", buffer->id, size, capacity);
+            return buffer;
+        }
+        g_pool_stats.misses++;
+    }
+
     @autoreleasepool {
         MTLResourceOptions options;
         if (shared && [g_device hasUnifiedMemory]) {
@@ -155,21 +245,22 @@ GPUBuffer* metal_gpu_alloc_buffer(size_t size, bool shared) {
             // Use private memory for discrete GPU or when shared not requested
             options = MTLResourceStorageModeShared; // Always use shared on Apple Silicon
         }
-        
-        id<MTLBuffer> mtl_buffer = [g_device newBufferWithLength:size options:options];
+
+        id<MTLBuffer> mtl_buffer = [g_device newBufferWithLength:capacity options:options];
         if (mtl_buffer == nil) {
-            debug_log("Failed to allocate buffer of size %zu", size);
+            debug_log("Failed to allocate buffer of size %zu (class %zu)", size, capacity);
             return nullptr;
         }
-        
+
         GPUBuffer* buffer = new GPUBuffer();
         buffer->ptr = (__bridge_retained void*)mtl_buffer;
         buffer->size = size;
+        buffer->capacity = capacity;
         buffer->id = g_buffer_id_counter.fetch_add(1);
         buffer->is_shared = shared;
-        
-        debug_log("Allocated buffer %u: %zu bytes, shared=%d", buffer->id, size, shared);
-        
+
+        debug_log("Allocated buffer %u: %zu bytes (class %zu), shared=%d", buffer->id, size, capacity, shared);
+
         return buffer;
     }
 }
@@ -178,18 +269,87 @@ void metal_gpu_free_buffer(GPUBuffer* buffer) {
     if (buffer == nullptr) {
         return;
     }
-    
+
+    // Return the buffer to its size-class free list; fall back to a real
+    // free when the pool is at capacity or the buffer has no allocation
+    if (buffer->ptr != nullptr && buffer->capacity > 0) {
+        std::lock_guard<std::mutex> lock(g_pool_mutex);
+        if (g_pool_bytes + buffer->capacity <= pool_max_bytes()) {
+            g_buffer_pool[buffer->capacity].push_back(buffer);
+            g_pool_bytes += buffer->capacity;
+            g_pool_buffer_count++;
+            g_pool_stats.releases++;
+
+            debug_log("Pooled buffer %u (class %zu)", buffer->id, buffer->capacity);
+            return;
+        }
+        g_pool_stats.evictions++;
+    }
+
+    debug_log("Freed buffer %u", buffer->id);
+    buffer_release(buffer);
+}
+
+GPUBuffer* metal_gpu_wrap_external(void* data, size_t size) {
+    if (!metal_gpu_is_available() || data == nullptr || size == 0) {
+        return nullptr;
+    }
+
+    // newBufferWithBytesNoCopy requires page alignment and a page-multiple
+    // length; reject anything else so callers fall back to a staged copy
+    uintptr_t addr = (uintptr_t)data;
+    size_t page = (size_t)getpagesize();
+    if ((addr % page) != 0 || (size % page) != 0) {
+        debug_log("Cannot wrap external memory: not page-aligned (addr=%p, size=%zu)", data, size);
+        return nullptr;
+    }
+
     @autoreleasepool {
-        if (buffer->ptr != nullptr) {
-            id<MTLBuffer> mtl_buffer = (__bridge_transfer id<MTLBuffer>)buffer->ptr;
-            mtl_buffer = nil; // Release
+        id<MTLBuffer> mtl_buffer = [g_device newBufferWithBytesNoCopy:data
+                                                               length:size
+                                                              options:MTLResourceStorageModeShared
+                                                          deallocator:nil];
+        if (mtl_buffer == nil) {
+            debug_log("newBufferWithBytesNoCopy failed for %zu bytes", size);
+            return nullptr;
         }
-        
-        debug_log("Freed buffer %u", buffer->id);
-        delete buffer;
+
+        GPUBuffer* buffer = new GPUBuffer();
+        buffer->ptr = (__bridge_retained void*)mtl_buffer;
+        buffer->size = size;
+        buffer->capacity = 0; // External memory: never pooled
+        buffer->id = g_buffer_id_counter.fetch_add(1);
+        buffer->is_shared = true;
+
+        debug_log("Wrapped external memory as buffer %u: %zu bytes", buffer->id, size);
+
+        return buffer;
     }
 }
 
+GPUPoolStats metal_gpu_pool_stats(void) {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+    GPUPoolStats stats = g_pool_stats;
+    stats.buffers_pooled = g_pool_buffer_count;
+    stats.bytes_pooled = g_pool_bytes;
+    return stats;
+}
+
+void metal_gpu_pool_trim(void) {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+
+    for (auto& pair : g_buffer_pool) {
+        for (GPUBuffer* buffer : pair.second) {
+            buffer_release(buffer);
+        }
+    }
+    g_buffer_pool.clear();
+    g_pool_bytes = 0;
+    g_pool_buffer_count = 0;
+
+    debug_log("Buffer pool trimmed");
+}
+
 bool metal_gpu_copy_to_buffer(GPUBuffer* buffer, const void* data, size_t size, size_t offset) {
     if (buffer == nullptr || data == nullptr || buffer->ptr == nullptr) {
         return false;
@@ -207,8 +367,17 @@ bool metal_gpu_copy_to_buffer(GPUBuffer* buffer, const void* data, size_t size,
         if (contents == nullptr) {
             return false;
         }
-        
+
+        // Unified-memory fast path: a caller that produced its data in
+        // the buffer's own contents (metal_gpu_get_buffer_contents)
+        // already has it where the GPU reads it
+        if ((const uint8_t*)data == (uint8_t*)contents + offset) {
+            debug_log("Copy to buffer %u elided: source aliases contents", buffer->id);
+            return true;
+        }
+
         memcpy((uint8_t*)contents + offset, data, size);
+        perf_counters_add_transfer(size, 0);
         return true;
     }
 }
@@ -230,8 +399,16 @@ bool metal_gpu_copy_from_buffer(GPUBuffer* buffer, void* data, size_t size, size
         if (contents == nullptr) {
             return false;
         }
-        
+
+        // Unified-memory fast path: reading into the contents pointer
+        // itself means the caller is already looking at GPU output
+        if ((uint8_t*)data == (uint8_t*)contents + offset) {
+            debug_log("Copy from buffer %u elided: target aliases contents", buffer->id);
+            return true;
+        }
+
         memcpy(data, (uint8_t*)contents + offset, size);
+        perf_counters_add_transfer(0, size);
         return true;
     }
 }
@@ -316,6 +493,120 @@ GPUPipeline* metal_gpu_compile_shader(const char* source, const char* function_n
     }
 }
 
+/**
+ * Build pipeline states for every kernel in a loaded library and insert
+ * them into the cache. Kernels already cached (e.g. from an earlier
+ * metallib or a runtime compile) are left untouched.
+ */
+static int load_pipelines_from_library(id<MTLLibrary> library) {
+    int loaded = 0;
+
+    for (NSString* func_name in [library functionNames]) {
+        const char* name = [func_name UTF8String];
+
+        {
+            std::lock_guard<std::mutex> lock(g_cache_mutex);
+            if (g_pipeline_cache.find(name) != g_pipeline_cache.end()) {
+                continue;
+            }
+        }
+
+        id<MTLFunction> function = [library newFunctionWithName:func_name];
+        if (function == nil || [function functionType] != MTLFunctionTypeKernel) {
+            continue;
+        }
+
+        NSError* error = nil;
+        id<MTLComputePipelineState> pipeline_state = [g_device newComputePipelineStateWithFunction:function
+                                                                                            error:&error];
+        if (pipeline_state == nil) {
+            debug_log("Pipeline creation failed for precompiled %s: %s",
+                      name, [[error localizedDescription] UTF8String]);
+            continue;
+        }
+
+        GPUPipeline* pipeline = new GPUPipeline();
+        pipeline->pipeline = (__bridge_retained void*)pipeline_state;
+        pipeline->name = strdup(name);
+        pipeline->id = g_pipeline_id_counter.fetch_add(1);
+
+        {
+            std::lock_guard<std::mutex> lock(g_cache_mutex);
+            g_pipeline_cache[name] = pipeline;
+        }
+
+        debug_log("Loaded precompiled pipeline %u: %s", pipeline->id, name);
+        loaded++;
+    }
+
+    return loaded;
+}
+
+int metal_gpu_load_metallib(const char* path) {
+    // Checked against g_device directly: this runs from inside
+    // metal_gpu_init, before the availability flag settles
+    if (g_device == nil || path == nullptr) {
+        return 0;
+    }
+
+    @autoreleasepool {
+        NSError* error = nil;
+        NSURL* url = [NSURL fileURLWithPath:[NSString stringWithUTF8String:path]];
+        id<MTLLibrary> library = [g_device newLibraryWithURL:url error:&error];
+        if (library == nil) {
+            debug_log("Failed to load metallib %s: %s",
+                      path, [[error localizedDescription] UTF8String]);
+            return 0;
+        }
+
+        int loaded = load_pipelines_from_library(library);
+        debug_log("Loaded %d pipelines from %s", loaded, path);
+        return loaded;
+    }
+}
+
+/**
+ * Locate and load the shipped metallib at init. Runtime MSL compilation
+ * remains the fallback for any kernel the library does not provide.
+ */
+static void load_precompiled_pipelines(void) {
+    @autoreleasepool {
+        // Explicit override takes priority
+        const char* env_path = getenv("ZK_ACCELERATE_METALLIB");
+        if (env_path != nullptr && env_path[0] != '\0') {
+            metal_gpu_load_metallib(env_path);
+            return;
+        }
+
+        // Resolve candidate paths relative to the loaded addon binary
+        Dl_info info;
+        if (dladdr((const void*)&metal_gpu_init, &info) != 0 && info.dli_fname != nullptr) {
+            NSString* addon_dir = [[NSString stringWithUTF8String:info.dli_fname]
+                                   stringByDeletingLastPathComponent];
+            NSArray<NSString*>* candidates = @[
+                [addon_dir stringByAppendingPathComponent:@"zk_accelerate.metallib"],
+                [[addon_dir stringByAppendingPathComponent:
+                  @"../../native/compiled-shaders/zk_accelerate.metallib"] stringByStandardizingPath],
+                [[addon_dir stringByAppendingPathComponent:
+                  @"../../prebuilds/darwin-arm64/zk_accelerate.metallib"] stringByStandardizingPath],
+            ];
+
+            for (NSString* candidate in candidates) {
+                if ([[NSFileManager defaultManager] fileExistsAtPath:candidate]) {
+                    metal_gpu_load_metallib([candidate UTF8String]);
+                    return;
+                }
+            }
+        }
+
+        // Framework-bundled builds expose shaders through the default library
+        if (g_default_library != nil) {
+            int loaded = load_pipelines_from_library(g_default_library);
+            debug_log("Loaded %d pipelines from default library", loaded);
+        }
+    }
+}
+
 GPUPipeline* metal_gpu_get_cached_pipeline(const char* name) {
     if (name == nullptr) {
         return nullptr;
@@ -380,6 +671,219 @@ void metal_gpu_clear_shader_cache(void) {
     debug_log("Shader cache cleared");
 }
 
+// ============================================================================
+// GPU Stage Profiling
+// ============================================================================
+
+// Opt-in timestamp sampling around each compute encoder. A capture
+// carries one counter sample buffer per command buffer (two samples per
+// stage) plus a correlated CPU/GPU timestamp pair taken at submission;
+// resolution after completion converts GPU ticks to milliseconds and
+// folds each stage into a per-name aggregate. Without this, the
+// wall-clock execution_time_ms conflates queueing, transfer, and kernel
+// time and cannot attribute a regression to a stage.
+
+struct GPUStageAccum {
+    uint64_t count;
+    double gpu_ms;
+    double occupancy_sum;
+    uint32_t threads_per_group;
+    uint32_t max_threads_per_group;
+};
+
+static std::atomic<int> g_profiling_enabled{-1}; // -1: read env on first query
+static std::unordered_map<std::string, GPUStageAccum> g_stage_stats;
+static std::mutex g_profile_mutex;
+
+struct GPUProfileCapture {
+    id<MTLCounterSampleBuffer> sample_buffer;
+    std::vector<std::string> stages;
+    std::vector<double> occupancy;
+    std::vector<uint32_t> group_sizes;
+    std::vector<uint32_t> max_threads;
+    MTLTimestamp cpu_start;
+    MTLTimestamp gpu_start;
+};
+
+void metal_gpu_profiling_set_enabled(bool enabled) {
+    g_profiling_enabled.store(enabled ? 1 : 0);
+}
+
+bool metal_gpu_profiling_is_enabled(void) {
+    int enabled = g_profiling_enabled.load();
+    if (enabled < 0) {
+        const char* env = getenv("ZK_ACCELERATE_GPU_PROFILE");
+        enabled = (env != nullptr && (strcmp(env, "1") == 0 || strcmp(env, "true") == 0)) ? 1 : 0;
+        g_profiling_enabled.store(enabled);
+    }
+    return enabled == 1;
+}
+
+/**
+ * The device's timestamp counter set, or nil when stage-boundary
+ * sampling is unsupported
+ */
+static id<MTLCounterSet> profiling_counter_set(void) {
+    static id<MTLCounterSet> counter_set = nil;
+    static std::once_flag once;
+    std::call_once(once, []() {
+        if (![g_device supportsCounterSampling:MTLCounterSamplingPointAtStageBoundary]) {
+            debug_log("GPU profiling unavailable: no stage-boundary counter sampling");
+            return;
+        }
+        for (id<MTLCounterSet> set in [g_device counterSets]) {
+            if ([[set name] isEqualToString:MTLCommonCounterSetTimestamp]) {
+                counter_set = set;
+                return;
+            }
+        }
+        debug_log("GPU profiling unavailable: no timestamp counter set");
+    });
+    return counter_set;
+}
+
+/**
+ * Begin a capture for a command buffer with stage_count encoders
+ *
+ * Returns NULL when profiling is off or the device cannot sample at
+ * stage boundaries; the dispatch then runs unprofiled.
+ */
+static GPUProfileCapture* profile_capture_begin(size_t stage_count) {
+    if (!metal_gpu_profiling_is_enabled() || stage_count == 0) {
+        return nullptr;
+    }
+    id<MTLCounterSet> counter_set = profiling_counter_set();
+    if (counter_set == nil) {
+        return nullptr;
+    }
+
+    MTLCounterSampleBufferDescriptor* descriptor = [[MTLCounterSampleBufferDescriptor alloc] init];
+    descriptor.counterSet = counter_set;
+    descriptor.sampleCount = stage_count * 2;
+    descriptor.storageMode = MTLStorageModeShared;
+
+    NSError* error = nil;
+    id<MTLCounterSampleBuffer> sample_buffer =
+        [g_device newCounterSampleBufferWithDescriptor:descriptor error:&error];
+    if (sample_buffer == nil) {
+        debug_log("Counter sample buffer creation failed: %s",
+                  [[error localizedDescription] UTF8String]);
+        return nullptr;
+    }
+
+    GPUProfileCapture* capture = new GPUProfileCapture();
+    capture->sample_buffer = sample_buffer;
+    [g_device sampleTimestamps:&capture->cpu_start gpuTimestamp:&capture->gpu_start];
+    return capture;
+}
+
+/**
+ * Create the compute encoder for one stage, attaching its sample range
+ * when a capture is active
+ */
+static id<MTLComputeCommandEncoder> profile_capture_encoder(
+    GPUProfileCapture* capture,
+    id<MTLCommandBuffer> command_buffer,
+    const char* stage,
+    id<MTLComputePipelineState> pipeline_state,
+    size_t group_size
+) {
+    if (capture == nullptr) {
+        return [command_buffer computeCommandEncoder];
+    }
+
+    size_t index = capture->stages.size();
+    MTLComputePassDescriptor* descriptor = [MTLComputePassDescriptor computePassDescriptor];
+    MTLComputePassSampleBufferAttachmentDescriptor* attachment = descriptor.sampleBufferAttachments[0];
+    attachment.sampleBuffer = capture->sample_buffer;
+    attachment.startOfEncoderSampleIndex = index * 2;
+    attachment.endOfEncoderSampleIndex = index * 2 + 1;
+
+    uint32_t max_threads = (uint32_t)[pipeline_state maxTotalThreadsPerThreadgroup];
+    capture->stages.push_back(stage);
+    capture->group_sizes.push_back((uint32_t)group_size);
+    capture->max_threads.push_back(max_threads);
+    capture->occupancy.push_back(max_threads > 0 ? (double)group_size / (double)max_threads : 0.0);
+
+    return [command_buffer computeCommandEncoderWithDescriptor:descriptor];
+}
+
+/**
+ * Resolve a capture after its command buffer completed, fold the stage
+ * times into the aggregate, and free the capture
+ */
+static void profile_capture_finish(GPUProfileCapture* capture) {
+    if (capture == nullptr) {
+        return;
+    }
+
+    MTLTimestamp cpu_end = 0, gpu_end = 0;
+    [g_device sampleTimestamps:&cpu_end gpuTimestamp:&gpu_end];
+
+    // GPU timestamps tick in a device-specific unit; the correlated
+    // CPU/GPU pairs bracketing the dispatch give nanoseconds per tick
+    double ns_per_tick = 0.0;
+    if (gpu_end > capture->gpu_start && cpu_end > capture->cpu_start) {
+        ns_per_tick = (double)(cpu_end - capture->cpu_start) / (double)(gpu_end - capture->gpu_start);
+    }
+
+    NSData* resolved = [capture->sample_buffer
+                        resolveCounterRange:NSMakeRange(0, capture->stages.size() * 2)];
+    if (resolved != nil && ns_per_tick > 0.0) {
+        const MTLCounterResultTimestamp* samples = (const MTLCounterResultTimestamp*)[resolved bytes];
+        std::lock_guard<std::mutex> lock(g_profile_mutex);
+        for (size_t i = 0; i < capture->stages.size(); i++) {
+            uint64_t start = samples[i * 2].timestamp;
+            uint64_t end = samples[i * 2 + 1].timestamp;
+            if (start == MTLCounterErrorValue || end == MTLCounterErrorValue || end < start) {
+                continue;
+            }
+            double ms = (double)(end - start) * ns_per_tick / 1e6;
+
+            GPUStageAccum& accum = g_stage_stats[capture->stages[i]];
+            accum.count++;
+            accum.gpu_ms += ms;
+            accum.occupancy_sum += capture->occupancy[i];
+            accum.threads_per_group = capture->group_sizes[i];
+            accum.max_threads_per_group = capture->max_threads[i];
+
+            perf_counters_record(("gpu:" + capture->stages[i]).c_str(), ms);
+        }
+    }
+
+    delete capture;
+}
+
+size_t metal_gpu_profiling_snapshot(GPUStageStats* out, size_t max) {
+    if (out == nullptr) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(g_profile_mutex);
+    size_t written = 0;
+    for (const auto& entry : g_stage_stats) {
+        if (written >= max) {
+            break;
+        }
+        GPUStageStats& stats = out[written++];
+        strncpy(stats.stage, entry.first.c_str(), sizeof(stats.stage) - 1);
+        stats.stage[sizeof(stats.stage) - 1] = '\0';
+        stats.count = entry.second.count;
+        stats.gpu_ms = entry.second.gpu_ms;
+        stats.occupancy = entry.second.count > 0
+            ? entry.second.occupancy_sum / (double)entry.second.count
+            : 0.0;
+        stats.threads_per_group = entry.second.threads_per_group;
+        stats.max_threads_per_group = entry.second.max_threads_per_group;
+    }
+    return written;
+}
+
+void metal_gpu_profiling_reset(void) {
+    std::lock_guard<std::mutex> lock(g_profile_mutex);
+    g_stage_stats.clear();
+}
+
 // ============================================================================
 // Compute Dispatch
 // ============================================================================
@@ -413,17 +917,20 @@ GPUResult metal_gpu_dispatch(
             result.error_message = "Failed to create command buffer";
             return result;
         }
-        
-        // Create compute encoder
-        id<MTLComputeCommandEncoder> encoder = [command_buffer computeCommandEncoder];
+
+        // Create compute encoder (sampled at its boundaries when profiling)
+        GPUProfileCapture* capture = profile_capture_begin(1);
+        id<MTLComputeCommandEncoder> encoder =
+            profile_capture_encoder(capture, command_buffer, pipeline->name, pipeline_state, group_size);
         if (encoder == nil) {
             result.error_message = "Failed to create compute encoder";
+            delete capture;
             return result;
         }
-        
+
         // Set pipeline state
         [encoder setComputePipelineState:pipeline_state];
-        
+
         // Set buffers
         for (size_t i = 0; i < buffer_count; i++) {
             if (buffers[i] != nullptr && buffers[i]->ptr != nullptr) {
@@ -431,31 +938,34 @@ GPUResult metal_gpu_dispatch(
                 [encoder setBuffer:mtl_buffer offset:0 atIndex:i];
             }
         }
-        
+
         // Calculate grid and threadgroup sizes
         MTLSize grid = MTLSizeMake(grid_size, 1, 1);
         MTLSize threadgroup = MTLSizeMake(group_size, 1, 1);
-        
+
         // Dispatch
         [encoder dispatchThreads:grid threadsPerThreadgroup:threadgroup];
         [encoder endEncoding];
-        
+
         // Execute and wait
         CFAbsoluteTime start_time = CFAbsoluteTimeGetCurrent();
         [command_buffer commit];
         [command_buffer waitUntilCompleted];
         CFAbsoluteTime end_time = CFAbsoluteTimeGetCurrent();
-        
+
+        profile_capture_finish(capture);
+
         // Check for errors
         if ([command_buffer status] == MTLCommandBufferStatusError) {
             NSError* error = [command_buffer error];
             result.error_message = [[error localizedDescription] UTF8String];
             return result;
         }
-        
+
         result.success = true;
         result.execution_time_ms = (end_time - start_time) * 1000.0;
-        
+        perf_counters_record(pipeline->name, result.execution_time_ms);
+
         debug_log("Dispatch %s: grid=%zu, group=%zu, time=%.3fms",
                   pipeline->name, grid_size, group_size, result.execution_time_ms);
     }
@@ -463,6 +973,309 @@ GPUResult metal_gpu_dispatch(
     return result;
 }
 
+GPUResult metal_gpu_dispatch_passes(const GPUPass* passes, size_t pass_count) {
+    GPUResult result = {false, nullptr, 0.0};
+
+    if (!metal_gpu_is_available() || passes == nullptr || pass_count == 0) {
+        result.error_message = "Metal GPU not available or no passes";
+        return result;
+    }
+
+    for (size_t p = 0; p < pass_count; p++) {
+        if (passes[p].pipeline == nullptr || passes[p].pipeline->pipeline == nullptr) {
+            result.error_message = "Invalid pipeline in pass sequence";
+            return result;
+        }
+    }
+
+    @autoreleasepool {
+        id<MTLCommandBuffer> command_buffer = [g_command_queue commandBuffer];
+        if (command_buffer == nil) {
+            result.error_message = "Failed to create command buffer";
+            return result;
+        }
+
+        GPUProfileCapture* capture = profile_capture_begin(pass_count);
+
+        for (size_t p = 0; p < pass_count; p++) {
+            const GPUPass& pass = passes[p];
+            id<MTLComputePipelineState> pipeline_state = (__bridge id<MTLComputePipelineState>)pass.pipeline->pipeline;
+
+            // Clamp group size to pipeline maximum
+            size_t group_size = pass.group_size;
+            NSUInteger max_threads = [pipeline_state maxTotalThreadsPerThreadgroup];
+            if (group_size > max_threads) {
+                group_size = max_threads;
+            }
+
+            const char* stage = pass.label != nullptr ? pass.label : pass.pipeline->name;
+            id<MTLComputeCommandEncoder> encoder =
+                profile_capture_encoder(capture, command_buffer, stage, pipeline_state, group_size);
+            if (encoder == nil) {
+                result.error_message = "Failed to create compute encoder";
+                delete capture;
+                return result;
+            }
+
+            [encoder setComputePipelineState:pipeline_state];
+
+            for (size_t i = 0; i < pass.buffer_count; i++) {
+                if (pass.buffers[i] != nullptr && pass.buffers[i]->ptr != nullptr) {
+                    id<MTLBuffer> mtl_buffer = (__bridge id<MTLBuffer>)pass.buffers[i]->ptr;
+                    [encoder setBuffer:mtl_buffer offset:0 atIndex:i];
+                }
+            }
+
+            MTLSize grid = MTLSizeMake(pass.grid_size, 1, 1);
+            MTLSize threadgroup = MTLSizeMake(group_size, 1, 1);
+
+            [encoder dispatchThreads:grid threadsPerThreadgroup:threadgroup];
+            [encoder endEncoding];
+        }
+
+        // Execute and wait once for the whole sequence
+        CFAbsoluteTime start_time = CFAbsoluteTimeGetCurrent();
+        [command_buffer commit];
+        [command_buffer waitUntilCompleted];
+        CFAbsoluteTime end_time = CFAbsoluteTimeGetCurrent();
+
+        profile_capture_finish(capture);
+
+        if ([command_buffer status] == MTLCommandBufferStatusError) {
+            NSError* error = [command_buffer error];
+            result.error_message = [[error localizedDescription] UTF8String];
+            return result;
+        }
+
+        result.success = true;
+        result.execution_time_ms = (end_time - start_time) * 1000.0;
+
+        // Attribute the sequence to the first pass's kernel, which names
+        // the pipeline (e.g. the NTT bit-reverse or MSM init stage)
+        perf_counters_record(passes[0].pipeline->name, result.execution_time_ms);
+
+        debug_log("Dispatch sequence: passes=%zu, time=%.3fms", pass_count, result.execution_time_ms);
+    }
+
+    return result;
+}
+
+// ============================================================================
+// Asynchronous Dispatch
+// ============================================================================
+
+// Completion semaphore bounding the number of in-flight command buffers.
+// Two keeps the GPU busy on one batch while the host encodes the next;
+// ZK_ACCELERATE_MAX_IN_FLIGHT raises the depth for deeper pipelines.
+static dispatch_semaphore_t g_inflight_semaphore = nil;
+static std::once_flag g_inflight_once;
+
+static dispatch_semaphore_t inflight_semaphore(void) {
+    std::call_once(g_inflight_once, []() {
+        long depth = 2;
+        const char* env = getenv("ZK_ACCELERATE_MAX_IN_FLIGHT");
+        if (env != nullptr && atol(env) > 0) {
+            depth = atol(env);
+        }
+        g_inflight_semaphore = dispatch_semaphore_create(depth);
+    });
+    return g_inflight_semaphore;
+}
+
+GPUDispatchHandle* metal_gpu_dispatch_async(
+    GPUPipeline* pipeline,
+    GPUBuffer** buffers,
+    size_t buffer_count,
+    size_t grid_size,
+    size_t group_size
+) {
+    if (!metal_gpu_is_available() || pipeline == nullptr || pipeline->pipeline == nullptr) {
+        return nullptr;
+    }
+
+    // Throttle: block until an in-flight slot frees up
+    dispatch_semaphore_wait(inflight_semaphore(), DISPATCH_TIME_FOREVER);
+
+    @autoreleasepool {
+        id<MTLComputePipelineState> pipeline_state = (__bridge id<MTLComputePipelineState>)pipeline->pipeline;
+
+        NSUInteger max_threads = [pipeline_state maxTotalThreadsPerThreadgroup];
+        if (group_size > max_threads) {
+            group_size = max_threads;
+        }
+
+        id<MTLCommandBuffer> command_buffer = [g_command_queue commandBuffer];
+        if (command_buffer == nil) {
+            dispatch_semaphore_signal(inflight_semaphore());
+            return nullptr;
+        }
+
+        GPUProfileCapture* capture = profile_capture_begin(1);
+        id<MTLComputeCommandEncoder> encoder =
+            profile_capture_encoder(capture, command_buffer, pipeline->name, pipeline_state, group_size);
+        if (encoder == nil) {
+            dispatch_semaphore_signal(inflight_semaphore());
+            delete capture;
+            return nullptr;
+        }
+
+        [encoder setComputePipelineState:pipeline_state];
+
+        for (size_t i = 0; i < buffer_count; i++) {
+            if (buffers[i] != nullptr && buffers[i]->ptr != nullptr) {
+                id<MTLBuffer> mtl_buffer = (__bridge id<MTLBuffer>)buffers[i]->ptr;
+                [encoder setBuffer:mtl_buffer offset:0 atIndex:i];
+            }
+        }
+
+        MTLSize grid = MTLSizeMake(grid_size, 1, 1);
+        MTLSize threadgroup = MTLSizeMake(group_size, 1, 1);
+
+        [encoder dispatchThreads:grid threadsPerThreadgroup:threadgroup];
+        [encoder endEncoding];
+
+        // Free the in-flight slot as soon as the GPU finishes, regardless
+        // of when the caller gets around to waiting on the handle
+        [command_buffer addCompletedHandler:^(id<MTLCommandBuffer> cb) {
+            dispatch_semaphore_signal(inflight_semaphore());
+        }];
+
+        GPUDispatchHandle* handle = new GPUDispatchHandle();
+        handle->start_time = CFAbsoluteTimeGetCurrent();
+        handle->command_buffer = (__bridge_retained void*)command_buffer;
+        handle->profile = capture;
+
+        [command_buffer commit];
+
+        debug_log("Async dispatch %s: grid=%zu, group=%zu", pipeline->name, grid_size, group_size);
+
+        return handle;
+    }
+}
+
+bool metal_gpu_poll(GPUDispatchHandle* handle) {
+    if (handle == nullptr || handle->command_buffer == nullptr) {
+        return true;
+    }
+
+    @autoreleasepool {
+        id<MTLCommandBuffer> command_buffer = (__bridge id<MTLCommandBuffer>)handle->command_buffer;
+        MTLCommandBufferStatus status = [command_buffer status];
+        return status == MTLCommandBufferStatusCompleted || status == MTLCommandBufferStatusError;
+    }
+}
+
+GPUResult metal_gpu_wait(GPUDispatchHandle* handle) {
+    GPUResult result = {false, nullptr, 0.0};
+
+    if (handle == nullptr || handle->command_buffer == nullptr) {
+        result.error_message = "Invalid dispatch handle";
+        delete handle;
+        return result;
+    }
+
+    @autoreleasepool {
+        id<MTLCommandBuffer> command_buffer = (__bridge_transfer id<MTLCommandBuffer>)handle->command_buffer;
+        handle->command_buffer = nullptr;
+
+        [command_buffer waitUntilCompleted];
+        double end_time = CFAbsoluteTimeGetCurrent();
+
+        profile_capture_finish((GPUProfileCapture*)handle->profile);
+        handle->profile = nullptr;
+
+        if ([command_buffer status] == MTLCommandBufferStatusError) {
+            NSError* error = [command_buffer error];
+            result.error_message = [[error localizedDescription] UTF8String];
+        } else {
+            result.success = true;
+            result.execution_time_ms = (end_time - handle->start_time) * 1000.0;
+            perf_counters_record("dispatch_async", result.execution_time_ms);
+        }
+    }
+
+    delete handle;
+    return result;
+}
+
+GPUDispatchHandle* metal_gpu_dispatch_passes_async(const GPUPass* passes, size_t pass_count) {
+    if (!metal_gpu_is_available() || passes == nullptr || pass_count == 0) {
+        return nullptr;
+    }
+
+    for (size_t p = 0; p < pass_count; p++) {
+        if (passes[p].pipeline == nullptr || passes[p].pipeline->pipeline == nullptr) {
+            return nullptr;
+        }
+    }
+
+    // Throttle: block until an in-flight slot frees up
+    dispatch_semaphore_wait(inflight_semaphore(), DISPATCH_TIME_FOREVER);
+
+    @autoreleasepool {
+        id<MTLCommandBuffer> command_buffer = [g_command_queue commandBuffer];
+        if (command_buffer == nil) {
+            dispatch_semaphore_signal(inflight_semaphore());
+            return nullptr;
+        }
+
+        GPUProfileCapture* capture = profile_capture_begin(pass_count);
+
+        for (size_t p = 0; p < pass_count; p++) {
+            const GPUPass& pass = passes[p];
+            id<MTLComputePipelineState> pipeline_state = (__bridge id<MTLComputePipelineState>)pass.pipeline->pipeline;
+
+            // Clamp group size to pipeline maximum
+            size_t group_size = pass.group_size;
+            NSUInteger max_threads = [pipeline_state maxTotalThreadsPerThreadgroup];
+            if (group_size > max_threads) {
+                group_size = max_threads;
+            }
+
+            const char* stage = pass.label != nullptr ? pass.label : pass.pipeline->name;
+            id<MTLComputeCommandEncoder> encoder =
+                profile_capture_encoder(capture, command_buffer, stage, pipeline_state, group_size);
+            if (encoder == nil) {
+                dispatch_semaphore_signal(inflight_semaphore());
+                delete capture;
+                return nullptr;
+            }
+
+            [encoder setComputePipelineState:pipeline_state];
+
+            for (size_t i = 0; i < pass.buffer_count; i++) {
+                if (pass.buffers[i] != nullptr && pass.buffers[i]->ptr != nullptr) {
+                    id<MTLBuffer> mtl_buffer = (__bridge id<MTLBuffer>)pass.buffers[i]->ptr;
+                    [encoder setBuffer:mtl_buffer offset:0 atIndex:i];
+                }
+            }
+
+            MTLSize grid = MTLSizeMake(pass.grid_size, 1, 1);
+            MTLSize threadgroup = MTLSizeMake(group_size, 1, 1);
+
+            [encoder dispatchThreads:grid threadsPerThreadgroup:threadgroup];
+            [encoder endEncoding];
+        }
+
+        // Free the in-flight slot as soon as the GPU finishes, regardless
+        // of when the caller gets around to waiting on the handle
+        [command_buffer addCompletedHandler:^(id<MTLCommandBuffer> cb) {
+            dispatch_semaphore_signal(inflight_semaphore());
+        }];
+
+        GPUDispatchHandle* handle = new GPUDispatchHandle();
+        handle->start_time = CFAbsoluteTimeGetCurrent();
+        handle->command_buffer = (__bridge_retained void*)command_buffer;
+        handle->profile = capture;
+
+        [command_buffer commit];
+
+        debug_log("Async dispatch sequence: passes=%zu", pass_count);
+
+        return handle;
+    }
+}
+
 GPUResult metal_gpu_dispatch_2d(
     GPUPipeline* pipeline,
     GPUBuffer** buffers,
@@ -10,8 +10,15 @@
 #import <Metal/Metal.h>
 #import <Foundation/Foundation.h>
 #include "../include/metal_gpu.h"
+#include "../include/cpu_accelerate.h"
+#include "ntt_field.h"
+#include <array>
 #include <cstring>
 #include <cmath>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // ============================================================================
 // NTT Configuration
@@ -22,13 +29,22 @@ struct NTTConfig {
     uint32_t log_n;
     uint32_t stage;
     uint32_t batch_size;
-    uint32_t padding[4];
+    uint64_t modulus[4];
+    uint64_t mu;
+    uint64_t padding;
 };
 
 // ============================================================================
 // NTT Shader Source
 // ============================================================================
 
+/**
+ * Twiddle factors and n^-1 arrive in Montgomery form (w * R mod p) while
+ * the data buffer stays canonical throughout: the butterfly's Montgomery
+ * multiply cancels the R factor, montmul(w * R, v) = w * v. The modulus
+ * and its Montgomery constant mu travel in NTTConfig so one kernel
+ * serves any 4-limb prime field.
+ */
 static const char* NTT_SHADER_SOURCE = R"(
 #include <metal_stdlib>
 using namespace metal;
@@ -42,14 +58,9 @@ struct NTTConfig {
     uint32_t log_n;
     uint32_t stage;
     uint32_t batch_size;
-    uint32_t padding[4];
-};
-
-constant uint64_t BN254_MODULUS[4] = {
-    0x3C208C16D87CFD47ULL,
-    0x97816A916871CA8DULL,
-    0xB85045B68181585DULL,
-    0x30644E72E131A029ULL
+    uint64_t modulus[4];
+    uint64_t mu;
+    uint64_t padding;
 };
 
 inline bool field_gte(thread const FieldElement& a, constant const uint64_t* b) {
@@ -62,19 +73,20 @@ inline bool field_gte(thread const FieldElement& a, constant const uint64_t* b)
 
 inline void field_add(thread FieldElement& result,
                       thread const FieldElement& a,
-                      thread const FieldElement& b) {
+                      thread const FieldElement& b,
+                      constant const uint64_t* modulus) {
     uint64_t carry = 0;
     for (uint i = 0; i < 4; i++) {
         uint64_t sum = a.limbs[i] + b.limbs[i] + carry;
         carry = (sum < a.limbs[i]) || (carry && sum == a.limbs[i]) ? 1 : 0;
         result.limbs[i] = sum;
     }
-    
-    if (carry || field_gte(result, BN254_MODULUS)) {
+
+    if (carry || field_gte(result, modulus)) {
         uint64_t borrow = 0;
         for (uint i = 0; i < 4; i++) {
-            uint64_t diff = result.limbs[i] - BN254_MODULUS[i] - borrow;
-            borrow = (diff > result.limbs[i]) ? 1 : 0;
+            uint64_t diff = result.limbs[i] - modulus[i] - borrow;
+            borrow = (diff > result.limbs[i]) || (borrow && diff == result.limbs[i]) ? 1 : 0;
             result.limbs[i] = diff;
         }
     }
@@ -82,47 +94,100 @@ inline void field_add(thread FieldElement& result,
 
 inline void field_sub(thread FieldElement& result,
                       thread const FieldElement& a,
-                      thread const FieldElement& b) {
+                      thread const FieldElement& b,
+                      constant const uint64_t* modulus) {
     uint64_t borrow = 0;
     for (uint i = 0; i < 4; i++) {
         uint64_t diff = a.limbs[i] - b.limbs[i] - borrow;
-        borrow = (diff > a.limbs[i]) ? 1 : 0;
+        borrow = (diff > a.limbs[i]) || (borrow && diff == a.limbs[i]) ? 1 : 0;
         result.limbs[i] = diff;
     }
-    
+
     if (borrow) {
         uint64_t carry = 0;
         for (uint i = 0; i < 4; i++) {
-            uint64_t sum = result.limbs[i] + BN254_MODULUS[i] + carry;
-            carry = (sum < result.limbs[i]) ? 1 : 0;
+            uint64_t sum = result.limbs[i] + modulus[i] + carry;
+            carry = (sum < result.limbs[i]) || (carry && sum == result.limbs[i]) ? 1 : 0;
             result.limbs[i] = sum;
         }
     }
 }
 
-inline void field_copy(thread FieldElement& dst, thread const FieldElement& src) {
+inline void field_copy_from_device(thread FieldElement& dst, device const FieldElement& src) {
     for (uint i = 0; i < 4; i++) {
         dst.limbs[i] = src.limbs[i];
     }
 }
 
-inline void field_copy_from_device(thread FieldElement& dst, device const FieldElement& src) {
+inline void field_copy_to_device(device FieldElement& dst, thread const FieldElement& src) {
     for (uint i = 0; i < 4; i++) {
         dst.limbs[i] = src.limbs[i];
     }
 }
 
-inline void field_copy_to_device(device FieldElement& dst, thread const FieldElement& src) {
+// Montgomery multiplication: result = a * b * R^(-1) mod p
+// Same schoolbook-multiply-then-reduce construction as the MSM shader
+// field_mul, with mulhi() supplying the high limb; the modulus and mu
+// come from the dispatch config instead of compile-time constants.
+inline void field_mul(thread FieldElement& result,
+                      thread const FieldElement& a,
+                      thread const FieldElement& b,
+                      constant const uint64_t* modulus,
+                      uint64_t mu) {
+    uint64_t t[8];
+    for (uint i = 0; i < 8; i++) {
+        t[i] = 0;
+    }
+
     for (uint i = 0; i < 4; i++) {
-        dst.limbs[i] = src.limbs[i];
+        uint64_t carry = 0;
+        for (uint j = 0; j < 4; j++) {
+            uint64_t lo = a.limbs[i] * b.limbs[j];
+            uint64_t hi = mulhi(a.limbs[i], b.limbs[j]);
+
+            uint64_t s = t[i + j] + lo;
+            uint64_t c1 = (s < lo) ? 1 : 0;
+            uint64_t s2 = s + carry;
+            uint64_t c2 = (s2 < carry) ? 1 : 0;
+            t[i + j] = s2;
+            carry = hi + c1 + c2;
+        }
+        t[i + 4] = carry;
+    }
+
+    for (uint i = 0; i < 4; i++) {
+        uint64_t m = t[i] * mu;
+        uint64_t carry = 0;
+        for (uint j = 0; j < 4; j++) {
+            uint64_t lo = m * modulus[j];
+            uint64_t hi = mulhi(m, modulus[j]);
+
+            uint64_t s = t[i + j] + lo;
+            uint64_t c1 = (s < lo) ? 1 : 0;
+            uint64_t s2 = s + carry;
+            uint64_t c2 = (s2 < carry) ? 1 : 0;
+            t[i + j] = s2;
+            carry = hi + c1 + c2;
+        }
+        for (uint k = i + 4; k < 8 && carry != 0; k++) {
+            uint64_t s = t[k] + carry;
+            carry = (s < carry) ? 1 : 0;
+            t[k] = s;
+        }
     }
-}
 
-inline void field_mul_simple(thread FieldElement& result,
-                             thread const FieldElement& a,
-                             thread const FieldElement& b) {
-    // Placeholder: copy a (NOT correct math - full Montgomery mul needed)
-    field_copy(result, a);
+    for (uint i = 0; i < 4; i++) {
+        result.limbs[i] = t[i + 4];
+    }
+
+    if (field_gte(result, modulus)) {
+        uint64_t borrow = 0;
+        for (uint i = 0; i < 4; i++) {
+            uint64_t diff = result.limbs[i] - modulus[i] - borrow;
+            borrow = (diff > result.limbs[i]) || (borrow && diff == result.limbs[i]) ? 1 : 0;
+            result.limbs[i] = diff;
+        }
+    }
 }
 
 inline uint bit_reverse(uint index, uint log_n) {
@@ -193,13 +258,13 @@ kernel void ntt_butterfly(
     field_copy_from_device(u, data[idx1]);
     field_copy_from_device(v, data[idx2]);
     field_copy_from_device(twiddle, twiddles[twiddle_idx]);
-    
-    field_mul_simple(t, twiddle, v);
-    
+
+    field_mul(t, twiddle, v, config.modulus, config.mu);
+
     FieldElement sum, diff;
-    field_add(sum, u, t);
-    field_sub(diff, u, t);
-    
+    field_add(sum, u, t, config.modulus);
+    field_sub(diff, u, t, config.modulus);
+
     field_copy_to_device(data[idx1], sum);
     field_copy_to_device(data[idx2], diff);
 }
@@ -217,9 +282,9 @@ kernel void ntt_scale(
     FieldElement elem, scale, result;
     field_copy_from_device(elem, data[gid]);
     field_copy_from_device(scale, n_inv[0]);
-    
-    field_mul_simple(result, elem, scale);
-    
+
+    field_mul(result, scale, elem, config.modulus, config.mu);
+
     field_copy_to_device(data[gid], result);
 }
 )";
@@ -253,45 +318,49 @@ static size_t calculate_optimal_group_size(size_t n, int max_threads) {
 GPUResult metal_gpu_ntt_forward(
     GPUBuffer* data_buffer,
     GPUBuffer* twiddles_buffer,
-    size_t n
+    size_t n,
+    const uint64_t* modulus
 ) {
     GPUResult result = {false, nullptr, 0.0};
-    
+
     if (!metal_gpu_is_available()) {
         result.error_message = "Metal GPU not available";
         return result;
     }
-    
-    if (data_buffer == nullptr || twiddles_buffer == nullptr) {
+
+    if (data_buffer == nullptr || twiddles_buffer == nullptr || modulus == nullptr) {
         result.error_message = "Invalid buffer parameters";
         return result;
     }
-    
+
     // Validate n is power of 2
     if (n == 0 || (n & (n - 1)) != 0) {
         result.error_message = "NTT size must be a power of 2";
         return result;
     }
-    
+
     @autoreleasepool {
         uint32_t log_n = log2_floor((uint32_t)n);
-        
+
         // Compile shaders
         GPUPipeline* bit_reverse_pipeline = metal_gpu_compile_shader(NTT_SHADER_SOURCE, "ntt_bit_reverse");
         GPUPipeline* butterfly_pipeline = metal_gpu_compile_shader(NTT_SHADER_SOURCE, "ntt_butterfly");
-        
+
         if (!bit_reverse_pipeline || !butterfly_pipeline) {
             result.error_message = "Failed to compile NTT shaders";
             return result;
         }
-        
+
         // Create config buffer
         NTTConfig config;
         config.n = (uint32_t)n;
         config.log_n = log_n;
         config.stage = 0;
         config.batch_size = 1;
-        
+        memcpy(config.modulus, modulus, sizeof(config.modulus));
+        config.mu = ntt_compute_mu(modulus[0]);
+        config.padding = 0;
+
         GPUBuffer* config_buffer = metal_gpu_alloc_buffer(sizeof(NTTConfig), true);
         if (!config_buffer) {
             result.error_message = "Failed to allocate config buffer";
@@ -345,16 +414,17 @@ GPUResult metal_gpu_ntt_inverse(
     GPUBuffer* data_buffer,
     GPUBuffer* twiddles_inv_buffer,
     GPUBuffer* n_inv_buffer,
-    size_t n
+    size_t n,
+    const uint64_t* modulus
 ) {
     GPUResult result = {false, nullptr, 0.0};
-    
+
     if (!metal_gpu_is_available()) {
         result.error_message = "Metal GPU not available";
         return result;
     }
-    
-    if (data_buffer == nullptr || twiddles_inv_buffer == nullptr) {
+
+    if (data_buffer == nullptr || twiddles_inv_buffer == nullptr || modulus == nullptr) {
         result.error_message = "Invalid buffer parameters";
         return result;
     }
@@ -384,18 +454,21 @@ GPUResult metal_gpu_ntt_inverse(
         config.log_n = log_n;
         config.stage = 0;
         config.batch_size = 1;
-        
+        memcpy(config.modulus, modulus, sizeof(config.modulus));
+        config.mu = ntt_compute_mu(modulus[0]);
+        config.padding = 0;
+
         GPUBuffer* config_buffer = metal_gpu_alloc_buffer(sizeof(NTTConfig), true);
         if (!config_buffer) {
             result.error_message = "Failed to allocate config buffer";
             return result;
         }
-        
+
         MetalGPUStatus status = metal_gpu_get_status();
         size_t group_size = calculate_optimal_group_size(n, status.max_threads_per_group);
-        
+
         CFAbsoluteTime start_time = CFAbsoluteTimeGetCurrent();
-        
+
         // Step 1: Bit-reversal permutation
         metal_gpu_copy_to_buffer(config_buffer, &config, sizeof(NTTConfig), 0);
         {
@@ -407,7 +480,7 @@ GPUResult metal_gpu_ntt_inverse(
                 return result;
             }
         }
-        
+
         // Step 2: Butterfly stages with inverse twiddles
         for (uint32_t s = 1; s <= log_n; s++) {
             config.stage = s;
@@ -450,16 +523,17 @@ GPUResult metal_gpu_ntt_batch(
     GPUBuffer* twiddles_buffer,
     size_t n,
     size_t batch_size,
-    bool forward
+    bool forward,
+    const uint64_t* modulus
 ) {
     GPUResult result = {false, nullptr, 0.0};
-    
+
     if (!metal_gpu_is_available()) {
         result.error_message = "Metal GPU not available";
         return result;
     }
-    
-    if (data_buffer == nullptr || twiddles_buffer == nullptr) {
+
+    if (data_buffer == nullptr || twiddles_buffer == nullptr || modulus == nullptr) {
         result.error_message = "Invalid buffer parameters";
         return result;
     }
@@ -487,61 +561,282 @@ GPUResult metal_gpu_ntt_batch(
             return result;
         }
         
-        // Create config buffer
+        // Each stage reads a different NTTConfig, so every pass gets its
+        // own config buffer and the whole transform runs as one command
+        // buffer: one commit, one wait, instead of log_n+1 synchronous
+        // dispatches. The buffer pool makes the small configs cheap.
         NTTConfig config;
         config.n = (uint32_t)n;
         config.log_n = log_n;
         config.stage = 0;
         config.batch_size = (uint32_t)batch_size;
-        
-        GPUBuffer* config_buffer = metal_gpu_alloc_buffer(sizeof(NTTConfig), true);
-        if (!config_buffer) {
-            result.error_message = "Failed to allocate config buffer";
-            return result;
-        }
-        
+        memcpy(config.modulus, modulus, sizeof(config.modulus));
+        config.mu = ntt_compute_mu(modulus[0]);
+        config.padding = 0;
+
         MetalGPUStatus status = metal_gpu_get_status();
         size_t group_size = calculate_optimal_group_size(n, status.max_threads_per_group);
         size_t total_elements = n * batch_size;
-        
-        CFAbsoluteTime start_time = CFAbsoluteTimeGetCurrent();
-        
-        // Step 1: Bit-reversal permutation for all batches
-        metal_gpu_copy_to_buffer(config_buffer, &config, sizeof(NTTConfig), 0);
-        {
-            GPUBuffer* buffers[] = { data_buffer, config_buffer };
-            GPUResult br_result = metal_gpu_dispatch(bit_reverse_pipeline, buffers, 2, total_elements, group_size);
-            if (!br_result.success) {
-                result.error_message = br_result.error_message;
-                metal_gpu_free_buffer(config_buffer);
-                return result;
+        size_t num_butterflies = (n / 2) * batch_size;
+
+        std::vector<GPUBuffer*> config_buffers(log_n + 1, nullptr);
+        std::vector<GPUPass> passes;
+        std::vector<std::array<GPUBuffer*, 3>> pass_buffers(log_n + 1);
+        std::vector<std::string> stage_labels(log_n + 1);
+        passes.reserve(log_n + 1);
+
+        bool config_ok = true;
+        for (uint32_t s = 0; s <= log_n && config_ok; s++) {
+            config.stage = s;
+            config_buffers[s] = metal_gpu_alloc_buffer(sizeof(NTTConfig), true);
+            if (config_buffers[s] == nullptr) {
+                config_ok = false;
+                break;
             }
+            metal_gpu_copy_to_buffer(config_buffers[s], &config, sizeof(NTTConfig), 0);
         }
-        
-        // Step 2: Butterfly stages for all batches
-        for (uint32_t s = 1; s <= log_n; s++) {
-            config.stage = s;
-            metal_gpu_copy_to_buffer(config_buffer, &config, sizeof(NTTConfig), 0);
-            
-            GPUBuffer* buffers[] = { data_buffer, twiddles_buffer, config_buffer };
-            size_t num_butterflies = (n / 2) * batch_size;
-            GPUResult bf_result = metal_gpu_dispatch(butterfly_pipeline, buffers, 3, num_butterflies, group_size);
-            if (!bf_result.success) {
-                result.error_message = bf_result.error_message;
-                metal_gpu_free_buffer(config_buffer);
-                return result;
+
+        if (config_ok) {
+            // Pass 0: bit-reversal permutation for all batches
+            pass_buffers[0][0] = data_buffer;
+            pass_buffers[0][1] = config_buffers[0];
+            passes.push_back({ bit_reverse_pipeline, pass_buffers[0].data(), 2, total_elements, group_size });
+
+            // Passes 1..log_n: butterfly stages for all batches, each
+            // labeled so GPU stage profiles attribute time per stage
+            // rather than to the shared butterfly pipeline
+            for (uint32_t s = 1; s <= log_n; s++) {
+                pass_buffers[s][0] = data_buffer;
+                pass_buffers[s][1] = twiddles_buffer;
+                pass_buffers[s][2] = config_buffers[s];
+                stage_labels[s] = "ntt_butterfly_stage_" + std::to_string(s);
+                passes.push_back({ butterfly_pipeline, pass_buffers[s].data(), 3, num_butterflies, group_size, stage_labels[s].c_str() });
             }
+
+            GPUResult seq_result = metal_gpu_dispatch_passes(passes.data(), passes.size());
+            result.success = seq_result.success;
+            result.error_message = seq_result.error_message;
+            result.execution_time_ms = seq_result.execution_time_ms;
+        } else {
+            result.error_message = "Failed to allocate config buffer";
         }
-        
-        CFAbsoluteTime end_time = CFAbsoluteTimeGetCurrent();
-        
-        metal_gpu_free_buffer(config_buffer);
-        
+
+        for (uint32_t s = 0; s <= log_n; s++) {
+            if (config_buffers[s] != nullptr) {
+                metal_gpu_free_buffer(config_buffers[s]);
+            }
+        }
+    }
+
+    return result;
+}
+
+// ============================================================================
+// NTT Plan Cache
+// ============================================================================
+
+/**
+ * Host-side modular arithmetic over a generic 4-limb modulus, shared
+ * with the CPU NTT engine (ntt_field.h). Twiddle tables and n^-1 are
+ * computed and uploaded in Montgomery form, which is what the shader's
+ * Montgomery butterfly multiply consumes; the data buffers themselves
+ * stay canonical.
+ */
+
+static std::mutex g_plan_mutex;
+static std::unordered_map<std::string, NTTPlan*> g_plan_cache;
+
+static std::string ntt_plan_key(const uint64_t* modulus, const uint64_t* root_of_unity, size_t n) {
+    std::string key((const char*)modulus, 4 * sizeof(uint64_t));
+    key.append((const char*)root_of_unity, 4 * sizeof(uint64_t));
+    key.append((const char*)&n, sizeof(n));
+    return key;
+}
+
+static void ntt_plan_free(NTTPlan* plan) {
+    if (plan == nullptr) {
+        return;
+    }
+    metal_gpu_free_buffer(plan->twiddles);
+    metal_gpu_free_buffer(plan->twiddles_inv);
+    metal_gpu_free_buffer(plan->n_inv);
+    delete plan;
+}
+
+NTTPlan* ntt_plan_create(const uint64_t* modulus, const uint64_t* root_of_unity, size_t n) {
+    if (modulus == nullptr || root_of_unity == nullptr) {
+        return nullptr;
+    }
+    if (n < 2 || (n & (n - 1)) != 0 || !metal_gpu_is_available()) {
+        return nullptr;
+    }
+
+    std::string key = ntt_plan_key(modulus, root_of_unity, n);
+    {
+        std::lock_guard<std::mutex> lock(g_plan_mutex);
+        auto it = g_plan_cache.find(key);
+        if (it != g_plan_cache.end()) {
+            return it->second;
+        }
+    }
+
+    NttFieldCtx ctx;
+    ntt_field_ctx_init(ctx, modulus);
+
+    uint64_t w[4];
+    ntt_to_mont(ctx, root_of_unity, w);
+
+    // Verify the root has order n: w^n == 1 and w^(n/2) == -1
+    uint64_t n_limbs[4] = {(uint64_t)n, 0, 0, 0};
+    uint64_t half_n_limbs[4] = {(uint64_t)(n / 2), 0, 0, 0};
+    uint64_t check[4];
+    ntt_mont_pow(ctx, w, n_limbs, check);
+    if (memcmp(check, ctx.one, sizeof(check)) != 0) {
+        return nullptr;
+    }
+    ntt_mont_pow(ctx, w, half_n_limbs, check);
+    if (memcmp(check, ctx.one, sizeof(check)) == 0) {
+        return nullptr;
+    }
+
+    // Forward table: w^i, inverse table: w^-i = (w^(n-1))^i, kept in
+    // Montgomery form for the shader's Montgomery butterfly multiply
+    uint64_t n_minus_1[4] = {(uint64_t)(n - 1), 0, 0, 0};
+    uint64_t w_inv[4];
+    ntt_mont_pow(ctx, w, n_minus_1, w_inv);
+
+    size_t table_size = (n / 2) * 4 * sizeof(uint64_t);
+    std::vector<uint64_t> fwd(n / 2 * 4);
+    std::vector<uint64_t> inv(n / 2 * 4);
+
+    uint64_t t_fwd[4], t_inv[4];
+    memcpy(t_fwd, ctx.one, sizeof(t_fwd));
+    memcpy(t_inv, ctx.one, sizeof(t_inv));
+    for (size_t i = 0; i < n / 2; i++) {
+        memcpy(fwd.data() + i * 4, t_fwd, sizeof(t_fwd));
+        memcpy(inv.data() + i * 4, t_inv, sizeof(t_inv));
+        ntt_mont_mul(ctx, t_fwd, w, t_fwd);
+        ntt_mont_mul(ctx, t_inv, w_inv, t_inv);
+    }
+
+    // n^-1 = n^(modulus - 2) by Fermat, Montgomery form
+    uint64_t p_minus_2[4];
+    memcpy(p_minus_2, modulus, sizeof(p_minus_2));
+    p_minus_2[0] -= 2; // NTT moduli are odd primes > 2, no borrow
+    uint64_t n_mont[4], n_inv[4];
+    ntt_to_mont(ctx, n_limbs, n_mont);
+    ntt_mont_pow(ctx, n_mont, p_minus_2, n_inv);
+
+    NTTPlan* plan = new NTTPlan();
+    plan->n = (uint32_t)n;
+    memcpy(plan->modulus, modulus, sizeof(plan->modulus));
+    plan->mu = ctx.mu;
+    plan->twiddles = metal_gpu_alloc_buffer(table_size, true);
+    plan->twiddles_inv = metal_gpu_alloc_buffer(table_size, true);
+    plan->n_inv = metal_gpu_alloc_buffer(4 * sizeof(uint64_t), true);
+
+    if (plan->twiddles == nullptr || plan->twiddles_inv == nullptr || plan->n_inv == nullptr) {
+        ntt_plan_free(plan);
+        return nullptr;
+    }
+
+    metal_gpu_copy_to_buffer(plan->twiddles, fwd.data(), table_size, 0);
+    metal_gpu_copy_to_buffer(plan->twiddles_inv, inv.data(), table_size, 0);
+    metal_gpu_copy_to_buffer(plan->n_inv, n_inv, 4 * sizeof(uint64_t), 0);
+
+    std::lock_guard<std::mutex> lock(g_plan_mutex);
+    auto it = g_plan_cache.find(key);
+    if (it != g_plan_cache.end()) {
+        // Another thread built the same plan first; keep theirs
+        ntt_plan_free(plan);
+        return it->second;
+    }
+    g_plan_cache[key] = plan;
+    return plan;
+}
+
+GPUResult ntt_plan_execute(NTTPlan* plan, GPUBuffer* data_buffer, bool forward) {
+    GPUResult result = {false, nullptr, 0.0};
+
+    if (plan == nullptr || data_buffer == nullptr) {
+        result.error_message = "Invalid plan or buffer";
+        return result;
+    }
+
+    if (forward) {
+        return metal_gpu_ntt_forward(data_buffer, plan->twiddles, plan->n, plan->modulus);
+    }
+    return metal_gpu_ntt_inverse(data_buffer, plan->twiddles_inv, plan->n_inv, plan->n, plan->modulus);
+}
+
+GPUResult ntt_plan_execute_batch(NTTPlan* plan, GPUBuffer* data_buffer, size_t batch_size, bool forward) {
+    GPUResult result = {false, nullptr, 0.0};
+
+    if (plan == nullptr || data_buffer == nullptr) {
+        result.error_message = "Invalid plan or buffer";
+        return result;
+    }
+
+    if (batch_size == 0) {
         result.success = true;
-        result.execution_time_ms = (end_time - start_time) * 1000.0;
+        return result;
     }
-    
+
+    GPUBuffer* twiddles = forward ? plan->twiddles : plan->twiddles_inv;
+    result = metal_gpu_ntt_batch(data_buffer, twiddles, plan->n, batch_size, forward, plan->modulus);
+    if (!result.success) {
+        return result;
+    }
+
+    // Inverse transforms scale every element by n^-1 in one extra pass
+    if (!forward) {
+        GPUPipeline* scale_pipeline = metal_gpu_compile_shader(NTT_SHADER_SOURCE, "ntt_scale");
+        if (scale_pipeline == nullptr) {
+            result.success = false;
+            result.error_message = "Failed to compile NTT scale shader";
+            return result;
+        }
+
+        NTTConfig config;
+        config.n = plan->n;
+        config.log_n = log2_floor(plan->n);
+        config.stage = 0;
+        config.batch_size = (uint32_t)batch_size;
+        memcpy(config.modulus, plan->modulus, sizeof(config.modulus));
+        config.mu = plan->mu;
+        config.padding = 0;
+
+        GPUBuffer* config_buffer = metal_gpu_alloc_buffer(sizeof(NTTConfig), true);
+        if (config_buffer == nullptr) {
+            result.success = false;
+            result.error_message = "Failed to allocate config buffer";
+            return result;
+        }
+        metal_gpu_copy_to_buffer(config_buffer, &config, sizeof(NTTConfig), 0);
+
+        MetalGPUStatus status = metal_gpu_get_status();
+        size_t group_size = calculate_optimal_group_size(plan->n, status.max_threads_per_group);
+
+        GPUBuffer* buffers[] = { data_buffer, plan->n_inv, config_buffer };
+        GPUResult scale_result = metal_gpu_dispatch(
+            scale_pipeline, buffers, 3, (size_t)plan->n * batch_size, group_size);
+        metal_gpu_free_buffer(config_buffer);
+
+        if (!scale_result.success) {
+            return scale_result;
+        }
+        result.execution_time_ms += scale_result.execution_time_ms;
+    }
+
     return result;
 }
 
+void ntt_plan_cache_clear(void) {
+    std::lock_guard<std::mutex> lock(g_plan_mutex);
+    for (auto& entry : g_plan_cache) {
+        ntt_plan_free(entry.second);
+    }
+    g_plan_cache.clear();
+}
+
 #endif /* __APPLE__ */
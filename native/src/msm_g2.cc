@@ -0,0 +1,278 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Native Pippenger MSM over BN254 G2
+ *
+ * Full CPU Pippenger pipeline (scalar windowing, bucket accumulation,
+ * bucket reduction, window combination) over G2 points with Fp2
+ * coordinates, using the extension-field primitives in point_ops_g2.h.
+ * Mirrors the G1 engine in msm_execute.cc — same worker heuristic, same
+ * private bucket sets with a shared chunk cursor, same merge and
+ * combination stages — which is what moves G2 commitments off the
+ * JavaScript fallback onto the NEON Montgomery kernels.
+ *
+ * Requirements: 2.6, 4.6
+ */
+
+#include "../include/zk_accelerate.h"
+#include "../include/cpu_accelerate.h"
+#include "../include/perf_counters.h"
+#include "../include/autotune.h"
+#include "point_ops_g2.h"
+
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#ifdef __APPLE__
+#include <pthread.h>
+#endif
+
+/**
+ * Number of worker threads for the G2 MSM engine
+ *
+ * Same shape as the G1 engine heuristic: small inputs stay
+ * single-threaded, larger ones use one worker per core with the
+ * ZK_ACCELERATE_CPU_THREADS override, capped so every worker has enough
+ * points to amortize its private bucket set. G2 point operations cost
+ * roughly 3x their G1 counterparts, so the single-thread cutoff is
+ * lower.
+ */
+static int g2_msm_worker_count(size_t n) {
+    if (n < 1024) {
+        return 1;
+    }
+
+    int threads = detect_hardware_capabilities().cpu_cores;
+
+    const char* env = std::getenv("ZK_ACCELERATE_CPU_THREADS");
+    if (env != nullptr) {
+        int requested = std::atoi(env);
+        if (requested > 0) {
+            threads = requested;
+        }
+    }
+
+    size_t max_useful = n / 512;
+    if ((size_t)threads > max_useful) {
+        threads = (int)max_useful;
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    return threads;
+}
+
+static void g2_msm_worker_set_qos(void) {
+#ifdef __APPLE__
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+#endif
+}
+
+/**
+ * Multi-threaded bucket accumulation for one Pippenger window
+ *
+ * Workers pull fixed-size chunks of points from a shared atomic cursor
+ * and accumulate into private bucket sets; the private sets are then
+ * merged bucket-wise with the bucket range split across the same
+ * workers. Identical structure to msm_accumulate_window_mt in
+ * msm_execute.cc, over the G2 point type.
+ */
+static void g2_msm_accumulate_window_mt(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    int window,
+    int window_size,
+    int num_threads,
+    std::vector<JacobianPointG2>& buckets
+) {
+    size_t buckets_per_window = buckets.size();
+    const size_t chunk_size = 1024;
+
+    std::vector<std::vector<JacobianPointG2>> thread_buckets(num_threads);
+    for (int t = 0; t < num_threads; t++) {
+        thread_buckets[t].resize(buckets_per_window);
+        for (size_t b = 0; b < buckets_per_window; b++) {
+            g2_point_set_identity(thread_buckets[t][b]);
+        }
+    }
+
+    std::atomic<size_t> cursor(0);
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+
+    for (int t = 0; t < num_threads; t++) {
+        workers.emplace_back([&, t]() {
+            g2_msm_worker_set_qos();
+            std::vector<JacobianPointG2>& local = thread_buckets[t];
+
+            for (;;) {
+                size_t start = cursor.fetch_add(chunk_size, std::memory_order_relaxed);
+                if (start >= n) {
+                    break;
+                }
+                size_t end = start + chunk_size;
+                if (end > n) {
+                    end = n;
+                }
+
+                for (size_t i = start; i < end; i++) {
+                    uint32_t digit = scalar_get_window(scalars + i * 4, window, window_size);
+                    if (digit == 0) {
+                        continue;
+                    }
+
+                    AffinePointG2 point;
+                    g2_affine_from_limbs(point, points + i * 16);
+                    g2_point_add_mixed(local[digit - 1], local[digit - 1], point);
+                }
+            }
+        });
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // Merge private bucket sets, splitting the bucket range across workers
+    workers.clear();
+    size_t buckets_per_thread = (buckets_per_window + num_threads - 1) / num_threads;
+
+    for (int t = 0; t < num_threads; t++) {
+        workers.emplace_back([&, t]() {
+            g2_msm_worker_set_qos();
+            size_t start = (size_t)t * buckets_per_thread;
+            size_t end = start + buckets_per_thread;
+            if (end > buckets_per_window) {
+                end = buckets_per_window;
+            }
+
+            for (size_t b = start; b < end; b++) {
+                g2_point_set_identity(buckets[b]);
+                for (int s = 0; s < num_threads; s++) {
+                    g2_point_add(buckets[b], buckets[b], thread_buckets[s][b]);
+                }
+            }
+        });
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+/**
+ * CPU Pippenger MSM over G2
+ *
+ * points:  n affine points, 16 limbs each (x.c0, x.c1, y.c0, y.c1)
+ * scalars: n scalars, 4 limbs each (plain form)
+ * result:  Jacobian point, 24 limbs (x, y, z with c0, c1 each)
+ */
+static bool g2_msm_execute_cpu(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result,
+    int window_size
+) {
+    if (window_size <= 0) {
+        window_size = autotune_msm_window_size(n);
+    }
+    int num_windows = (BN254_SCALAR_BITS + window_size - 1) / window_size;
+    size_t buckets_per_window = ((size_t)1 << window_size) - 1;
+    int num_threads = g2_msm_worker_count(n);
+
+    std::vector<JacobianPointG2> window_sums(num_windows);
+    std::vector<JacobianPointG2> buckets(buckets_per_window);
+
+    for (int w = 0; w < num_windows; w++) {
+        if (num_threads > 1) {
+            g2_msm_accumulate_window_mt(points, scalars, n, w, window_size, num_threads, buckets);
+        } else {
+            // Reset buckets for this window
+            for (size_t b = 0; b < buckets_per_window; b++) {
+                g2_point_set_identity(buckets[b]);
+            }
+
+            // Bucket accumulation: route each point into its window bucket
+            for (size_t i = 0; i < n; i++) {
+                uint32_t digit = scalar_get_window(scalars + i * 4, w, window_size);
+                if (digit == 0) {
+                    continue;
+                }
+
+                AffinePointG2 point;
+                g2_affine_from_limbs(point, points + i * 16);
+                g2_point_add_mixed(buckets[digit - 1], buckets[digit - 1], point);
+            }
+        }
+
+        // Bucket reduction: running sum from the highest bucket down
+        // computes sum over b of (b+1) * bucket[b]
+        JacobianPointG2 running, sum;
+        g2_point_set_identity(running);
+        g2_point_set_identity(sum);
+
+        for (size_t b = buckets_per_window; b > 0; b--) {
+            g2_point_add(running, running, buckets[b - 1]);
+            g2_point_add(sum, sum, running);
+        }
+
+        window_sums[w] = sum;
+    }
+
+    // Window combination: result = sum over w of window_sums[w] * 2^(w * window_size)
+    JacobianPointG2 acc;
+    g2_point_set_identity(acc);
+
+    for (int w = num_windows - 1; w >= 0; w--) {
+        for (int k = 0; k < window_size; k++) {
+            g2_point_double(acc, acc);
+        }
+        g2_point_add(acc, acc, window_sums[w]);
+    }
+
+    memcpy(result, &acc, sizeof(JacobianPointG2));
+    return true;
+}
+
+// ============================================================================
+// Public entry points
+// ============================================================================
+
+bool msm_execute_g2(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result
+) {
+    return msm_execute_g2_with_window(points, scalars, n, result, 0);
+}
+
+bool msm_execute_g2_with_window(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    uint64_t* result,
+    int window_size
+) {
+    if (points == nullptr || scalars == nullptr || result == nullptr) {
+        return false;
+    }
+
+    if (n == 0) {
+        JacobianPointG2 identity;
+        g2_point_set_identity(identity);
+        memcpy(result, &identity, sizeof(JacobianPointG2));
+        return true;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool ok = g2_msm_execute_cpu(points, scalars, n, result, window_size);
+    auto end = std::chrono::steady_clock::now();
+    perf_counters_record("msm_execute_g2", std::chrono::duration<double, std::milli>(end - start).count());
+    return ok;
+}
@@ -0,0 +1,399 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Incremental MSM with persistent bucket state
+ *
+ * Maintains the Pippenger bucket state for a fixed point set across
+ * commitments, so a witness vector that changes in a few positions per
+ * block costs O(changes) bucket updates instead of a full O(n) MSM.
+ * The bucket layout and chunked reduction mirror the Metal MSM pipeline
+ * (metal_msm.mm): per-window unsigned-digit buckets, reduced in
+ * fixed-size chunks whose partial sums are cached, so a commit only
+ * re-reduces the chunks an update actually touched.
+ *
+ * Requirements: 2.6, 4.6
+ */
+
+#include "../include/zk_accelerate.h"
+#include "../include/cpu_accelerate.h"
+#include "../include/perf_counters.h"
+#include "../include/autotune.h"
+#include "point_ops.h"
+
+#include <vector>
+#include <cstring>
+#include <cstdlib>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#ifdef __APPLE__
+#include <pthread.h>
+#endif
+
+// Buckets per reduction chunk, matching the Metal bucket reduce
+static const size_t INC_CHUNK_SIZE = 256;
+
+// Serialized state header (little-endian, followed by the raw bucket limbs)
+#define MSM_INC_MAGIC "ZKACCINC"
+#define MSM_INC_VERSION 1
+
+struct MsmIncHeader {
+    char magic[8];               // "ZKACCINC"
+    uint32_t version;            // MSM_INC_VERSION
+    uint32_t window_size;        // Pippenger window size in bits
+    uint64_t n;                  // Number of points the state was built over
+    uint32_t num_windows;
+    uint32_t buckets_per_window;
+};
+
+struct MsmIncremental {
+    const uint64_t* points;      // Borrowed: n affine points, 8 limbs each
+    size_t n;
+    int window_size;
+    int num_windows;
+    size_t buckets_per_window;
+    size_t chunks_per_window;
+
+    // Persistent bucket state, window-major (the metal_msm.mm layout)
+    std::vector<JacobianPointG1> buckets;
+
+    // Cached chunk partials from the last commit: sum carries the
+    // position-weighted chunk reduction, total the plain bucket sum
+    // (the msm_bucket_reduce outputs)
+    std::vector<JacobianPointG1> chunk_sums;
+    std::vector<JacobianPointG1> chunk_totals;
+    std::vector<uint8_t> chunk_dirty;
+};
+
+/**
+ * Worker thread count for bulk load and chunk re-reduction
+ *
+ * Same shape as the MSM engine heuristic, keyed on the unit count of
+ * the pass at hand (points for the bulk load, chunks for commit).
+ */
+static int inc_worker_count(size_t units, size_t min_per_worker) {
+    if (units < min_per_worker * 2) {
+        return 1;
+    }
+
+    int threads = detect_hardware_capabilities().cpu_cores;
+
+    const char* env = std::getenv("ZK_ACCELERATE_CPU_THREADS");
+    if (env != nullptr) {
+        int requested = std::atoi(env);
+        if (requested > 0) {
+            threads = requested;
+        }
+    }
+
+    size_t max_useful = units / min_per_worker;
+    if ((size_t)threads > max_useful) {
+        threads = (int)max_useful;
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    return threads;
+}
+
+static void inc_worker_set_qos(void) {
+#ifdef __APPLE__
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+#endif
+}
+
+MsmIncremental* msm_incremental_create(
+    const uint64_t* points,
+    const uint64_t* scalars,
+    size_t n,
+    int window_size
+) {
+    if (points == nullptr || n == 0) {
+        return nullptr;
+    }
+    if (window_size <= 0) {
+        window_size = autotune_msm_window_size(n);
+    }
+    if (window_size < 2 || window_size > 16) {
+        return nullptr;
+    }
+
+    MsmIncremental* inc = new MsmIncremental();
+    inc->points = points;
+    inc->n = n;
+    inc->window_size = window_size;
+    inc->num_windows = (BN254_SCALAR_BITS + window_size - 1) / window_size;
+    inc->buckets_per_window = ((size_t)1 << window_size) - 1;
+    size_t chunk = inc->buckets_per_window < INC_CHUNK_SIZE ? inc->buckets_per_window : INC_CHUNK_SIZE;
+    inc->chunks_per_window = (inc->buckets_per_window + chunk - 1) / chunk;
+
+    size_t total_buckets = (size_t)inc->num_windows * inc->buckets_per_window;
+    size_t total_chunks = (size_t)inc->num_windows * inc->chunks_per_window;
+    inc->buckets.resize(total_buckets);
+    for (size_t b = 0; b < total_buckets; b++) {
+        point_set_identity(inc->buckets[b]);
+    }
+    inc->chunk_sums.resize(total_chunks);
+    inc->chunk_totals.resize(total_chunks);
+    inc->chunk_dirty.assign(total_chunks, 1);
+
+    // Bulk load: accumulate the initial scalar vector window by window,
+    // each worker owning whole windows so no bucket is shared
+    if (scalars != nullptr) {
+        int num_threads = inc_worker_count(n, 4096);
+        if (num_threads > inc->num_windows) {
+            num_threads = inc->num_windows;
+        }
+        std::atomic<int> window_cursor(0);
+
+        auto load_windows = [&]() {
+            inc_worker_set_qos();
+            for (;;) {
+                int w = window_cursor.fetch_add(1, std::memory_order_relaxed);
+                if (w >= inc->num_windows) {
+                    break;
+                }
+
+                JacobianPointG1* window_buckets = inc->buckets.data() + (size_t)w * inc->buckets_per_window;
+                for (size_t i = 0; i < n; i++) {
+                    uint32_t digit = scalar_get_window(scalars + i * 4, w, inc->window_size);
+                    if (digit == 0) {
+                        continue;
+                    }
+
+                    AffinePointG1 point;
+                    affine_from_limbs(point, points + i * 8);
+                    point_add_mixed(window_buckets[digit - 1], window_buckets[digit - 1], point);
+                }
+            }
+        };
+
+        if (num_threads > 1) {
+            std::vector<std::thread> workers;
+            workers.reserve(num_threads);
+            for (int t = 0; t < num_threads; t++) {
+                workers.emplace_back(load_windows);
+            }
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        } else {
+            load_windows();
+        }
+    }
+
+    return inc;
+}
+
+bool msm_incremental_update(
+    MsmIncremental* inc,
+    size_t index,
+    const uint64_t* old_scalar,
+    const uint64_t* new_scalar
+) {
+    if (inc == nullptr || old_scalar == nullptr || new_scalar == nullptr ||
+        index >= inc->n) {
+        return false;
+    }
+
+    AffinePointG1 point;
+    affine_from_limbs(point, inc->points + index * 8);
+
+    AffinePointG1 neg_point = point;
+    fq_neg(neg_point.y, point.y);
+
+    for (int w = 0; w < inc->num_windows; w++) {
+        uint32_t old_digit = scalar_get_window(old_scalar, w, inc->window_size);
+        uint32_t new_digit = scalar_get_window(new_scalar, w, inc->window_size);
+        if (old_digit == new_digit) {
+            continue;
+        }
+
+        size_t window_base = (size_t)w * inc->buckets_per_window;
+        size_t chunk_base = (size_t)w * inc->chunks_per_window;
+
+        if (old_digit != 0) {
+            size_t b = window_base + (old_digit - 1);
+            point_add_mixed(inc->buckets[b], inc->buckets[b], neg_point);
+            inc->chunk_dirty[chunk_base + (old_digit - 1) / INC_CHUNK_SIZE] = 1;
+        }
+        if (new_digit != 0) {
+            size_t b = window_base + (new_digit - 1);
+            point_add_mixed(inc->buckets[b], inc->buckets[b], point);
+            inc->chunk_dirty[chunk_base + (new_digit - 1) / INC_CHUNK_SIZE] = 1;
+        }
+    }
+
+    return true;
+}
+
+bool msm_incremental_commit(MsmIncremental* inc, uint64_t* result) {
+    if (inc == nullptr || result == nullptr) {
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Re-reduce dirty chunks, pulling chunk indices from a shared cursor.
+    // Walking a chunk [lo, hi) top-down with a running sum yields
+    // sum = Σ (i - lo + 1) * bucket[i] and total = Σ bucket[i], exactly
+    // like the msm_bucket_reduce kernel.
+    size_t total_chunks = (size_t)inc->num_windows * inc->chunks_per_window;
+    int num_threads = inc_worker_count(total_chunks, 8);
+    std::atomic<size_t> cursor(0);
+
+    auto reduce_chunks = [&]() {
+        inc_worker_set_qos();
+        for (;;) {
+            size_t c = cursor.fetch_add(1, std::memory_order_relaxed);
+            if (c >= total_chunks) {
+                break;
+            }
+            if (!inc->chunk_dirty[c]) {
+                continue;
+            }
+
+            size_t w = c / inc->chunks_per_window;
+            size_t chunk_index = c % inc->chunks_per_window;
+            size_t lo = chunk_index * INC_CHUNK_SIZE;
+            size_t hi = lo + INC_CHUNK_SIZE;
+            if (hi > inc->buckets_per_window) {
+                hi = inc->buckets_per_window;
+            }
+            size_t bucket_base = w * inc->buckets_per_window;
+
+            JacobianPointG1 running, sum;
+            point_set_identity(running);
+            point_set_identity(sum);
+
+            for (size_t i = hi; i > lo; i--) {
+                point_add(running, running, inc->buckets[bucket_base + i - 1]);
+                point_add(sum, sum, running);
+            }
+
+            inc->chunk_sums[c] = sum;
+            inc->chunk_totals[c] = running;
+            inc->chunk_dirty[c] = 0;
+        }
+    };
+
+    if (num_threads > 1) {
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+        for (int t = 0; t < num_threads; t++) {
+            workers.emplace_back(reduce_chunks);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    } else {
+        reduce_chunks();
+    }
+
+    // Combine chunk partials per window, re-weighting each chunk's total
+    // by its base bucket offset (the msm_window_reduce combine), then
+    // fold the windows Horner style.
+    JacobianPointG1 acc;
+    point_set_identity(acc);
+
+    for (int w = inc->num_windows - 1; w >= 0; w--) {
+        for (int k = 0; k < inc->window_size; k++) {
+            point_double(acc, acc);
+        }
+
+        JacobianPointG1 window_sum;
+        point_set_identity(window_sum);
+        size_t chunk_base = (size_t)w * inc->chunks_per_window;
+
+        for (size_t c = 0; c < inc->chunks_per_window; c++) {
+            point_add(window_sum, window_sum, inc->chunk_sums[chunk_base + c]);
+
+            uint32_t multiplier = (uint32_t)(c * INC_CHUNK_SIZE);
+            const JacobianPointG1& total = inc->chunk_totals[chunk_base + c];
+            if (multiplier != 0 && !point_is_identity(total)) {
+                JacobianPointG1 scaled;
+                point_set_identity(scaled);
+                for (int bit = 31; bit >= 0; bit--) {
+                    point_double(scaled, scaled);
+                    if ((multiplier >> bit) & 1) {
+                        point_add(scaled, scaled, total);
+                    }
+                }
+                point_add(window_sum, window_sum, scaled);
+            }
+        }
+
+        point_add(acc, acc, window_sum);
+    }
+
+    memcpy(result, &acc, sizeof(JacobianPointG1));
+
+    auto end = std::chrono::steady_clock::now();
+    perf_counters_record("msm_incremental_commit", std::chrono::duration<double, std::milli>(end - start).count());
+    return true;
+}
+
+size_t msm_incremental_serialize_size(const MsmIncremental* inc) {
+    if (inc == nullptr) {
+        return 0;
+    }
+    return sizeof(MsmIncHeader) + inc->buckets.size() * sizeof(JacobianPointG1);
+}
+
+bool msm_incremental_serialize(const MsmIncremental* inc, uint8_t* out, size_t size) {
+    if (inc == nullptr || out == nullptr || size < msm_incremental_serialize_size(inc)) {
+        return false;
+    }
+
+    MsmIncHeader header;
+    memcpy(header.magic, MSM_INC_MAGIC, 8);
+    header.version = MSM_INC_VERSION;
+    header.window_size = (uint32_t)inc->window_size;
+    header.n = inc->n;
+    header.num_windows = (uint32_t)inc->num_windows;
+    header.buckets_per_window = (uint32_t)inc->buckets_per_window;
+
+    memcpy(out, &header, sizeof(header));
+    memcpy(out + sizeof(header), inc->buckets.data(), inc->buckets.size() * sizeof(JacobianPointG1));
+    return true;
+}
+
+MsmIncremental* msm_incremental_deserialize(
+    const uint64_t* points,
+    size_t n,
+    const uint8_t* data,
+    size_t size
+) {
+    if (points == nullptr || data == nullptr || size < sizeof(MsmIncHeader)) {
+        return nullptr;
+    }
+
+    MsmIncHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, MSM_INC_MAGIC, 8) != 0 ||
+        header.version != MSM_INC_VERSION ||
+        header.n != n ||
+        header.window_size < 2 || header.window_size > 16) {
+        return nullptr;
+    }
+
+    MsmIncremental* inc = msm_incremental_create(points, nullptr, n, (int)header.window_size);
+    if (inc == nullptr) {
+        return nullptr;
+    }
+    if ((uint32_t)inc->num_windows != header.num_windows ||
+        (uint32_t)inc->buckets_per_window != header.buckets_per_window ||
+        size < sizeof(header) + inc->buckets.size() * sizeof(JacobianPointG1)) {
+        delete inc;
+        return nullptr;
+    }
+
+    memcpy(inc->buckets.data(), data + sizeof(header), inc->buckets.size() * sizeof(JacobianPointG1));
+    // Chunk caches are not serialized; create left every chunk dirty, so
+    // the first commit rebuilds them from the restored buckets
+    return inc;
+}
+
+void msm_incremental_destroy(MsmIncremental* inc) {
+    delete inc;
+}
@@ -0,0 +1,233 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Signed-digit scalar recoding for Pippenger MSM
+ *
+ * Converts raw scalars into signed windowed digits and per-window
+ * bucket entry arrays so the decomposition stage no longer runs as a
+ * serial JavaScript loop. Signed digits cover each window with half the
+ * buckets of the unsigned split (a point with a negative digit is
+ * subtracted, using the free curve negation (x, y) -> (x, -y)), which
+ * halves bucket memory and accumulate time per window. The entry layout
+ * matches the Metal MSM kernels, so the output can land directly in a
+ * GPU-shared buffer.
+ *
+ * Requirements: 2.6, 4.6
+ */
+
+#include "../include/zk_accelerate.h"
+#include "../include/arena.h"
+#include "point_ops.h"
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+#ifdef __APPLE__
+#include <pthread.h>
+#endif
+
+/**
+ * Worker thread count for the recoding passes
+ *
+ * Same shape as the MSM engine heuristic: small inputs stay
+ * single-threaded, larger ones use one worker per core with the
+ * ZK_ACCELERATE_CPU_THREADS override, capped so each worker keeps a
+ * useful share of the scalars.
+ */
+static int recode_worker_count(size_t n) {
+    if (n < 8192) {
+        return 1;
+    }
+
+    int threads = detect_hardware_capabilities().cpu_cores;
+
+    const char* env = std::getenv("ZK_ACCELERATE_CPU_THREADS");
+    if (env != nullptr) {
+        int requested = std::atoi(env);
+        if (requested > 0) {
+            threads = requested;
+        }
+    }
+
+    size_t max_useful = n / 4096;
+    if ((size_t)threads > max_useful) {
+        threads = (int)max_useful;
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    return threads;
+}
+
+static void recode_worker_set_qos(void) {
+#ifdef __APPLE__
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+#endif
+}
+
+int msm_signed_num_windows(int window_size) {
+    if (window_size < 2 || window_size > 16) {
+        return 0;
+    }
+    // The carry out of the top window can spill one extra digit
+    return (BN254_SCALAR_BITS + window_size - 1) / window_size + 1;
+}
+
+/**
+ * Recode one scalar into signed window digits
+ *
+ * Each unsigned window value above 2^(w-1) is replaced by its negative
+ * complement (value - 2^w) with a carry into the next window, keeping
+ * every digit in [-2^(w-1), 2^(w-1)]. The boundary value 2^(w-1) itself
+ * stays positive, so no digit magnitude exceeds the bucket range.
+ */
+static void recode_scalar_signed(
+    const uint64_t* scalar,
+    int window_size,
+    int num_windows,
+    int32_t* digits
+) {
+    int32_t half = (int32_t)1 << (window_size - 1);
+    int32_t full = (int32_t)1 << window_size;
+    int32_t carry = 0;
+
+    for (int w = 0; w < num_windows; w++) {
+        int32_t digit = (int32_t)scalar_get_window(scalar, w, window_size) + carry;
+
+        if (digit > half) {
+            digit -= full;
+            carry = 1;
+        } else {
+            carry = 0;
+        }
+
+        digits[w] = digit;
+    }
+}
+
+bool msm_recode_scalars(
+    const uint64_t* scalars,
+    size_t n,
+    int window_size,
+    MsmBucketEntry* entries,
+    uint32_t* entry_counts
+) {
+    int num_windows = msm_signed_num_windows(window_size);
+    if (scalars == nullptr || entries == nullptr || entry_counts == nullptr ||
+        num_windows == 0) {
+        return false;
+    }
+    if (n == 0) {
+        for (int w = 0; w < num_windows; w++) {
+            entry_counts[w] = 0;
+        }
+        return true;
+    }
+
+    int num_threads = recode_worker_count(n);
+
+    // Pass 1: recode every scalar into its digit row, split across
+    // workers by scalar chunks pulled from a shared cursor. Carries run
+    // along a single scalar's windows, so scalars are independent. The
+    // digit matrix is the big per-call temporary, so it draws from the
+    // session arena when one is installed.
+    int32_t* digits = (int32_t*)arena_scratch_alloc(n * (size_t)num_windows * sizeof(int32_t));
+    if (digits == nullptr) {
+        return false;
+    }
+    const size_t chunk_size = 1024;
+    std::atomic<size_t> cursor(0);
+
+    auto recode_range = [&]() {
+        recode_worker_set_qos();
+        for (;;) {
+            size_t start = cursor.fetch_add(chunk_size, std::memory_order_relaxed);
+            if (start >= n) {
+                break;
+            }
+            size_t end = start + chunk_size;
+            if (end > n) {
+                end = n;
+            }
+
+            for (size_t i = start; i < end; i++) {
+                recode_scalar_signed(
+                    scalars + i * 4, window_size, num_windows,
+                    digits + i * (size_t)num_windows);
+            }
+        }
+    };
+
+    if (num_threads > 1) {
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+        for (int t = 0; t < num_threads; t++) {
+            workers.emplace_back(recode_range);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    } else {
+        recode_range();
+    }
+
+    // Pass 2: gather each window's nonzero digits into its packed entry
+    // run at entries + w * n and sort by bucket so the accumulate stage
+    // walks contiguous runs. Windows are independent, so the window
+    // range is split across the same worker count.
+    std::atomic<int> window_cursor(0);
+
+    auto gather_windows = [&]() {
+        recode_worker_set_qos();
+        for (;;) {
+            int w = window_cursor.fetch_add(1, std::memory_order_relaxed);
+            if (w >= num_windows) {
+                break;
+            }
+
+            MsmBucketEntry* window_entries = entries + (size_t)w * n;
+            uint32_t count = 0;
+
+            for (size_t i = 0; i < n; i++) {
+                int32_t digit = digits[i * (size_t)num_windows + w];
+                if (digit == 0) {
+                    continue;
+                }
+
+                MsmBucketEntry& entry = window_entries[count++];
+                entry.point_index = (uint32_t)i;
+                entry.bucket_index = (uint32_t)((digit < 0 ? -digit : digit) - 1);
+                entry.window_index = (uint32_t)w;
+                entry.sign = digit < 0 ? 1 : 0;
+            }
+
+            std::sort(
+                window_entries, window_entries + count,
+                [](const MsmBucketEntry& a, const MsmBucketEntry& b) {
+                    if (a.bucket_index != b.bucket_index) {
+                        return a.bucket_index < b.bucket_index;
+                    }
+                    return a.point_index < b.point_index;
+                });
+
+            entry_counts[w] = count;
+        }
+    };
+
+    if (num_threads > 1) {
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+        for (int t = 0; t < num_threads; t++) {
+            workers.emplace_back(gather_windows);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    } else {
+        gather_windows();
+    }
+
+    arena_scratch_free(digits);
+    return true;
+}
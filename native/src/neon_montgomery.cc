@@ -3,9 +3,12 @@
  * NEON-Optimized Montgomery Multiplication
  *
  * Implements Montgomery multiplication using ARM NEON SIMD intrinsics
- * for parallel limb operations. Optimized for:
- * - 4-limb elements (BN254: 254 bits)
+ * for parallel limb operations. The core is templated over limb count
+ * with explicit instantiations for:
+ * - 1-limb elements (Goldilocks: 64 bits)
+ * - 4-limb elements (BN254, Pallas/Vesta: ~255 bits)
  * - 6-limb elements (BLS12-381: 381 bits)
+ * - 8-limb elements (512-bit headroom)
  *
  * Requirements: 1.4, 4.6, 6.6
  */
@@ -85,10 +88,8 @@ static inline int compare_limbs(
     return 0;
 }
 
-#if NEON_AVAILABLE
-
 /**
- * NEON-optimized multiplication of two 64-bit values
+ * 64x64->128 multiplication
  * Returns 128-bit result as (low, high)
  */
 static inline void mul64_neon(uint64_t a, uint64_t b, uint64_t* lo, uint64_t* hi) {
@@ -99,94 +100,88 @@ static inline void mul64_neon(uint64_t a, uint64_t b, uint64_t* lo, uint64_t* hi
 }
 
 /**
- * NEON-accelerated schoolbook multiplication for multi-limb numbers
- * Computes result = a * b (2*limb_count limbs output)
+ * Montgomery multiplication core, templated over limb count
+ *
+ * Computes result = a * b * R^(-1) mod modulus where R = 2^(64*LIMBS).
+ * The limb count is a compile-time constant so every loop has a constant
+ * trip count and the compiler fully unrolls the CIOS schoolbook and
+ * reduction passes for each width. Explicit widths in use:
+ *   1 limb  - Goldilocks
+ *   4 limbs - BN254, Pallas/Vesta
+ *   6 limbs - BLS12-381
+ *   8 limbs - 512-bit experimentation headroom
  */
-static void neon_schoolbook_mul(
+template <int LIMBS>
+static void montgomery_mul_limbs(
     const uint64_t* a,
     const uint64_t* b,
-    uint64_t* result,
-    int limb_count
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* result
 ) {
-    // Initialize result to zero
-    memset(result, 0, 2 * limb_count * sizeof(uint64_t));
-    
-    // Schoolbook multiplication with NEON-accelerated inner loop
-    for (int i = 0; i < limb_count; i++) {
+    // One extra limb: for moduli close to 2^64 per limb (e.g. Goldilocks)
+    // the intermediate a*b + m*p can carry out of 2*LIMBS limbs
+    uint64_t t[2 * LIMBS + 1];
+    memset(t, 0, sizeof(t));
+
+    // Schoolbook multiplication a * b
+    for (int i = 0; i < LIMBS; i++) {
         uint64_t carry = 0;
-        
-        for (int j = 0; j < limb_count; j++) {
+
+        for (int j = 0; j < LIMBS; j++) {
             uint64_t lo, hi;
             mul64_neon(a[i], b[j], &lo, &hi);
-            
-            // Add to result[i+j] with carry
-            __uint128_t sum = (__uint128_t)result[i + j] + lo + carry;
-            result[i + j] = (uint64_t)sum;
+
+            // Add to t[i+j] with carry
+            __uint128_t sum = (__uint128_t)t[i + j] + lo + carry;
+            t[i + j] = (uint64_t)sum;
             carry = hi + (uint64_t)(sum >> 64);
         }
-        
-        // Propagate final carry
-        int k = i + limb_count;
-        while (carry && k < 2 * limb_count) {
-            __uint128_t sum = (__uint128_t)result[k] + carry;
-            result[k] = (uint64_t)sum;
-            carry = (uint64_t)(sum >> 64);
-            k++;
-        }
+
+        t[i + LIMBS] = carry;
     }
-}
 
-/**
- * Montgomery reduction using NEON
- * Reduces a 2*limb_count number modulo p using Montgomery reduction
- */
-static void neon_montgomery_reduce(
-    uint64_t* t,           // Input: 2*limb_count limbs, modified in place
-    const uint64_t* modulus,
-    uint64_t mu,           // -p^(-1) mod 2^64
-    uint64_t* result,
-    int limb_count
-) {
-    // Montgomery reduction: for each limb i from 0 to limb_count-1:
+    // Montgomery reduction: for each limb i from 0 to LIMBS-1:
     //   m = t[i] * mu mod 2^64
     //   t = t + m * modulus * 2^(64*i)
-    // Then result = t >> (64 * limb_count)
-    
-    for (int i = 0; i < limb_count; i++) {
-        // Compute m = t[i] * mu mod 2^64
+    // Then result = t >> (64 * LIMBS)
+    for (int i = 0; i < LIMBS; i++) {
         uint64_t m = t[i] * mu;
-        
-        // Add m * modulus to t starting at position i
+
         uint64_t carry = 0;
-        for (int j = 0; j < limb_count; j++) {
+        for (int j = 0; j < LIMBS; j++) {
             uint64_t lo, hi;
             mul64_neon(m, modulus[j], &lo, &hi);
-            
+
             __uint128_t sum = (__uint128_t)t[i + j] + lo + carry;
             t[i + j] = (uint64_t)sum;
             carry = hi + (uint64_t)(sum >> 64);
         }
-        
-        // Propagate carry
-        int k = i + limb_count;
-        while (carry && k < 2 * limb_count) {
+
+        // Propagate carry through the upper limbs
+        for (int k = i + LIMBS; k < 2 * LIMBS + 1 && carry; k++) {
             __uint128_t sum = (__uint128_t)t[k] + carry;
             t[k] = (uint64_t)sum;
             carry = (uint64_t)(sum >> 64);
-            k++;
         }
     }
-    
+
     // Copy upper half to result
-    memcpy(result, t + limb_count, limb_count * sizeof(uint64_t));
-    
-    // Final reduction: if result >= modulus, subtract modulus
-    if (compare_limbs(result, modulus, limb_count) >= 0) {
-        sub_with_borrow(result, modulus, result, limb_count);
+    memcpy(result, t + LIMBS, LIMBS * sizeof(uint64_t));
+
+    // Final reduction: result < 2 * modulus, so at most one subtraction.
+    // The extra limb t[2*LIMBS] is the overflow bit for near-full moduli.
+    if (t[2 * LIMBS] != 0 || compare_limbs(result, modulus, LIMBS) >= 0) {
+        sub_with_borrow(result, modulus, result, LIMBS);
     }
 }
 
-#endif // NEON_AVAILABLE
+// Explicit instantiations so every supported width gets a fully unrolled
+// kernel regardless of which translation unit first references it
+template void montgomery_mul_limbs<1>(const uint64_t*, const uint64_t*, const uint64_t*, uint64_t, uint64_t*);
+template void montgomery_mul_limbs<4>(const uint64_t*, const uint64_t*, const uint64_t*, uint64_t, uint64_t*);
+template void montgomery_mul_limbs<6>(const uint64_t*, const uint64_t*, const uint64_t*, uint64_t, uint64_t*);
+template void montgomery_mul_limbs<8>(const uint64_t*, const uint64_t*, const uint64_t*, uint64_t, uint64_t*);
 
 /**
  * Montgomery multiplication using NEON for 4-limb elements (BN254)
@@ -201,128 +196,399 @@ void neon_montgomery_mul_4limb(
     uint64_t mu,
     uint64_t* result
 ) {
-#if NEON_AVAILABLE
-    // Temporary buffer for multiplication result (8 limbs)
-    uint64_t t[8];
-    
-    // Step 1: Schoolbook multiplication a * b
-    neon_schoolbook_mul(a, b, t, 4);
-    
-    // Step 2: Montgomery reduction
-    neon_montgomery_reduce(t, modulus, mu, result, 4);
-#else
-    // Fallback: scalar implementation
-    uint64_t t[8];
-    memset(t, 0, sizeof(t));
-    
-    // Schoolbook multiplication
-    for (int i = 0; i < 4; i++) {
-        uint64_t carry = 0;
-        for (int j = 0; j < 4; j++) {
-            __uint128_t product = (__uint128_t)a[i] * b[j] + t[i + j] + carry;
-            t[i + j] = (uint64_t)product;
-            carry = (uint64_t)(product >> 64);
+    montgomery_mul_limbs<4>(a, b, modulus, mu, result);
+}
+
+/**
+ * Montgomery multiplication using NEON for 6-limb elements (BLS12-381)
+ *
+ * Computes: result = (a * b * R^(-1)) mod modulus
+ * where R = 2^384 for 6-limb (384-bit) representation
+ */
+void neon_montgomery_mul_6limb(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* result
+) {
+    montgomery_mul_limbs<6>(a, b, modulus, mu, result);
+}
+
+/**
+ * Batch Montgomery multiplication using NEON
+ *
+ * Processes multiple Montgomery multiplications in parallel,
+ * leveraging NEON's ability to process multiple data elements.
+ */
+void neon_batch_montgomery_mul(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+) {
+    switch (limb_count) {
+        case 1:
+            // Goldilocks and other single-limb fields
+            for (size_t i = 0; i < count; i++) {
+                montgomery_mul_limbs<1>(a + i, b + i, modulus, mu, results + i);
+            }
+            break;
+        case 4:
+            // BN254, Pallas/Vesta
+            for (size_t i = 0; i < count; i++) {
+                montgomery_mul_limbs<4>(a + i * 4, b + i * 4, modulus, mu, results + i * 4);
+            }
+            break;
+        case 6:
+            // BLS12-381
+            for (size_t i = 0; i < count; i++) {
+                montgomery_mul_limbs<6>(a + i * 6, b + i * 6, modulus, mu, results + i * 6);
+            }
+            break;
+        case 8:
+            for (size_t i = 0; i < count; i++) {
+                montgomery_mul_limbs<8>(a + i * 8, b + i * 8, modulus, mu, results + i * 8);
+            }
+            break;
+        default:
+            // Unsupported limb count - zero output
+            memset(results, 0, count * limb_count * sizeof(uint64_t));
+            break;
+    }
+}
+
+/**
+ * Modular addition over generic limbs: result = (a + b) mod modulus
+ */
+template <int LIMBS>
+static inline void mod_add_limbs(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t* result
+) {
+    uint64_t carry = add_with_carry(a, b, result, LIMBS);
+    if (carry || compare_limbs(result, modulus, LIMBS) >= 0) {
+        sub_with_borrow(result, modulus, result, LIMBS);
+    }
+}
+
+/**
+ * Modular subtraction over generic limbs: result = (a - b) mod modulus
+ */
+template <int LIMBS>
+static inline void mod_sub_limbs(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t* result
+) {
+    if (sub_with_borrow(a, b, result, LIMBS)) {
+        add_with_carry(result, modulus, result, LIMBS);
+    }
+}
+
+/**
+ * Fp2 Montgomery multiplication core (Karatsuba over the extension)
+ *
+ * Elements of Fp2 = Fp[u]/(u^2 + 1) are 2*LIMBS limbs, c0 then c1, both
+ * components in Montgomery form. With u^2 = -1:
+ *   c0 = a0*b0 - a1*b1
+ *   c1 = (a0 + a1)(b0 + b1) - a0*b0 - a1*b1
+ * Three base-field Montgomery multiplications instead of four; the
+ * adds and subs stay in the modular range so no extra reduction is
+ * needed. u^2 + 1 is irreducible whenever p = 3 mod 4, which holds for
+ * both BN254 and BLS12-381.
+ */
+template <int LIMBS>
+static void fp2_montgomery_mul_limbs(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* result
+) {
+    uint64_t t0[LIMBS], t1[LIMBS], t2[LIMBS], sa[LIMBS], sb[LIMBS];
+
+    montgomery_mul_limbs<LIMBS>(a, b, modulus, mu, t0);                  // a0 * b0
+    montgomery_mul_limbs<LIMBS>(a + LIMBS, b + LIMBS, modulus, mu, t1);  // a1 * b1
+    mod_add_limbs<LIMBS>(a, a + LIMBS, modulus, sa);
+    mod_add_limbs<LIMBS>(b, b + LIMBS, modulus, sb);
+    montgomery_mul_limbs<LIMBS>(sa, sb, modulus, mu, t2);                // (a0 + a1)(b0 + b1)
+
+    mod_sub_limbs<LIMBS>(t0, t1, modulus, result);                       // c0
+    mod_sub_limbs<LIMBS>(t2, t0, modulus, t2);
+    mod_sub_limbs<LIMBS>(t2, t1, modulus, result + LIMBS);               // c1
+}
+
+/**
+ * Fp2 Montgomery squaring core (complex method)
+ *
+ * With u^2 = -1:
+ *   c0 = (a0 + a1)(a0 - a1)
+ *   c1 = 2 * a0 * a1
+ * Two base-field Montgomery multiplications.
+ */
+template <int LIMBS>
+static void fp2_montgomery_sqr_limbs(
+    const uint64_t* a,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* result
+) {
+    uint64_t sum[LIMBS], diff[LIMBS], prod[LIMBS];
+
+    mod_add_limbs<LIMBS>(a, a + LIMBS, modulus, sum);
+    mod_sub_limbs<LIMBS>(a, a + LIMBS, modulus, diff);
+    montgomery_mul_limbs<LIMBS>(a, a + LIMBS, modulus, mu, prod);
+
+    montgomery_mul_limbs<LIMBS>(sum, diff, modulus, mu, result);         // c0
+    mod_add_limbs<LIMBS>(prod, prod, modulus, result + LIMBS);           // c1
+}
+
+/**
+ * Batch Fp2 Montgomery multiplication
+ *
+ * Same contract as neon_batch_montgomery_mul over quadratic-extension
+ * elements: 2*limb_count limbs each, c0 then c1. limb_count selects the
+ * base field (4 for BN254, 6 for BLS12-381).
+ */
+void neon_batch_fp2_montgomery_mul(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+) {
+    switch (limb_count) {
+        case 4:
+            // BN254
+            for (size_t i = 0; i < count; i++) {
+                fp2_montgomery_mul_limbs<4>(a + i * 8, b + i * 8, modulus, mu, results + i * 8);
+            }
+            break;
+        case 6:
+            // BLS12-381
+            for (size_t i = 0; i < count; i++) {
+                fp2_montgomery_mul_limbs<6>(a + i * 12, b + i * 12, modulus, mu, results + i * 12);
+            }
+            break;
+        default:
+            // Unsupported limb count - zero output
+            memset(results, 0, count * limb_count * 2 * sizeof(uint64_t));
+            break;
+    }
+}
+
+/**
+ * Batch Fp2 Montgomery squaring
+ *
+ * Same layout as neon_batch_fp2_montgomery_mul with a single operand
+ * array; the complex method saves one base-field multiplication per
+ * element over the general product.
+ */
+void neon_batch_fp2_montgomery_sqr(
+    const uint64_t* a,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+) {
+    switch (limb_count) {
+        case 4:
+            for (size_t i = 0; i < count; i++) {
+                fp2_montgomery_sqr_limbs<4>(a + i * 8, modulus, mu, results + i * 8);
+            }
+            break;
+        case 6:
+            for (size_t i = 0; i < count; i++) {
+                fp2_montgomery_sqr_limbs<6>(a + i * 12, modulus, mu, results + i * 12);
+            }
+            break;
+        default:
+            memset(results, 0, count * limb_count * 2 * sizeof(uint64_t));
+            break;
+    }
+}
+
+/**
+ * Two-way interleaved Montgomery multiplication
+ *
+ * Runs two independent CIOS multiplications with every step
+ * interleaved, so the two carry chains overlap in the pipeline instead
+ * of serializing. This is the compute core of the SoA batch kernel: the
+ * layout gives it contiguous pair loads per limb plane, the
+ * interleaving gives it the instruction-level parallelism a single
+ * element's chain cannot.
+ */
+template <int LIMBS>
+static void montgomery_mul_limbs_x2(
+    const uint64_t* a0, const uint64_t* b0, uint64_t* r0,
+    const uint64_t* a1, const uint64_t* b1, uint64_t* r1,
+    const uint64_t* modulus,
+    uint64_t mu
+) {
+    uint64_t t0[2 * LIMBS + 1];
+    uint64_t t1[2 * LIMBS + 1];
+    memset(t0, 0, sizeof(t0));
+    memset(t1, 0, sizeof(t1));
+
+    for (int i = 0; i < LIMBS; i++) {
+        uint64_t carry0 = 0;
+        uint64_t carry1 = 0;
+
+        for (int j = 0; j < LIMBS; j++) {
+            uint64_t lo0, hi0, lo1, hi1;
+            mul64_neon(a0[i], b0[j], &lo0, &hi0);
+            mul64_neon(a1[i], b1[j], &lo1, &hi1);
+
+            __uint128_t sum0 = (__uint128_t)t0[i + j] + lo0 + carry0;
+            __uint128_t sum1 = (__uint128_t)t1[i + j] + lo1 + carry1;
+            t0[i + j] = (uint64_t)sum0;
+            t1[i + j] = (uint64_t)sum1;
+            carry0 = hi0 + (uint64_t)(sum0 >> 64);
+            carry1 = hi1 + (uint64_t)(sum1 >> 64);
         }
-        t[i + 4] = carry;
+
+        t0[i + LIMBS] = carry0;
+        t1[i + LIMBS] = carry1;
     }
-    
-    // Montgomery reduction
-    for (int i = 0; i < 4; i++) {
-        uint64_t m = t[i] * mu;
-        uint64_t carry = 0;
-        for (int j = 0; j < 4; j++) {
-            __uint128_t product = (__uint128_t)m * modulus[j] + t[i + j] + carry;
-            t[i + j] = (uint64_t)product;
-            carry = (uint64_t)(product >> 64);
+
+    for (int i = 0; i < LIMBS; i++) {
+        uint64_t m0 = t0[i] * mu;
+        uint64_t m1 = t1[i] * mu;
+
+        uint64_t carry0 = 0;
+        uint64_t carry1 = 0;
+        for (int j = 0; j < LIMBS; j++) {
+            uint64_t lo0, hi0, lo1, hi1;
+            mul64_neon(m0, modulus[j], &lo0, &hi0);
+            mul64_neon(m1, modulus[j], &lo1, &hi1);
+
+            __uint128_t sum0 = (__uint128_t)t0[i + j] + lo0 + carry0;
+            __uint128_t sum1 = (__uint128_t)t1[i + j] + lo1 + carry1;
+            t0[i + j] = (uint64_t)sum0;
+            t1[i + j] = (uint64_t)sum1;
+            carry0 = hi0 + (uint64_t)(sum0 >> 64);
+            carry1 = hi1 + (uint64_t)(sum1 >> 64);
         }
-        for (int k = i + 4; k < 8 && carry; k++) {
-            __uint128_t sum = (__uint128_t)t[k] + carry;
-            t[k] = (uint64_t)sum;
-            carry = (uint64_t)(sum >> 64);
+
+        for (int k = i + LIMBS; k < 2 * LIMBS + 1 && carry0; k++) {
+            __uint128_t sum = (__uint128_t)t0[k] + carry0;
+            t0[k] = (uint64_t)sum;
+            carry0 = (uint64_t)(sum >> 64);
         }
+        for (int k = i + LIMBS; k < 2 * LIMBS + 1 && carry1; k++) {
+            __uint128_t sum = (__uint128_t)t1[k] + carry1;
+            t1[k] = (uint64_t)sum;
+            carry1 = (uint64_t)(sum >> 64);
+        }
+    }
+
+    memcpy(r0, t0 + LIMBS, LIMBS * sizeof(uint64_t));
+    memcpy(r1, t1 + LIMBS, LIMBS * sizeof(uint64_t));
+
+    if (t0[2 * LIMBS] != 0 || compare_limbs(r0, modulus, LIMBS) >= 0) {
+        sub_with_borrow(r0, modulus, r0, LIMBS);
     }
-    
-    // Copy upper half
-    memcpy(result, t + 4, 4 * sizeof(uint64_t));
-    
-    // Final reduction
-    if (compare_limbs(result, modulus, 4) >= 0) {
-        sub_with_borrow(result, modulus, result, 4);
+    if (t1[2 * LIMBS] != 0 || compare_limbs(r1, modulus, LIMBS) >= 0) {
+        sub_with_borrow(r1, modulus, r1, LIMBS);
     }
-#endif
 }
 
 /**
- * Montgomery multiplication using NEON for 6-limb elements (BLS12-381)
+ * SoA batch core: limb planes in, limb planes out
  *
- * Computes: result = (a * b * R^(-1)) mod modulus
- * where R = 2^384 for 6-limb (384-bit) representation
+ * Elements i and i+1 sit adjacent within every plane, so the gathers
+ * and scatters below are contiguous pair accesses per limb instead of
+ * strided element hops across the whole batch.
  */
-void neon_montgomery_mul_6limb(
+template <int LIMBS>
+static void batch_montgomery_mul_soa_limbs(
     const uint64_t* a,
     const uint64_t* b,
     const uint64_t* modulus,
     uint64_t mu,
-    uint64_t* result
+    uint64_t* results,
+    size_t count
 ) {
-#if NEON_AVAILABLE
-    // Temporary buffer for multiplication result (12 limbs)
-    uint64_t t[12];
-    
-    // Step 1: Schoolbook multiplication a * b
-    neon_schoolbook_mul(a, b, t, 6);
-    
-    // Step 2: Montgomery reduction
-    neon_montgomery_reduce(t, modulus, mu, result, 6);
-#else
-    // Fallback: scalar implementation
-    uint64_t t[12];
-    memset(t, 0, sizeof(t));
-    
-    // Schoolbook multiplication
-    for (int i = 0; i < 6; i++) {
-        uint64_t carry = 0;
-        for (int j = 0; j < 6; j++) {
-            __uint128_t product = (__uint128_t)a[i] * b[j] + t[i + j] + carry;
-            t[i + j] = (uint64_t)product;
-            carry = (uint64_t)(product >> 64);
+    size_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        uint64_t a0[LIMBS], b0[LIMBS], r0[LIMBS];
+        uint64_t a1[LIMBS], b1[LIMBS], r1[LIMBS];
+
+        for (int j = 0; j < LIMBS; j++) {
+            a0[j] = a[j * count + i];
+            a1[j] = a[j * count + i + 1];
+            b0[j] = b[j * count + i];
+            b1[j] = b[j * count + i + 1];
+        }
+
+        montgomery_mul_limbs_x2<LIMBS>(a0, b0, r0, a1, b1, r1, modulus, mu);
+
+        for (int j = 0; j < LIMBS; j++) {
+            results[j * count + i] = r0[j];
+            results[j * count + i + 1] = r1[j];
         }
-        t[i + 6] = carry;
     }
-    
-    // Montgomery reduction
-    for (int i = 0; i < 6; i++) {
-        uint64_t m = t[i] * mu;
-        uint64_t carry = 0;
-        for (int j = 0; j < 6; j++) {
-            __uint128_t product = (__uint128_t)m * modulus[j] + t[i + j] + carry;
-            t[i + j] = (uint64_t)product;
-            carry = (uint64_t)(product >> 64);
+
+    // Odd tail
+    if (i < count) {
+        uint64_t ta[LIMBS], tb[LIMBS], tr[LIMBS];
+        for (int j = 0; j < LIMBS; j++) {
+            ta[j] = a[j * count + i];
+            tb[j] = b[j * count + i];
         }
-        for (int k = i + 6; k < 12 && carry; k++) {
-            __uint128_t sum = (__uint128_t)t[k] + carry;
-            t[k] = (uint64_t)sum;
-            carry = (uint64_t)(sum >> 64);
+        montgomery_mul_limbs<LIMBS>(ta, tb, modulus, mu, tr);
+        for (int j = 0; j < LIMBS; j++) {
+            results[j * count + i] = tr[j];
         }
     }
-    
-    // Copy upper half
-    memcpy(result, t + 6, 6 * sizeof(uint64_t));
-    
-    // Final reduction
-    if (compare_limbs(result, modulus, 6) >= 0) {
-        sub_with_borrow(result, modulus, result, 6);
+}
+
+void neon_soa_from_elements(
+    const uint64_t* elements,
+    uint64_t* soa,
+    size_t count,
+    int limb_count
+) {
+    for (size_t i = 0; i < count; i++) {
+        for (int j = 0; j < limb_count; j++) {
+            soa[(size_t)j * count + i] = elements[i * limb_count + j];
+        }
+    }
+}
+
+void neon_soa_to_elements(
+    const uint64_t* soa,
+    uint64_t* elements,
+    size_t count,
+    int limb_count
+) {
+    for (size_t i = 0; i < count; i++) {
+        for (int j = 0; j < limb_count; j++) {
+            elements[i * limb_count + j] = soa[(size_t)j * count + i];
+        }
     }
-#endif
 }
 
 /**
- * Batch Montgomery multiplication using NEON
+ * Batch Montgomery multiplication over SoA limb planes
  *
- * Processes multiple Montgomery multiplications in parallel,
- * leveraging NEON's ability to process multiple data elements.
+ * Same contract as neon_batch_montgomery_mul, but operands and results
+ * are stored as limb_count parallel planes of count limbs each (limb j
+ * of element i at index j * count + i). Processes two elements per step
+ * with interleaved carry chains; callers that keep their data in planes
+ * across a pipeline of batch calls skip the conversion cost entirely.
  */
-void neon_batch_montgomery_mul(
+void neon_batch_montgomery_mul_soa(
     const uint64_t* a,
     const uint64_t* b,
     const uint64_t* modulus,
@@ -331,30 +597,174 @@ void neon_batch_montgomery_mul(
     size_t count,
     int limb_count
 ) {
-    if (limb_count == 4) {
-        // Process 4-limb elements
-        for (size_t i = 0; i < count; i++) {
-            neon_montgomery_mul_4limb(
-                a + i * 4,
-                b + i * 4,
-                modulus,
-                mu,
-                results + i * 4
-            );
+    switch (limb_count) {
+        case 1:
+            // Single-limb planes coincide with the AoS layout
+            neon_batch_montgomery_mul(a, b, modulus, mu, results, count, 1);
+            break;
+        case 4:
+            batch_montgomery_mul_soa_limbs<4>(a, b, modulus, mu, results, count);
+            break;
+        case 6:
+            batch_montgomery_mul_soa_limbs<6>(a, b, modulus, mu, results, count);
+            break;
+        case 8:
+            batch_montgomery_mul_soa_limbs<8>(a, b, modulus, mu, results, count);
+            break;
+        default:
+            memset(results, 0, count * limb_count * sizeof(uint64_t));
+            break;
+    }
+}
+
+/**
+ * Check whether a multi-limb value is zero
+ */
+static inline bool limbs_is_zero(const uint64_t* a, int limb_count) {
+    for (int i = 0; i < limb_count; i++) {
+        if (a[i] != 0) {
+            return false;
         }
-    } else if (limb_count == 6) {
-        // Process 6-limb elements
-        for (size_t i = 0; i < count; i++) {
-            neon_montgomery_mul_6limb(
-                a + i * 6,
-                b + i * 6,
-                modulus,
-                mu,
-                results + i * 6
-            );
+    }
+    return true;
+}
+
+/**
+ * Compute R mod modulus, the Montgomery representation of one, where
+ * R = 2^(64*LIMBS). Built by doubling 1 modulo the modulus 64*LIMBS
+ * times; the cost is negligible next to the inversion it supports.
+ */
+template <int LIMBS>
+static void montgomery_one_limbs(const uint64_t* modulus, uint64_t* one) {
+    memset(one, 0, LIMBS * sizeof(uint64_t));
+    one[0] = 1;
+
+    for (int i = 0; i < 64 * LIMBS; i++) {
+        uint64_t carry = add_with_carry(one, one, one, LIMBS);
+        if (carry != 0 || compare_limbs(one, modulus, LIMBS) >= 0) {
+            sub_with_borrow(one, modulus, one, LIMBS);
         }
-    } else {
-        // Unsupported limb count - zero output
-        memset(results, 0, count * limb_count * sizeof(uint64_t));
+    }
+}
+
+/**
+ * Montgomery exponentiation by square-and-multiply (MSB first)
+ *
+ * base and result are in Montgomery form; the exponent is a plain
+ * multi-limb integer. Used for the single Fermat inversion
+ * (a^(p-2) mod p) at the pivot of the batch-inverse pass.
+ */
+template <int LIMBS>
+static void montgomery_pow_limbs(
+    const uint64_t* base,
+    const uint64_t* exponent,
+    const uint64_t* modulus,
+    uint64_t mu,
+    const uint64_t* one_mont,
+    uint64_t* result
+) {
+    uint64_t acc[LIMBS];
+    memcpy(acc, one_mont, sizeof(acc));
+
+    for (int limb = LIMBS - 1; limb >= 0; limb--) {
+        for (int bit = 63; bit >= 0; bit--) {
+            montgomery_mul_limbs<LIMBS>(acc, acc, modulus, mu, acc);
+            if ((exponent[limb] >> bit) & 1) {
+                montgomery_mul_limbs<LIMBS>(acc, base, modulus, mu, acc);
+            }
+        }
+    }
+
+    memcpy(result, acc, sizeof(acc));
+}
+
+/**
+ * Batch inversion core, templated over limb count
+ *
+ * Montgomery's simultaneous-inversion trick: accumulate prefix products
+ * of the inputs (stashed in the output array), invert the single total
+ * product with Fermat's little theorem, then unwind backwards turning
+ * each prefix into the corresponding element inverse. One inversion plus
+ * roughly 3(n-1) multiplications replaces n inversions. Zero inputs have
+ * no inverse; they are skipped in the chain and produce zero output, so
+ * one zero does not poison the rest of the batch.
+ */
+template <int LIMBS>
+static void batch_inverse_limbs(
+    const uint64_t* elements,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count
+) {
+    uint64_t one_mont[LIMBS];
+    montgomery_one_limbs<LIMBS>(modulus, one_mont);
+
+    // Forward pass: results[i] = product of nonzero elements before i
+    uint64_t acc[LIMBS];
+    memcpy(acc, one_mont, sizeof(acc));
+    for (size_t i = 0; i < count; i++) {
+        const uint64_t* elem = elements + i * LIMBS;
+        if (limbs_is_zero(elem, LIMBS)) {
+            continue;
+        }
+        memcpy(results + i * LIMBS, acc, sizeof(acc));
+        montgomery_mul_limbs<LIMBS>(acc, elem, modulus, mu, acc);
+    }
+
+    // Single inversion of the total product: acc^(p-2) mod p
+    uint64_t exponent[LIMBS];
+    static const uint64_t two[LIMBS] = {2};
+    sub_with_borrow(modulus, two, exponent, LIMBS);
+
+    uint64_t inv[LIMBS];
+    montgomery_pow_limbs<LIMBS>(acc, exponent, modulus, mu, one_mont, inv);
+
+    // Backward pass: peel one element off the running inverse at a time
+    for (size_t i = count; i-- > 0;) {
+        const uint64_t* elem = elements + i * LIMBS;
+        uint64_t* out = results + i * LIMBS;
+        if (limbs_is_zero(elem, LIMBS)) {
+            memset(out, 0, LIMBS * sizeof(uint64_t));
+            continue;
+        }
+        uint64_t elem_inv[LIMBS];
+        montgomery_mul_limbs<LIMBS>(inv, out, modulus, mu, elem_inv);
+        montgomery_mul_limbs<LIMBS>(inv, elem, modulus, mu, inv);
+        memcpy(out, elem_inv, sizeof(elem_inv));
+    }
+}
+
+/**
+ * Batch modular inversion using Montgomery's trick
+ *
+ * Inputs and outputs are in Montgomery form, matching the batch
+ * multiplication kernels. Zero elements produce zero outputs.
+ */
+void neon_batch_inverse(
+    const uint64_t* elements,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+) {
+    switch (limb_count) {
+        case 1:
+            batch_inverse_limbs<1>(elements, modulus, mu, results, count);
+            break;
+        case 4:
+            batch_inverse_limbs<4>(elements, modulus, mu, results, count);
+            break;
+        case 6:
+            batch_inverse_limbs<6>(elements, modulus, mu, results, count);
+            break;
+        case 8:
+            batch_inverse_limbs<8>(elements, modulus, mu, results, count);
+            break;
+        default:
+            // Unsupported limb count - zero output
+            memset(results, 0, count * limb_count * sizeof(uint64_t));
+            break;
     }
 }
@@ -0,0 +1,426 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * CPU NTT engine (cache-blocked six-step algorithm)
+ *
+ * Complete number-theoretic transform over 4-limb prime fields on the
+ * CPU, sharing the field context and plan-cache conventions of the Metal
+ * engine so the router can fall back between the two. Small transforms
+ * run as a single iterative radix-2 pass; above a cache threshold the
+ * transform is decomposed six-step style (transpose, sqrt(n)-sized row
+ * transforms, twiddle pass, transpose, row transforms, transpose) so
+ * every butterfly pass works on rows that fit in L2, with the row
+ * transforms split across cores. Data enters and leaves in canonical
+ * form, matching the GPU buffer convention; the transform itself runs in
+ * Montgomery form.
+ *
+ * Requirements: 3.7, 6.6
+ */
+
+#include "../include/zk_accelerate.h"
+#include "../include/perf_counters.h"
+#include "ntt_field.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __APPLE__
+#include <pthread.h>
+#endif
+
+/**
+ * A prepared transform: field context, full twiddle power tables and the
+ * inverse-transform scale factor, all in Montgomery form. Plans are
+ * cached per (modulus, root, n) like the GPU plans and live for the
+ * process.
+ */
+struct NttCpuPlan {
+    size_t n;
+    int log_n;
+    NttFieldCtx ctx;
+    std::vector<uint64_t> twiddles;     // w^i for i < n/2, Montgomery form
+    std::vector<uint64_t> twiddles_inv; // w^-i for i < n/2, Montgomery form
+    uint64_t n_inv[4];                  // n^-1, Montgomery form
+};
+
+static std::mutex g_cpu_plan_mutex;
+static std::unordered_map<std::string, NttCpuPlan*> g_cpu_plan_cache;
+
+static std::string ntt_cpu_plan_key(const uint64_t* modulus, const uint64_t* root_of_unity, size_t n) {
+    std::string key((const char*)modulus, 4 * sizeof(uint64_t));
+    key.append((const char*)root_of_unity, 4 * sizeof(uint64_t));
+    key.append((const char*)&n, sizeof(n));
+    return key;
+}
+
+/**
+ * Element count above which the six-step decomposition is used
+ *
+ * The default keeps a full row (elements plus twiddles) comfortably
+ * inside a performance-core L2; ZK_ACCELERATE_NTT_BLOCK overrides it
+ * with an explicit power-of-two element count.
+ */
+static size_t ntt_direct_threshold(void) {
+    const char* env = std::getenv("ZK_ACCELERATE_NTT_BLOCK");
+    if (env != nullptr) {
+        long long requested = std::atoll(env);
+        if (requested >= 2 && (requested & (requested - 1)) == 0) {
+            return (size_t)requested;
+        }
+    }
+    return (size_t)1 << 13;
+}
+
+/**
+ * Worker thread count for the parallel passes, same shape as the MSM
+ * engine heuristic: small transforms stay single-threaded, larger ones
+ * use one worker per core with the ZK_ACCELERATE_CPU_THREADS override.
+ */
+static int ntt_worker_count(size_t n) {
+    if (n < 8192) {
+        return 1;
+    }
+
+    int threads = detect_hardware_capabilities().cpu_cores;
+
+    const char* env = std::getenv("ZK_ACCELERATE_CPU_THREADS");
+    if (env != nullptr) {
+        int requested = std::atoi(env);
+        if (requested > 0) {
+            threads = requested;
+        }
+    }
+
+    size_t max_useful = n / 4096;
+    if ((size_t)threads > max_useful) {
+        threads = (int)max_useful;
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    return threads;
+}
+
+static void ntt_worker_set_qos(void) {
+#ifdef __APPLE__
+    pthread_set_qos_class_self_np(QOS_CLASS_USER_INITIATED, 0);
+#endif
+}
+
+/**
+ * Run fn(start, end) over [0, count) in chunks pulled from a shared
+ * cursor, on num_threads workers
+ */
+template <typename Fn>
+static void ntt_parallel_for(size_t count, size_t chunk_size, int num_threads, Fn fn) {
+    std::atomic<size_t> cursor(0);
+
+    auto work = [&]() {
+        ntt_worker_set_qos();
+        for (;;) {
+            size_t start = cursor.fetch_add(chunk_size, std::memory_order_relaxed);
+            if (start >= count) {
+                break;
+            }
+            size_t end = start + chunk_size;
+            if (end > count) {
+                end = count;
+            }
+            fn(start, end);
+        }
+    };
+
+    if (num_threads > 1) {
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+        for (int t = 0; t < num_threads; t++) {
+            workers.emplace_back(work);
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    } else {
+        work();
+    }
+}
+
+/**
+ * In-place bit-reversal permutation of len 4-limb elements
+ */
+static void ntt_bit_reverse(uint64_t* row, size_t len) {
+    size_t j = 0;
+    for (size_t i = 1; i < len; i++) {
+        size_t bit = len >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j |= bit;
+        if (i < j) {
+            uint64_t tmp[4];
+            memcpy(tmp, row + i * 4, sizeof(tmp));
+            memcpy(row + i * 4, row + j * 4, sizeof(tmp));
+            memcpy(row + j * 4, tmp, sizeof(tmp));
+        }
+    }
+}
+
+/**
+ * In-place iterative radix-2 transform of one length-len row
+ *
+ * Twiddles index into the plan's full-n power table with stride n/m at
+ * butterfly width m: for a length-len sub-transform of the full size-n
+ * problem, the stage-m twiddle w_len^(j * len/m) equals w^(j * n/m), so
+ * rows of every length share the one table. Natural order in, natural
+ * order out.
+ */
+static void ntt_row_transform(
+    const NttCpuPlan* plan,
+    const uint64_t* table,
+    uint64_t* row,
+    size_t len
+) {
+    ntt_bit_reverse(row, len);
+
+    for (size_t m = 2; m <= len; m <<= 1) {
+        size_t stride = plan->n / m;
+        size_t half = m / 2;
+
+        for (size_t k = 0; k < len; k += m) {
+            for (size_t j = 0; j < half; j++) {
+                const uint64_t* w = table + (j * stride) * 4;
+                uint64_t* even = row + (k + j) * 4;
+                uint64_t* odd = row + (k + j + half) * 4;
+
+                uint64_t t[4], u[4];
+                ntt_mont_mul(plan->ctx, odd, w, t);
+                memcpy(u, even, sizeof(u));
+                ntt_mod_add(plan->ctx, u, t, even);
+                ntt_mod_sub(plan->ctx, u, t, odd);
+            }
+        }
+    }
+}
+
+/**
+ * Blocked out-of-place transpose: src is rows x cols of 4-limb elements,
+ * dst becomes cols x rows. Blocking keeps both the source row and the
+ * destination column stripe cache-resident.
+ */
+static void ntt_transpose(const uint64_t* src, uint64_t* dst, size_t rows, size_t cols) {
+    const size_t block = 16;
+
+    for (size_t r0 = 0; r0 < rows; r0 += block) {
+        size_t r1 = std::min(r0 + block, rows);
+        for (size_t c0 = 0; c0 < cols; c0 += block) {
+            size_t c1 = std::min(c0 + block, cols);
+            for (size_t r = r0; r < r1; r++) {
+                for (size_t c = c0; c < c1; c++) {
+                    memcpy(dst + (c * rows + r) * 4, src + (r * cols + c) * 4,
+                           4 * sizeof(uint64_t));
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Six-step decomposition of a size-n transform into n1 x n2 row passes
+ *
+ * With n = n1 * n2, input index j = j1 + n1*j2 and output index
+ * k = k2 + n2*k1, the DFT factors as column transforms of length n2,
+ * a twiddle multiplication by w^(j1*k2), and row transforms of length
+ * n1. Transposes turn every pass into contiguous row work, and the row
+ * transforms are independent, so they split across workers.
+ */
+static void ntt_six_step(
+    const NttCpuPlan* plan,
+    const uint64_t* table,
+    uint64_t* data,
+    int num_threads
+) {
+    size_t n = plan->n;
+    size_t n1 = (size_t)1 << (plan->log_n / 2);
+    size_t n2 = n / n1;
+
+    std::vector<uint64_t> scratch(n * 4);
+
+    // Step 1: gather the length-n2 columns of x (viewed n2 x n1) into
+    // the rows of scratch (n1 x n2)
+    ntt_transpose(data, scratch.data(), n2, n1);
+
+    // Steps 2-3: transform each row, then scale row j1 by the running
+    // powers of w^j1 (the w^(j1*k2) twiddle between the two stages)
+    ntt_parallel_for(n1, 1, num_threads, [&](size_t start, size_t end) {
+        for (size_t j1 = start; j1 < end; j1++) {
+            uint64_t* row = scratch.data() + j1 * n2 * 4;
+            ntt_row_transform(plan, table, row, n2);
+
+            if (j1 == 0) {
+                continue;
+            }
+            const uint64_t* w_j1 = table + j1 * 4;
+            uint64_t t[4];
+            memcpy(t, w_j1, sizeof(t));
+            for (size_t k2 = 1; k2 < n2; k2++) {
+                ntt_mont_mul(plan->ctx, row + k2 * 4, t, row + k2 * 4);
+                ntt_mont_mul(plan->ctx, t, w_j1, t);
+            }
+        }
+    });
+
+    // Step 4: transpose back so each output column index k2 becomes a
+    // contiguous length-n1 row
+    ntt_transpose(scratch.data(), data, n1, n2);
+
+    // Step 5: length-n1 transform of every row
+    ntt_parallel_for(n2, 1, num_threads, [&](size_t start, size_t end) {
+        for (size_t k2 = start; k2 < end; k2++) {
+            ntt_row_transform(plan, table, data + k2 * n1 * 4, n1);
+        }
+    });
+
+    // Step 6: final transpose puts element (k1, k2) at k2 + n2*k1
+    ntt_transpose(data, scratch.data(), n2, n1);
+    memcpy(data, scratch.data(), n * 4 * sizeof(uint64_t));
+}
+
+NttCpuPlan* ntt_cpu_plan_create(const uint64_t* modulus, const uint64_t* root_of_unity, size_t n) {
+    if (modulus == nullptr || root_of_unity == nullptr) {
+        return nullptr;
+    }
+    if (n < 2 || (n & (n - 1)) != 0) {
+        return nullptr;
+    }
+
+    std::string key = ntt_cpu_plan_key(modulus, root_of_unity, n);
+    {
+        std::lock_guard<std::mutex> lock(g_cpu_plan_mutex);
+        auto it = g_cpu_plan_cache.find(key);
+        if (it != g_cpu_plan_cache.end()) {
+            return it->second;
+        }
+    }
+
+    NttFieldCtx ctx;
+    ntt_field_ctx_init(ctx, modulus);
+
+    uint64_t w[4];
+    ntt_to_mont(ctx, root_of_unity, w);
+
+    // Verify the root has order n: w^n == 1 and w^(n/2) != 1
+    uint64_t n_limbs[4] = {(uint64_t)n, 0, 0, 0};
+    uint64_t half_n_limbs[4] = {(uint64_t)(n / 2), 0, 0, 0};
+    uint64_t check[4];
+    ntt_mont_pow(ctx, w, n_limbs, check);
+    if (memcmp(check, ctx.one, sizeof(check)) != 0) {
+        return nullptr;
+    }
+    ntt_mont_pow(ctx, w, half_n_limbs, check);
+    if (memcmp(check, ctx.one, sizeof(check)) == 0) {
+        return nullptr;
+    }
+
+    uint64_t n_minus_1[4] = {(uint64_t)(n - 1), 0, 0, 0};
+    uint64_t w_inv[4];
+    ntt_mont_pow(ctx, w, n_minus_1, w_inv);
+
+    NttCpuPlan* plan = new NttCpuPlan();
+    plan->n = n;
+    plan->log_n = 0;
+    for (size_t v = n; v > 1; v >>= 1) {
+        plan->log_n++;
+    }
+    plan->ctx = ctx;
+
+    // Power tables stay in Montgomery form, matching the GPU tables; the
+    // butterfly consumes Montgomery operands directly
+    plan->twiddles.resize(n / 2 * 4);
+    plan->twiddles_inv.resize(n / 2 * 4);
+    uint64_t t_fwd[4], t_inv[4];
+    memcpy(t_fwd, ctx.one, sizeof(t_fwd));
+    memcpy(t_inv, ctx.one, sizeof(t_inv));
+    for (size_t i = 0; i < n / 2; i++) {
+        memcpy(plan->twiddles.data() + i * 4, t_fwd, sizeof(t_fwd));
+        memcpy(plan->twiddles_inv.data() + i * 4, t_inv, sizeof(t_inv));
+        ntt_mont_mul(ctx, t_fwd, w, t_fwd);
+        ntt_mont_mul(ctx, t_inv, w_inv, t_inv);
+    }
+
+    // n^-1 = n^(modulus - 2) by Fermat, kept in Montgomery form
+    uint64_t p_minus_2[4];
+    memcpy(p_minus_2, modulus, sizeof(p_minus_2));
+    p_minus_2[0] -= 2; // NTT moduli are odd primes > 2, no borrow
+    uint64_t n_mont[4];
+    ntt_to_mont(ctx, n_limbs, n_mont);
+    ntt_mont_pow(ctx, n_mont, p_minus_2, plan->n_inv);
+
+    std::lock_guard<std::mutex> lock(g_cpu_plan_mutex);
+    auto it = g_cpu_plan_cache.find(key);
+    if (it != g_cpu_plan_cache.end()) {
+        // Another thread built the same plan first; keep theirs
+        delete plan;
+        return it->second;
+    }
+    g_cpu_plan_cache[key] = plan;
+    return plan;
+}
+
+bool ntt_cpu_execute(NttCpuPlan* plan, uint64_t* data, bool forward) {
+    if (plan == nullptr || data == nullptr) {
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    size_t n = plan->n;
+    int num_threads = ntt_worker_count(n);
+    const uint64_t* table = forward ? plan->twiddles.data() : plan->twiddles_inv.data();
+
+    // Canonical -> Montgomery (neon_montgomery_mul_4limb is alias-safe)
+    ntt_parallel_for(n, 4096, num_threads, [&](size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; i++) {
+            ntt_to_mont(plan->ctx, data + i * 4, data + i * 4);
+        }
+    });
+
+    if (n <= ntt_direct_threshold()) {
+        ntt_row_transform(plan, table, data, n);
+    } else {
+        ntt_six_step(plan, table, data, num_threads);
+    }
+
+    // Inverse transforms scale by n^-1; fold the Montgomery -> canonical
+    // conversion into the same pass
+    if (forward) {
+        ntt_parallel_for(n, 4096, num_threads, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) {
+                ntt_from_mont(plan->ctx, data + i * 4, data + i * 4);
+            }
+        });
+    } else {
+        uint64_t n_inv_canonical[4];
+        ntt_from_mont(plan->ctx, plan->n_inv, n_inv_canonical);
+        ntt_parallel_for(n, 4096, num_threads, [&](size_t lo, size_t hi) {
+            for (size_t i = lo; i < hi; i++) {
+                ntt_mont_mul(plan->ctx, data + i * 4, n_inv_canonical, data + i * 4);
+            }
+        });
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    perf_counters_record("ntt_cpu", std::chrono::duration<double, std::milli>(end - start).count());
+    return true;
+}
+
+void ntt_cpu_plan_cache_clear(void) {
+    std::lock_guard<std::mutex> lock(g_cpu_plan_mutex);
+    for (auto& entry : g_cpu_plan_cache) {
+        delete entry.second;
+    }
+    g_cpu_plan_cache.clear();
+}
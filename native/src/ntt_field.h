@@ -0,0 +1,146 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Host-side field context for NTT twiddle generation (internal)
+ *
+ * Modular arithmetic over a generic 4-limb modulus, used to precompute
+ * twiddle tables and constants for both the Metal and CPU NTT engines.
+ * Values are held in Montgomery form during computation, and both
+ * engines keep their twiddle tables in Montgomery form: the butterfly's
+ * Montgomery multiply then cancels the R factor, so the data arrays
+ * themselves stay canonical.
+ *
+ * This header is internal to the native layer and is not part of the
+ * public C API in include/.
+ */
+
+#ifndef NTT_FIELD_H
+#define NTT_FIELD_H
+
+#include "../include/cpu_accelerate.h"
+#include <cstdint>
+#include <cstring>
+
+struct NttFieldCtx {
+    uint64_t modulus[4];
+    uint64_t mu;       // -modulus^-1 mod 2^64
+    uint64_t r2[4];    // R^2 mod modulus (Montgomery conversion constant)
+    uint64_t one[4];   // R mod modulus (1 in Montgomery form)
+};
+
+static inline uint64_t ntt_compute_mu(uint64_t p0) {
+    // Newton iteration for p0^-1 mod 2^64, doubling precision each step
+    uint64_t inv = p0;
+    for (int i = 0; i < 6; i++) {
+        inv *= 2 - p0 * inv;
+    }
+    return (uint64_t)(0 - inv);
+}
+
+static inline bool ntt_limbs_gte(const uint64_t* a, const uint64_t* b) {
+    for (int i = 3; i >= 0; i--) {
+        if (a[i] > b[i]) return true;
+        if (a[i] < b[i]) return false;
+    }
+    return true;
+}
+
+static inline void ntt_mod_double(uint64_t* a, const uint64_t* modulus) {
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++) {
+        uint64_t top = a[i] >> 63;
+        a[i] = (a[i] << 1) | carry;
+        carry = top;
+    }
+    if (carry || ntt_limbs_gte(a, modulus)) {
+        uint64_t borrow = 0;
+        for (int i = 0; i < 4; i++) {
+            __uint128_t diff = (__uint128_t)a[i] - modulus[i] - borrow;
+            a[i] = (uint64_t)diff;
+            borrow = (diff >> 64) ? 1 : 0;
+        }
+    }
+}
+
+static inline void ntt_mod_add(const NttFieldCtx& ctx, const uint64_t* a, const uint64_t* b, uint64_t* result) {
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++) {
+        __uint128_t sum = (__uint128_t)a[i] + b[i] + carry;
+        result[i] = (uint64_t)sum;
+        carry = (uint64_t)(sum >> 64);
+    }
+    if (carry || ntt_limbs_gte(result, ctx.modulus)) {
+        uint64_t borrow = 0;
+        for (int i = 0; i < 4; i++) {
+            __uint128_t diff = (__uint128_t)result[i] - ctx.modulus[i] - borrow;
+            result[i] = (uint64_t)diff;
+            borrow = (diff >> 64) ? 1 : 0;
+        }
+    }
+}
+
+static inline void ntt_mod_sub(const NttFieldCtx& ctx, const uint64_t* a, const uint64_t* b, uint64_t* result) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++) {
+        __uint128_t diff = (__uint128_t)a[i] - b[i] - borrow;
+        result[i] = (uint64_t)diff;
+        borrow = (diff >> 64) ? 1 : 0;
+    }
+    if (borrow) {
+        uint64_t carry = 0;
+        for (int i = 0; i < 4; i++) {
+            __uint128_t sum = (__uint128_t)result[i] + ctx.modulus[i] + carry;
+            result[i] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+    }
+}
+
+static inline void ntt_field_ctx_init(NttFieldCtx& ctx, const uint64_t* modulus) {
+    memcpy(ctx.modulus, modulus, sizeof(ctx.modulus));
+    ctx.mu = ntt_compute_mu(modulus[0]);
+
+    // R mod p by doubling 1 a limb-width at a time, then R^2 mod p by
+    // doubling 256 more times
+    uint64_t r[4] = {1, 0, 0, 0};
+    for (int i = 0; i < 256; i++) {
+        ntt_mod_double(r, modulus);
+    }
+    memcpy(ctx.one, r, sizeof(ctx.one));
+    for (int i = 0; i < 256; i++) {
+        ntt_mod_double(r, modulus);
+    }
+    memcpy(ctx.r2, r, sizeof(ctx.r2));
+}
+
+static inline void ntt_mont_mul(const NttFieldCtx& ctx, const uint64_t* a, const uint64_t* b, uint64_t* result) {
+    neon_montgomery_mul_4limb(a, b, ctx.modulus, ctx.mu, result);
+}
+
+static inline void ntt_to_mont(const NttFieldCtx& ctx, const uint64_t* a, uint64_t* result) {
+    ntt_mont_mul(ctx, a, ctx.r2, result);
+}
+
+static inline void ntt_from_mont(const NttFieldCtx& ctx, const uint64_t* a, uint64_t* result) {
+    uint64_t one[4] = {1, 0, 0, 0};
+    ntt_mont_mul(ctx, a, one, result);
+}
+
+/**
+ * Montgomery exponentiation: result = base^exponent (base in Montgomery form)
+ */
+static inline void ntt_mont_pow(
+    const NttFieldCtx& ctx,
+    const uint64_t* base,
+    const uint64_t* exponent,
+    uint64_t* result
+) {
+    memcpy(result, ctx.one, 4 * sizeof(uint64_t));
+    for (int bit = 255; bit >= 0; bit--) {
+        ntt_mont_mul(ctx, result, result, result);
+        if ((exponent[bit / 64] >> (bit % 64)) & 1) {
+            ntt_mont_mul(ctx, result, base, result);
+        }
+    }
+}
+
+#endif /* NTT_FIELD_H */
@@ -0,0 +1,136 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Native performance counters implementation
+ *
+ * Per-kernel timing goes into a geometric histogram (factor-2 buckets
+ * starting at 1 microsecond) so percentiles can be estimated at
+ * snapshot time without retaining individual samples.
+ *
+ * Requirements: 7.5, 9.1
+ */
+
+#include "../include/perf_counters.h"
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace {
+
+// 40 factor-2 buckets from 1us cover ~1us to ~9 minutes
+constexpr int kHistogramBuckets = 40;
+constexpr double kFirstBucketMs = 0.001;
+
+struct KernelCounters {
+    uint64_t count = 0;
+    double total_ms = 0.0;
+    double min_ms = 0.0;
+    double max_ms = 0.0;
+    uint64_t histogram[kHistogramBuckets] = {0};
+};
+
+std::mutex g_mutex;
+std::map<std::string, KernelCounters> g_kernels;
+std::atomic<uint64_t> g_bytes_to_gpu{0};
+std::atomic<uint64_t> g_bytes_from_gpu{0};
+
+int bucket_for(double ms) {
+    if (ms <= kFirstBucketMs) {
+        return 0;
+    }
+    int bucket = (int)std::ceil(std::log2(ms / kFirstBucketMs));
+    if (bucket >= kHistogramBuckets) {
+        bucket = kHistogramBuckets - 1;
+    }
+    return bucket;
+}
+
+// Geometric midpoint of a bucket, used as the percentile estimate
+double bucket_value(int bucket) {
+    double upper = kFirstBucketMs * std::pow(2.0, bucket);
+    return bucket == 0 ? upper : upper / std::sqrt(2.0);
+}
+
+double percentile_from_histogram(const KernelCounters& k, double fraction) {
+    uint64_t target = (uint64_t)std::ceil(fraction * (double)k.count);
+    if (target < 1) {
+        target = 1;
+    }
+    uint64_t seen = 0;
+    for (int b = 0; b < kHistogramBuckets; b++) {
+        seen += k.histogram[b];
+        if (seen >= target) {
+            return bucket_value(b);
+        }
+    }
+    return k.max_ms;
+}
+
+} // namespace
+
+void perf_counters_record(const char* kernel, double ms) {
+    if (kernel == nullptr || ms < 0.0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+    KernelCounters& k = g_kernels[kernel];
+    if (k.count == 0 || ms < k.min_ms) {
+        k.min_ms = ms;
+    }
+    if (ms > k.max_ms) {
+        k.max_ms = ms;
+    }
+    k.count++;
+    k.total_ms += ms;
+    k.histogram[bucket_for(ms)]++;
+}
+
+void perf_counters_add_transfer(uint64_t bytes_to_gpu, uint64_t bytes_from_gpu) {
+    g_bytes_to_gpu.fetch_add(bytes_to_gpu, std::memory_order_relaxed);
+    g_bytes_from_gpu.fetch_add(bytes_from_gpu, std::memory_order_relaxed);
+}
+
+size_t perf_counters_snapshot(PerfKernelStats* out, size_t max) {
+    if (out == nullptr || max == 0) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(g_mutex);
+    size_t written = 0;
+    for (const auto& entry : g_kernels) {
+        if (written >= max) {
+            break;
+        }
+        const KernelCounters& k = entry.second;
+        PerfKernelStats& s = out[written];
+
+        strncpy(s.name, entry.first.c_str(), sizeof(s.name) - 1);
+        s.name[sizeof(s.name) - 1] = '\0';
+        s.count = k.count;
+        s.total_ms = k.total_ms;
+        s.min_ms = k.min_ms;
+        s.max_ms = k.max_ms;
+        s.p50_ms = percentile_from_histogram(k, 0.50);
+        s.p95_ms = percentile_from_histogram(k, 0.95);
+        s.p99_ms = percentile_from_histogram(k, 0.99);
+        written++;
+    }
+    return written;
+}
+
+PerfTransferStats perf_counters_transfers(void) {
+    PerfTransferStats stats;
+    stats.bytes_to_gpu = g_bytes_to_gpu.load(std::memory_order_relaxed);
+    stats.bytes_from_gpu = g_bytes_from_gpu.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void perf_counters_reset(void) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_kernels.clear();
+    g_bytes_to_gpu.store(0, std::memory_order_relaxed);
+    g_bytes_from_gpu.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,429 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * CPU elliptic curve point arithmetic (internal)
+ *
+ * Shared Jacobian/affine point primitives over the BN254 base field,
+ * built on the NEON Montgomery multiplication kernels. All field
+ * elements are in Montgomery form (R = 2^256 mod p).
+ *
+ * This header is internal to the native layer and is not part of the
+ * public C API in include/.
+ */
+
+#ifndef POINT_OPS_H
+#define POINT_OPS_H
+
+#include "../include/cpu_accelerate.h"
+#include <cstdint>
+#include <cstring>
+
+// ============================================================================
+// BN254 base field constants
+// ============================================================================
+
+// BN254 field modulus p (little-endian limbs)
+static const uint64_t BN254_FQ_MODULUS[4] = {
+    0x3C208C16D87CFD47ULL,
+    0x97816A916871CA8DULL,
+    0xB85045B68181585DULL,
+    0x30644E72E131A029ULL
+};
+
+// Montgomery constant mu = -p^(-1) mod 2^64
+static const uint64_t BN254_FQ_MU = 0x87D20782E4866389ULL;
+
+// R mod p (Montgomery representation of 1)
+static const uint64_t BN254_FQ_ONE[4] = {
+    0xD35D438DC58F0D9DULL,
+    0x0A78EB28F5C70B3DULL,
+    0x666EA36F7879462CULL,
+    0x0E0A77C19A07DF2FULL
+};
+
+// Scalar bit length for BN254
+static const int BN254_SCALAR_BITS = 254;
+
+// ============================================================================
+// Field element
+// ============================================================================
+
+struct Fq {
+    uint64_t limbs[4];
+};
+
+// Jacobian point (X, Y, Z), identity encoded as Z = 0
+struct JacobianPointG1 {
+    Fq x;
+    Fq y;
+    Fq z;
+};
+
+// Affine point, layout matches the Metal AffinePoint struct
+struct AffinePointG1 {
+    Fq x;
+    Fq y;
+    uint32_t is_infinity;
+    uint32_t padding;
+};
+
+// ============================================================================
+// Field operations
+// ============================================================================
+
+static inline void fq_copy(Fq& dst, const Fq& src) {
+    memcpy(dst.limbs, src.limbs, sizeof(dst.limbs));
+}
+
+static inline bool fq_is_zero(const Fq& a) {
+    return (a.limbs[0] | a.limbs[1] | a.limbs[2] | a.limbs[3]) == 0;
+}
+
+static inline void fq_zero(Fq& a) {
+    memset(a.limbs, 0, sizeof(a.limbs));
+}
+
+static inline void fq_one(Fq& a) {
+    memcpy(a.limbs, BN254_FQ_ONE, sizeof(a.limbs));
+}
+
+static inline bool fq_equal(const Fq& a, const Fq& b) {
+    return memcmp(a.limbs, b.limbs, sizeof(a.limbs)) == 0;
+}
+
+static inline int fq_cmp_modulus(const Fq& a) {
+    for (int i = 3; i >= 0; i--) {
+        if (a.limbs[i] < BN254_FQ_MODULUS[i]) return -1;
+        if (a.limbs[i] > BN254_FQ_MODULUS[i]) return 1;
+    }
+    return 0;
+}
+
+/**
+ * Field addition: result = (a + b) mod p
+ */
+static inline void fq_add(Fq& result, const Fq& a, const Fq& b) {
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; i++) {
+        __uint128_t sum = (__uint128_t)a.limbs[i] + b.limbs[i] + carry;
+        result.limbs[i] = (uint64_t)sum;
+        carry = (uint64_t)(sum >> 64);
+    }
+
+    if (carry || fq_cmp_modulus(result) >= 0) {
+        uint64_t borrow = 0;
+        for (int i = 0; i < 4; i++) {
+            __uint128_t diff = (__uint128_t)result.limbs[i] - BN254_FQ_MODULUS[i] - borrow;
+            result.limbs[i] = (uint64_t)diff;
+            borrow = (diff >> 64) ? 1 : 0;
+        }
+    }
+}
+
+/**
+ * Field subtraction: result = (a - b) mod p
+ */
+static inline void fq_sub(Fq& result, const Fq& a, const Fq& b) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++) {
+        __uint128_t diff = (__uint128_t)a.limbs[i] - b.limbs[i] - borrow;
+        result.limbs[i] = (uint64_t)diff;
+        borrow = (diff >> 64) ? 1 : 0;
+    }
+
+    if (borrow) {
+        uint64_t carry = 0;
+        for (int i = 0; i < 4; i++) {
+            __uint128_t sum = (__uint128_t)result.limbs[i] + BN254_FQ_MODULUS[i] + carry;
+            result.limbs[i] = (uint64_t)sum;
+            carry = (uint64_t)(sum >> 64);
+        }
+    }
+}
+
+/**
+ * Field negation: result = -a mod p
+ */
+static inline void fq_neg(Fq& result, const Fq& a) {
+    if (fq_is_zero(a)) {
+        fq_zero(result);
+        return;
+    }
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; i++) {
+        __uint128_t diff = (__uint128_t)BN254_FQ_MODULUS[i] - a.limbs[i] - borrow;
+        result.limbs[i] = (uint64_t)diff;
+        borrow = (diff >> 64) ? 1 : 0;
+    }
+}
+
+/**
+ * Field multiplication (Montgomery): result = a * b * R^(-1) mod p
+ */
+static inline void fq_mul(Fq& result, const Fq& a, const Fq& b) {
+    neon_montgomery_mul_4limb(a.limbs, b.limbs, BN254_FQ_MODULUS, BN254_FQ_MU, result.limbs);
+}
+
+/**
+ * Field squaring: result = a^2 * R^(-1) mod p
+ */
+static inline void fq_sqr(Fq& result, const Fq& a) {
+    fq_mul(result, a, a);
+}
+
+/**
+ * Field doubling: result = 2a mod p
+ */
+static inline void fq_dbl(Fq& result, const Fq& a) {
+    fq_add(result, a, a);
+}
+
+// ============================================================================
+// Point operations (Jacobian coordinates, curve y^2 = x^3 + 3)
+// ============================================================================
+
+static inline bool point_is_identity(const JacobianPointG1& p) {
+    return fq_is_zero(p.z);
+}
+
+static inline void point_set_identity(JacobianPointG1& p) {
+    fq_one(p.x);
+    fq_one(p.y);
+    fq_zero(p.z);
+}
+
+static inline void point_copy(JacobianPointG1& dst, const JacobianPointG1& src) {
+    memcpy(&dst, &src, sizeof(JacobianPointG1));
+}
+
+/**
+ * Point negation: (X, Y, Z) -> (X, -Y, Z)
+ */
+static inline void point_neg(JacobianPointG1& result, const JacobianPointG1& p) {
+    fq_copy(result.x, p.x);
+    fq_neg(result.y, p.y);
+    fq_copy(result.z, p.z);
+}
+
+/**
+ * Point doubling: result = 2p
+ *
+ * Uses the dbl-2009-l formulas (valid for a = 0 curves).
+ */
+static inline void point_double(JacobianPointG1& result, const JacobianPointG1& p) {
+    if (point_is_identity(p)) {
+        point_set_identity(result);
+        return;
+    }
+
+    Fq a, b, c, d, e, f, t0, t1;
+
+    fq_sqr(a, p.x);                  // A = X^2
+    fq_sqr(b, p.y);                  // B = Y^2
+    fq_sqr(c, b);                    // C = B^2
+
+    fq_add(t0, p.x, b);              // X + B
+    fq_sqr(t0, t0);                  // (X + B)^2
+    fq_sub(t0, t0, a);
+    fq_sub(t0, t0, c);
+    fq_dbl(d, t0);                   // D = 2((X + B)^2 - A - C)
+
+    fq_dbl(e, a);
+    fq_add(e, e, a);                 // E = 3A
+    fq_sqr(f, e);                    // F = E^2
+
+    fq_dbl(t0, d);
+    fq_sub(result.x, f, t0);         // X3 = F - 2D
+
+    fq_sub(t0, d, result.x);
+    fq_mul(t0, e, t0);               // E * (D - X3)
+    fq_dbl(t1, c);
+    fq_dbl(t1, t1);
+    fq_dbl(t1, t1);                  // 8C
+    Fq y3;
+    fq_sub(y3, t0, t1);              // Y3 = E(D - X3) - 8C
+
+    fq_mul(t0, p.y, p.z);
+    fq_dbl(result.z, t0);            // Z3 = 2YZ
+
+    fq_copy(result.y, y3);
+}
+
+/**
+ * Point addition: result = p + q (general Jacobian + Jacobian)
+ *
+ * Uses the add-2007-bl formulas with identity and doubling handling.
+ */
+static inline void point_add(JacobianPointG1& result, const JacobianPointG1& p, const JacobianPointG1& q) {
+    if (point_is_identity(p)) {
+        point_copy(result, q);
+        return;
+    }
+    if (point_is_identity(q)) {
+        point_copy(result, p);
+        return;
+    }
+
+    Fq z1z1, z2z2, u1, u2, s1, s2;
+
+    fq_sqr(z1z1, p.z);               // Z1^2
+    fq_sqr(z2z2, q.z);               // Z2^2
+    fq_mul(u1, p.x, z2z2);           // U1 = X1 * Z2^2
+    fq_mul(u2, q.x, z1z1);           // U2 = X2 * Z1^2
+
+    fq_mul(s1, q.z, z2z2);
+    fq_mul(s1, p.y, s1);             // S1 = Y1 * Z2^3
+    fq_mul(s2, p.z, z1z1);
+    fq_mul(s2, q.y, s2);             // S2 = Y2 * Z1^3
+
+    if (fq_equal(u1, u2)) {
+        if (fq_equal(s1, s2)) {
+            point_double(result, p);
+        } else {
+            point_set_identity(result);
+        }
+        return;
+    }
+
+    Fq h, i, j, r, v, t0, t1;
+
+    fq_sub(h, u2, u1);               // H = U2 - U1
+    fq_dbl(i, h);
+    fq_sqr(i, i);                    // I = (2H)^2
+    fq_mul(j, h, i);                 // J = H * I
+    fq_sub(r, s2, s1);
+    fq_dbl(r, r);                    // r = 2(S2 - S1)
+    fq_mul(v, u1, i);                // V = U1 * I
+
+    fq_sqr(t0, r);
+    fq_sub(t0, t0, j);
+    fq_dbl(t1, v);
+    fq_sub(result.x, t0, t1);        // X3 = r^2 - J - 2V
+
+    fq_sub(t0, v, result.x);
+    fq_mul(t0, r, t0);               // r * (V - X3)
+    fq_mul(t1, s1, j);
+    fq_dbl(t1, t1);                  // 2 * S1 * J
+    Fq y3;
+    fq_sub(y3, t0, t1);              // Y3 = r(V - X3) - 2*S1*J
+
+    fq_add(t0, p.z, q.z);
+    fq_sqr(t0, t0);
+    fq_sub(t0, t0, z1z1);
+    fq_sub(t0, t0, z2z2);
+    fq_mul(result.z, t0, h);         // Z3 = ((Z1 + Z2)^2 - Z1^2 - Z2^2) * H
+
+    fq_copy(result.y, y3);
+}
+
+/**
+ * Mixed addition: result = p + q where q is affine (Z2 = 1)
+ *
+ * Uses the madd-2007-bl formulas, saving 4 multiplications over the
+ * general addition. This is the hot operation in bucket accumulation.
+ */
+static inline void point_add_mixed(JacobianPointG1& result, const JacobianPointG1& p, const AffinePointG1& q) {
+    if (q.is_infinity) {
+        point_copy(result, p);
+        return;
+    }
+    if (point_is_identity(p)) {
+        fq_copy(result.x, q.x);
+        fq_copy(result.y, q.y);
+        fq_one(result.z);
+        return;
+    }
+
+    Fq z1z1, u2, s2;
+
+    fq_sqr(z1z1, p.z);               // Z1^2
+    fq_mul(u2, q.x, z1z1);           // U2 = X2 * Z1^2
+    fq_mul(s2, p.z, z1z1);
+    fq_mul(s2, q.y, s2);             // S2 = Y2 * Z1^3
+
+    if (fq_equal(p.x, u2)) {
+        if (fq_equal(p.y, s2)) {
+            point_double(result, p);
+        } else {
+            point_set_identity(result);
+        }
+        return;
+    }
+
+    Fq h, hh, i, j, r, v, t0, t1;
+
+    fq_sub(h, u2, p.x);              // H = U2 - X1
+    fq_sqr(hh, h);                   // HH = H^2
+    fq_dbl(i, hh);
+    fq_dbl(i, i);                    // I = 4 * HH
+    fq_mul(j, h, i);                 // J = H * I
+    fq_sub(r, s2, p.y);
+    fq_dbl(r, r);                    // r = 2(S2 - Y1)
+    fq_mul(v, p.x, i);               // V = X1 * I
+
+    fq_sqr(t0, r);
+    fq_sub(t0, t0, j);
+    fq_dbl(t1, v);
+    fq_sub(result.x, t0, t1);        // X3 = r^2 - J - 2V
+
+    fq_sub(t0, v, result.x);
+    fq_mul(t0, r, t0);               // r * (V - X3)
+    fq_mul(t1, p.y, j);
+    fq_dbl(t1, t1);                  // 2 * Y1 * J
+    Fq y3;
+    fq_sub(y3, t0, t1);              // Y3 = r(V - X3) - 2*Y1*J
+
+    fq_add(t0, p.z, h);
+    fq_sqr(t0, t0);
+    fq_sub(t0, t0, z1z1);
+    fq_sub(result.z, t0, hh);        // Z3 = (Z1 + H)^2 - Z1^2 - HH
+
+    fq_copy(result.y, y3);
+}
+
+/**
+ * Load an affine point from a packed 8-limb (x, y) buffer
+ *
+ * The point at infinity is encoded as x = y = 0 (not a valid curve
+ * point otherwise, since b != 0).
+ */
+static inline void affine_from_limbs(AffinePointG1& point, const uint64_t* limbs) {
+    memcpy(point.x.limbs, limbs, 4 * sizeof(uint64_t));
+    memcpy(point.y.limbs, limbs + 4, 4 * sizeof(uint64_t));
+    point.is_infinity = (fq_is_zero(point.x) && fq_is_zero(point.y)) ? 1 : 0;
+    point.padding = 0;
+}
+
+// ============================================================================
+// Scalar windowing
+// ============================================================================
+
+/**
+ * Extract a window of bits from a 4-limb scalar
+ */
+static inline uint32_t scalar_get_window(const uint64_t* scalar, int window_index, int window_size) {
+    int start_bit = window_index * window_size;
+    uint32_t value = 0;
+
+    for (int i = 0; i < window_size && (start_bit + i) < 256; i++) {
+        int limb_index = (start_bit + i) / 64;
+        int bit_offset = (start_bit + i) % 64;
+        uint32_t bit = (uint32_t)((scalar[limb_index] >> bit_offset) & 1);
+        value |= bit << i;
+    }
+
+    return value;
+}
+
+/**
+ * Pippenger window size heuristic (mirrors the Metal MSM path)
+ */
+static inline int msm_optimal_window_size(size_t num_points) {
+    if (num_points < 32) return 4;
+    if (num_points < 256) return 8;
+    if (num_points < 2048) return 10;
+    if (num_points < 16384) return 12;
+    if (num_points < 131072) return 14;
+    return 16;
+}
+
+#endif /* POINT_OPS_H */
@@ -0,0 +1,388 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * CPU Fp2 and G2 point arithmetic (internal)
+ *
+ * Quadratic extension Fq2 = Fq[u]/(u^2 + 1) over the BN254 base field
+ * and Jacobian/affine point primitives on the sextic twist
+ * y^2 = x^3 + 3/(9 + u), built on the Fq primitives in point_ops.h.
+ * Multiplication is Karatsuba (three base-field multiplications),
+ * squaring uses the complex method (two). The a = 0 Jacobian formulas
+ * carry over from G1 unchanged; only the field type widens.
+ *
+ * This header is internal to the native layer and is not part of the
+ * public C API in include/.
+ */
+
+#ifndef POINT_OPS_G2_H
+#define POINT_OPS_G2_H
+
+#include "point_ops.h"
+
+// ============================================================================
+// Twist coefficient b' = 3/(9 + u), Montgomery form
+// ============================================================================
+
+static const uint64_t BN254_G2_B_C0[4] = {
+    0x3BF938E377B802A8ULL,
+    0x020B1B273633535DULL,
+    0x26B7EDF049755260ULL,
+    0x2514C6324384A86DULL
+};
+
+static const uint64_t BN254_G2_B_C1[4] = {
+    0x38E7ECCCD1DCFF67ULL,
+    0x65F0B37D93CE0D3EULL,
+    0xD749D0DD22AC00AAULL,
+    0x0141B9CE4A688D4DULL
+};
+
+// ============================================================================
+// Fq2 element
+// ============================================================================
+
+struct Fq2 {
+    Fq c0;
+    Fq c1;
+};
+
+// Jacobian G2 point (X, Y, Z), identity encoded as Z = 0
+struct JacobianPointG2 {
+    Fq2 x;
+    Fq2 y;
+    Fq2 z;
+};
+
+// Affine G2 point, layout matches the Metal AffinePointG2 struct
+struct AffinePointG2 {
+    Fq2 x;
+    Fq2 y;
+    uint32_t is_infinity;
+    uint32_t padding;
+};
+
+// ============================================================================
+// Fq2 operations
+// ============================================================================
+
+static inline void fq2_copy(Fq2& dst, const Fq2& src) {
+    fq_copy(dst.c0, src.c0);
+    fq_copy(dst.c1, src.c1);
+}
+
+static inline bool fq2_is_zero(const Fq2& a) {
+    return fq_is_zero(a.c0) && fq_is_zero(a.c1);
+}
+
+static inline void fq2_zero(Fq2& a) {
+    fq_zero(a.c0);
+    fq_zero(a.c1);
+}
+
+static inline void fq2_one(Fq2& a) {
+    fq_one(a.c0);
+    fq_zero(a.c1);
+}
+
+static inline bool fq2_equal(const Fq2& a, const Fq2& b) {
+    return fq_equal(a.c0, b.c0) && fq_equal(a.c1, b.c1);
+}
+
+static inline void fq2_add(Fq2& result, const Fq2& a, const Fq2& b) {
+    fq_add(result.c0, a.c0, b.c0);
+    fq_add(result.c1, a.c1, b.c1);
+}
+
+static inline void fq2_sub(Fq2& result, const Fq2& a, const Fq2& b) {
+    fq_sub(result.c0, a.c0, b.c0);
+    fq_sub(result.c1, a.c1, b.c1);
+}
+
+static inline void fq2_neg(Fq2& result, const Fq2& a) {
+    fq_neg(result.c0, a.c0);
+    fq_neg(result.c1, a.c1);
+}
+
+static inline void fq2_dbl(Fq2& result, const Fq2& a) {
+    fq_dbl(result.c0, a.c0);
+    fq_dbl(result.c1, a.c1);
+}
+
+/**
+ * Fq2 multiplication (Karatsuba over the quadratic extension)
+ *
+ * With u^2 = -1:
+ *   c0 = a0*b0 - a1*b1
+ *   c1 = (a0 + a1)(b0 + b1) - a0*b0 - a1*b1
+ * Three base-field multiplications instead of four.
+ */
+static inline void fq2_mul(Fq2& result, const Fq2& a, const Fq2& b) {
+    Fq t0, t1, t2, sa, sb;
+
+    fq_mul(t0, a.c0, b.c0);          // a0 * b0
+    fq_mul(t1, a.c1, b.c1);          // a1 * b1
+    fq_add(sa, a.c0, a.c1);
+    fq_add(sb, b.c0, b.c1);
+    fq_mul(t2, sa, sb);              // (a0 + a1)(b0 + b1)
+
+    fq_sub(result.c0, t0, t1);       // c0 = a0*b0 - a1*b1
+    fq_sub(t2, t2, t0);
+    fq_sub(result.c1, t2, t1);       // c1 = cross terms
+}
+
+/**
+ * Fq2 squaring (complex method)
+ *
+ * With u^2 = -1:
+ *   c0 = (a0 + a1)(a0 - a1)
+ *   c1 = 2 * a0 * a1
+ * Two base-field multiplications.
+ */
+static inline void fq2_sqr(Fq2& result, const Fq2& a) {
+    Fq sum, diff, prod;
+
+    fq_add(sum, a.c0, a.c1);
+    fq_sub(diff, a.c0, a.c1);
+    fq_mul(prod, a.c0, a.c1);
+
+    fq_mul(result.c0, sum, diff);    // c0 = a0^2 - a1^2
+    fq_dbl(result.c1, prod);         // c1 = 2 * a0 * a1
+}
+
+// ============================================================================
+// G2 point operations (Jacobian coordinates on the twist)
+// ============================================================================
+
+static inline bool g2_point_is_identity(const JacobianPointG2& p) {
+    return fq2_is_zero(p.z);
+}
+
+static inline void g2_point_set_identity(JacobianPointG2& p) {
+    fq2_one(p.x);
+    fq2_one(p.y);
+    fq2_zero(p.z);
+}
+
+static inline void g2_point_copy(JacobianPointG2& dst, const JacobianPointG2& src) {
+    memcpy(&dst, &src, sizeof(JacobianPointG2));
+}
+
+/**
+ * Point negation: (X, Y, Z) -> (X, -Y, Z)
+ */
+static inline void g2_point_neg(JacobianPointG2& result, const JacobianPointG2& p) {
+    fq2_copy(result.x, p.x);
+    fq2_neg(result.y, p.y);
+    fq2_copy(result.z, p.z);
+}
+
+/**
+ * Point doubling: result = 2p
+ *
+ * Uses the dbl-2009-l formulas (valid for a = 0 curves).
+ */
+static inline void g2_point_double(JacobianPointG2& result, const JacobianPointG2& p) {
+    if (g2_point_is_identity(p)) {
+        g2_point_set_identity(result);
+        return;
+    }
+
+    Fq2 a, b, c, d, e, f, t0, t1;
+
+    fq2_sqr(a, p.x);                 // A = X^2
+    fq2_sqr(b, p.y);                 // B = Y^2
+    fq2_sqr(c, b);                   // C = B^2
+
+    fq2_add(t0, p.x, b);             // X + B
+    fq2_sqr(t0, t0);                 // (X + B)^2
+    fq2_sub(t0, t0, a);
+    fq2_sub(t0, t0, c);
+    fq2_dbl(d, t0);                  // D = 2((X + B)^2 - A - C)
+
+    fq2_dbl(e, a);
+    fq2_add(e, e, a);                // E = 3A
+    fq2_sqr(f, e);                   // F = E^2
+
+    fq2_dbl(t0, d);
+    fq2_sub(result.x, f, t0);        // X3 = F - 2D
+
+    fq2_sub(t0, d, result.x);
+    fq2_mul(t0, e, t0);              // E * (D - X3)
+    fq2_dbl(t1, c);
+    fq2_dbl(t1, t1);
+    fq2_dbl(t1, t1);                 // 8C
+    Fq2 y3;
+    fq2_sub(y3, t0, t1);             // Y3 = E(D - X3) - 8C
+
+    fq2_mul(t0, p.y, p.z);
+    fq2_dbl(result.z, t0);           // Z3 = 2YZ
+
+    fq2_copy(result.y, y3);
+}
+
+/**
+ * Point addition: result = p + q (general Jacobian + Jacobian)
+ *
+ * Uses the add-2007-bl formulas with identity and doubling handling.
+ */
+static inline void g2_point_add(JacobianPointG2& result, const JacobianPointG2& p, const JacobianPointG2& q) {
+    if (g2_point_is_identity(p)) {
+        g2_point_copy(result, q);
+        return;
+    }
+    if (g2_point_is_identity(q)) {
+        g2_point_copy(result, p);
+        return;
+    }
+
+    Fq2 z1z1, z2z2, u1, u2, s1, s2;
+
+    fq2_sqr(z1z1, p.z);              // Z1^2
+    fq2_sqr(z2z2, q.z);              // Z2^2
+    fq2_mul(u1, p.x, z2z2);          // U1 = X1 * Z2^2
+    fq2_mul(u2, q.x, z1z1);          // U2 = X2 * Z1^2
+
+    fq2_mul(s1, q.z, z2z2);
+    fq2_mul(s1, p.y, s1);            // S1 = Y1 * Z2^3
+    fq2_mul(s2, p.z, z1z1);
+    fq2_mul(s2, q.y, s2);            // S2 = Y2 * Z1^3
+
+    if (fq2_equal(u1, u2)) {
+        if (fq2_equal(s1, s2)) {
+            g2_point_double(result, p);
+        } else {
+            g2_point_set_identity(result);
+        }
+        return;
+    }
+
+    Fq2 h, i, j, r, v, t0, t1;
+
+    fq2_sub(h, u2, u1);              // H = U2 - U1
+    fq2_dbl(i, h);
+    fq2_sqr(i, i);                   // I = (2H)^2
+    fq2_mul(j, h, i);                // J = H * I
+    fq2_sub(r, s2, s1);
+    fq2_dbl(r, r);                   // r = 2(S2 - S1)
+    fq2_mul(v, u1, i);               // V = U1 * I
+
+    fq2_sqr(t0, r);
+    fq2_sub(t0, t0, j);
+    fq2_dbl(t1, v);
+    fq2_sub(result.x, t0, t1);       // X3 = r^2 - J - 2V
+
+    fq2_sub(t0, v, result.x);
+    fq2_mul(t0, r, t0);              // r * (V - X3)
+    fq2_mul(t1, s1, j);
+    fq2_dbl(t1, t1);                 // 2 * S1 * J
+    Fq2 y3;
+    fq2_sub(y3, t0, t1);             // Y3 = r(V - X3) - 2*S1*J
+
+    fq2_add(t0, p.z, q.z);
+    fq2_sqr(t0, t0);
+    fq2_sub(t0, t0, z1z1);
+    fq2_sub(t0, t0, z2z2);
+    fq2_mul(result.z, t0, h);        // Z3 = ((Z1 + Z2)^2 - Z1^2 - Z2^2) * H
+
+    fq2_copy(result.y, y3);
+}
+
+/**
+ * Mixed addition: result = p + q where q is affine (Z2 = 1)
+ *
+ * Uses the madd-2007-bl formulas, saving 4 multiplications over the
+ * general addition. This is the hot operation in G2 bucket accumulation.
+ */
+static inline void g2_point_add_mixed(JacobianPointG2& result, const JacobianPointG2& p, const AffinePointG2& q) {
+    if (q.is_infinity) {
+        g2_point_copy(result, p);
+        return;
+    }
+    if (g2_point_is_identity(p)) {
+        fq2_copy(result.x, q.x);
+        fq2_copy(result.y, q.y);
+        fq2_one(result.z);
+        return;
+    }
+
+    Fq2 z1z1, u2, s2;
+
+    fq2_sqr(z1z1, p.z);              // Z1^2
+    fq2_mul(u2, q.x, z1z1);          // U2 = X2 * Z1^2
+    fq2_mul(s2, p.z, z1z1);
+    fq2_mul(s2, q.y, s2);            // S2 = Y2 * Z1^3
+
+    if (fq2_equal(p.x, u2)) {
+        if (fq2_equal(p.y, s2)) {
+            g2_point_double(result, p);
+        } else {
+            g2_point_set_identity(result);
+        }
+        return;
+    }
+
+    Fq2 h, hh, i, j, r, v, t0, t1;
+
+    fq2_sub(h, u2, p.x);             // H = U2 - X1
+    fq2_sqr(hh, h);                  // HH = H^2
+    fq2_dbl(i, hh);
+    fq2_dbl(i, i);                   // I = 4 * HH
+    fq2_mul(j, h, i);                // J = H * I
+    fq2_sub(r, s2, p.y);
+    fq2_dbl(r, r);                   // r = 2(S2 - Y1)
+    fq2_mul(v, p.x, i);              // V = X1 * I
+
+    fq2_sqr(t0, r);
+    fq2_sub(t0, t0, j);
+    fq2_dbl(t1, v);
+    fq2_sub(result.x, t0, t1);       // X3 = r^2 - J - 2V
+
+    fq2_sub(t0, v, result.x);
+    fq2_mul(t0, r, t0);              // r * (V - X3)
+    fq2_mul(t1, p.y, j);
+    fq2_dbl(t1, t1);                 // 2 * Y1 * J
+    Fq2 y3;
+    fq2_sub(y3, t0, t1);             // Y3 = r(V - X3) - 2*Y1*J
+
+    fq2_add(t0, p.z, h);
+    fq2_sqr(t0, t0);
+    fq2_sub(t0, t0, z1z1);
+    fq2_sub(result.z, t0, hh);       // Z3 = (Z1 + H)^2 - Z1^2 - HH
+
+    fq2_copy(result.y, y3);
+}
+
+/**
+ * Load an affine G2 point from a packed 16-limb buffer
+ *
+ * Limb order: x.c0, x.c1, y.c0, y.c1 (4 limbs each). The point at
+ * infinity is encoded as x = y = 0 (not a valid twist point otherwise,
+ * since b' != 0).
+ */
+static inline void g2_affine_from_limbs(AffinePointG2& point, const uint64_t* limbs) {
+    memcpy(point.x.c0.limbs, limbs, 4 * sizeof(uint64_t));
+    memcpy(point.x.c1.limbs, limbs + 4, 4 * sizeof(uint64_t));
+    memcpy(point.y.c0.limbs, limbs + 8, 4 * sizeof(uint64_t));
+    memcpy(point.y.c1.limbs, limbs + 12, 4 * sizeof(uint64_t));
+    point.is_infinity = (fq2_is_zero(point.x) && fq2_is_zero(point.y)) ? 1 : 0;
+    point.padding = 0;
+}
+
+/**
+ * Check that an affine point satisfies the twist equation y^2 = x^3 + b'
+ */
+static inline bool g2_affine_on_curve(const AffinePointG2& point) {
+    if (point.is_infinity) {
+        return true;
+    }
+
+    Fq2 lhs, rhs, b;
+    fq2_sqr(lhs, point.y);
+    fq2_sqr(rhs, point.x);
+    fq2_mul(rhs, rhs, point.x);
+    memcpy(b.c0.limbs, BN254_G2_B_C0, sizeof(b.c0.limbs));
+    memcpy(b.c1.limbs, BN254_G2_B_C1, sizeof(b.c1.limbs));
+    fq2_add(rhs, rhs, b);
+    return fq2_equal(lhs, rhs);
+}
+
+#endif /* POINT_OPS_G2_H */
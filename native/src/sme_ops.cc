@@ -21,6 +21,16 @@
 #include <Accelerate/Accelerate.h>
 #endif
 
+// Direct SME intrinsics need a toolchain with streaming-mode support and
+// the 64-bit integer outer product (FEAT_SME_I16I64, present on M4).
+// Without them the exact Montgomery path below falls back to NEON.
+#if defined(__APPLE__) && defined(__ARM_FEATURE_SME_I16I64)
+#include <arm_sme.h>
+#define SME_INTRINSICS_AVAILABLE 1
+#else
+#define SME_INTRINSICS_AVAILABLE 0
+#endif
+
 // SME is available on M4+ chips with ARM SME extension
 // Detection is done at runtime via sysctl
 static bool g_sme_checked = false;
@@ -204,6 +214,186 @@ bool sme_matrix_accumulate(
 #endif
 }
 
+// ============================================================================
+// SME Montgomery Multiplication (exact, 16-bit digit decomposition)
+// ============================================================================
+
+#if SME_INTRINSICS_AVAILABLE
+
+/**
+ * Full 16x16 digit-product matrix of one 256 x 256-bit multiplication
+ *
+ * UMOPA on 64-bit ZA tiles is a grouped (4-way) widening dot product, so
+ * each operand digit is placed in lane 0 of its own 4-lane group; the
+ * grouped dot product then degenerates to the plain outer product
+ * a_i * b_j. With the 512-bit streaming vector length each tile covers
+ * an 8x8 block of the 16x16 digit matrix, so four outer-product
+ * instructions compute every partial product of the multiplication. The
+ * tile entries are then binned into the digit convolution
+ * conv[k] = sum over i+j=k of a_i * b_j.
+ */
+__arm_locally_streaming __arm_new("za")
+static void sme_digit_product_256(
+    const uint16_t a_digits[16],
+    const uint16_t b_digits[16],
+    uint64_t conv[31]
+) {
+    uint16_t xa_lo[32] = {0}, xa_hi[32] = {0};
+    uint16_t xb_lo[32] = {0}, xb_hi[32] = {0};
+    for (int g = 0; g < 8; g++) {
+        xa_lo[4 * g] = a_digits[g];
+        xa_hi[4 * g] = a_digits[8 + g];
+        xb_lo[4 * g] = b_digits[g];
+        xb_hi[4 * g] = b_digits[8 + g];
+    }
+
+    svbool_t p16 = svptrue_b16();
+    svbool_t p64 = svptrue_b64();
+
+    svuint16_t a_lo = svld1_u16(p16, xa_lo);
+    svuint16_t a_hi = svld1_u16(p16, xa_hi);
+    svuint16_t b_lo = svld1_u16(p16, xb_lo);
+    svuint16_t b_hi = svld1_u16(p16, xb_hi);
+
+    svzero_za();
+    svmopa_za64_u16_m(0, p16, p16, a_lo, b_lo);
+    svmopa_za64_u16_m(1, p16, p16, a_lo, b_hi);
+    svmopa_za64_u16_m(2, p16, p16, a_hi, b_lo);
+    svmopa_za64_u16_m(3, p16, p16, a_hi, b_hi);
+
+    // Tile (ta, tb) holds P[i][j] = a_(i + 8*ta) * b_(j + 8*tb); the ZA
+    // tile index must be an immediate, hence the macro expansion
+    uint64_t row[8];
+#define SME_BIN_TILE(tile, a_base, b_base)                                        \
+    for (uint32_t i = 0; i < 8; i++) {                                            \
+        svst1_u64(p64, row, svread_hor_za64_u64_m(svdup_n_u64(0), p64, tile, i)); \
+        for (uint32_t j = 0; j < 8; j++) {                                        \
+            conv[(a_base) + i + (b_base) + j] += row[j];                          \
+        }                                                                         \
+    }
+    SME_BIN_TILE(0, 0, 0)
+    SME_BIN_TILE(1, 0, 8)
+    SME_BIN_TILE(2, 8, 0)
+    SME_BIN_TILE(3, 8, 8)
+#undef SME_BIN_TILE
+}
+
+/**
+ * One 4-limb Montgomery multiplication with the digit products on SME
+ *
+ * The schoolbook phase runs on the matrix engine; carry resolution and
+ * the Montgomery reduction tail stay on the scalar/NEON side, mirroring
+ * montgomery_mul_limbs<4> in neon_montgomery.cc.
+ */
+static void sme_montgomery_mul_4limb(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* result
+) {
+    uint16_t a_digits[16], b_digits[16];
+    for (int l = 0; l < 4; l++) {
+        for (int d = 0; d < 4; d++) {
+            a_digits[l * 4 + d] = (uint16_t)(a[l] >> (16 * d));
+            b_digits[l * 4 + d] = (uint16_t)(b[l] >> (16 * d));
+        }
+    }
+
+    uint64_t conv[31] = {0};
+    sme_digit_product_256(a_digits, b_digits, conv);
+
+    // Carry resolution: fold the digit convolution into 64-bit limbs.
+    // conv[k] < 16 * (2^16 - 1)^2 < 2^36, so a 128-bit accumulator
+    // absorbs every spill.
+    uint64_t t[9];
+    __uint128_t carry = 0;
+    for (int limb = 0; limb < 8; limb++) {
+        __uint128_t sum = carry;
+        for (int d = 0; d < 4; d++) {
+            int k = limb * 4 + d;
+            if (k < 31) {
+                sum += (__uint128_t)conv[k] << (16 * d);
+            }
+        }
+        t[limb] = (uint64_t)sum;
+        carry = sum >> 64;
+    }
+    t[8] = (uint64_t)carry;
+
+    // Montgomery reduction, same tail as montgomery_mul_limbs<4>
+    for (int i = 0; i < 4; i++) {
+        uint64_t m = t[i] * mu;
+
+        uint64_t c = 0;
+        for (int j = 0; j < 4; j++) {
+            __uint128_t prod = (__uint128_t)m * modulus[j];
+            __uint128_t sum = (__uint128_t)t[i + j] + (uint64_t)prod + c;
+            t[i + j] = (uint64_t)sum;
+            c = (uint64_t)(prod >> 64) + (uint64_t)(sum >> 64);
+        }
+
+        for (int k = i + 4; k < 9 && c; k++) {
+            __uint128_t sum = (__uint128_t)t[k] + c;
+            t[k] = (uint64_t)sum;
+            c = (uint64_t)(sum >> 64);
+        }
+    }
+
+    memcpy(result, t + 4, 4 * sizeof(uint64_t));
+
+    // Final reduction: at most one subtraction; t[8] is the overflow bit
+    bool gte = t[8] != 0;
+    if (!gte) {
+        gte = true;
+        for (int i = 3; i >= 0; i--) {
+            if (result[i] > modulus[i]) break;
+            if (result[i] < modulus[i]) { gte = false; break; }
+        }
+    }
+    if (gte) {
+        uint64_t borrow = 0;
+        for (int i = 0; i < 4; i++) {
+            __uint128_t diff = (__uint128_t)result[i] - modulus[i] - borrow;
+            result[i] = (uint64_t)diff;
+            borrow = (diff >> 64) ? 1 : 0;
+        }
+    }
+}
+
+#endif /* SME_INTRINSICS_AVAILABLE */
+
+/**
+ * Batch Montgomery multiplication on the SME matrix engine
+ *
+ * Exact drop-in for neon_batch_montgomery_mul: 4-limb operands are
+ * decomposed into 16-bit digits and the digit-product matrices computed
+ * with SME outer-product tiles. Falls back to the NEON kernel when SME
+ * intrinsics were not compiled in, the chip lacks SME, the streaming
+ * vector length is not the expected 512 bits, or the limb count is not 4.
+ */
+bool sme_batch_montgomery_mul(
+    const uint64_t* a,
+    const uint64_t* b,
+    const uint64_t* modulus,
+    uint64_t mu,
+    uint64_t* results,
+    size_t count,
+    int limb_count
+) {
+#if SME_INTRINSICS_AVAILABLE
+    if (limb_count == 4 && sme_available() && svcntsd() == 8) {
+        for (size_t i = 0; i < count; i++) {
+            sme_montgomery_mul_4limb(a + i * 4, b + i * 4, modulus, mu, results + i * 4);
+        }
+        return true;
+    }
+#endif
+
+    neon_batch_montgomery_mul(a, b, modulus, mu, results, count, limb_count);
+    return false;
+}
+
 /**
  * Get CPU accelerator status
  *
@@ -0,0 +1,229 @@
+/**
+ * @digitaldefiance/node-zk-accelerate
+ * Memory-mapped SRS loader
+ *
+ * Maps the on-disk SRS format defined in zk_accelerate.h so the fixed
+ * point set for MSM is shared, read-only kernel page cache instead of a
+ * per-process heap copy. The limb pointers feed msm_execute and the
+ * batch kernels directly; srs_prefetch overlaps page-ins with compute
+ * during sequential window passes.
+ *
+ * Requirements: 2.6, 9.1
+ */
+
+#include "../include/zk_accelerate.h"
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Section offsets are page-aligned so mapped sections can be wrapped as
+// GPU buffers (metal_gpu_wrap_external requires page alignment)
+static const uint64_t kSrsSectionAlign = 4096;
+
+static uint64_t srs_align_up(uint64_t offset) {
+    return (offset + kSrsSectionAlign - 1) & ~(kSrsSectionAlign - 1);
+}
+
+/**
+ * Validate a mapped header against the file size
+ */
+static bool srs_header_valid(const SrsFileHeader* header, uint64_t file_size) {
+    if (memcmp(header->magic, SRS_MAGIC, sizeof(header->magic)) != 0) {
+        return false;
+    }
+    if (header->version != SRS_VERSION) {
+        return false;
+    }
+    if (header->num_points == 0 || header->point_limbs == 0) {
+        return false;
+    }
+    if (header->num_scalars != 0 && header->scalar_limbs == 0) {
+        return false;
+    }
+    if (header->points_offset % kSrsSectionAlign != 0) {
+        return false;
+    }
+
+    uint64_t points_bytes = header->num_points * header->point_limbs * sizeof(uint64_t);
+    if (header->points_offset + points_bytes > file_size) {
+        return false;
+    }
+
+    if (header->num_scalars != 0) {
+        uint64_t scalars_bytes = header->num_scalars * header->scalar_limbs * sizeof(uint64_t);
+        if (header->scalars_offset % kSrsSectionAlign != 0 ||
+            header->scalars_offset + scalars_bytes > file_size) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+SrsMapping* srs_open(const char* path) {
+#ifdef _WIN32
+    (void)path;
+    return nullptr;
+#else
+    if (path == nullptr) {
+        return nullptr;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (uint64_t)st.st_size < sizeof(SrsFileHeader)) {
+        close(fd);
+        return nullptr;
+    }
+    size_t file_size = (size_t)st.st_size;
+
+    void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const SrsFileHeader* header = (const SrsFileHeader*)mapping;
+    if (!srs_header_valid(header, file_size)) {
+        munmap(mapping, file_size);
+        return nullptr;
+    }
+
+    SrsMapping* srs = new SrsMapping();
+    srs->mapping = mapping;
+    srs->mapping_size = file_size;
+    srs->points = (const uint64_t*)((const uint8_t*)mapping + header->points_offset);
+    srs->scalars = header->num_scalars != 0
+        ? (const uint64_t*)((const uint8_t*)mapping + header->scalars_offset)
+        : nullptr;
+    srs->num_points = header->num_points;
+    srs->num_scalars = header->num_scalars;
+    srs->point_limbs = header->point_limbs;
+    srs->scalar_limbs = header->scalar_limbs;
+    srs->flags = header->flags;
+
+    // Window passes walk the point section front to back; let readahead
+    // run deep instead of faulting a page at a time
+    madvise((void*)srs->points,
+            (size_t)(srs->num_points * srs->point_limbs * sizeof(uint64_t)),
+            MADV_SEQUENTIAL);
+
+    return srs;
+#endif
+}
+
+void srs_close(SrsMapping* srs) {
+    if (srs == nullptr) {
+        return;
+    }
+
+#ifndef _WIN32
+    if (srs->mapping != nullptr) {
+        munmap(srs->mapping, srs->mapping_size);
+    }
+#endif
+    delete srs;
+}
+
+bool srs_prefetch(const SrsMapping* srs, uint64_t start_point, uint64_t count) {
+#ifdef _WIN32
+    (void)srs;
+    (void)start_point;
+    (void)count;
+    return false;
+#else
+    if (srs == nullptr || srs->points == nullptr || start_point >= srs->num_points) {
+        return false;
+    }
+    if (count > srs->num_points - start_point) {
+        count = srs->num_points - start_point;
+    }
+
+    // Round the range out to page boundaries; madvise requires a
+    // page-aligned start address
+    uintptr_t begin = (uintptr_t)(srs->points + start_point * srs->point_limbs);
+    uintptr_t end = begin + (uintptr_t)(count * srs->point_limbs * sizeof(uint64_t));
+    uintptr_t page = (uintptr_t)getpagesize();
+    begin &= ~(page - 1);
+
+    return madvise((void*)begin, (size_t)(end - begin), MADV_WILLNEED) == 0;
+#endif
+}
+
+bool srs_write(
+    const char* path,
+    const uint64_t* points,
+    uint64_t num_points,
+    uint32_t point_limbs,
+    const uint64_t* scalars,
+    uint64_t num_scalars,
+    uint32_t scalar_limbs,
+    uint32_t flags
+) {
+    if (path == nullptr || points == nullptr || num_points == 0 || point_limbs == 0) {
+        return false;
+    }
+    if (num_scalars != 0 && (scalars == nullptr || scalar_limbs == 0)) {
+        return false;
+    }
+
+    uint64_t points_bytes = num_points * point_limbs * sizeof(uint64_t);
+
+    SrsFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SRS_MAGIC, sizeof(header.magic));
+    header.version = SRS_VERSION;
+    header.flags = flags;
+    header.num_points = num_points;
+    header.num_scalars = num_scalars;
+    header.point_limbs = point_limbs;
+    header.scalar_limbs = scalar_limbs;
+    header.points_offset = srs_align_up(sizeof(SrsFileHeader));
+    header.scalars_offset = num_scalars != 0
+        ? srs_align_up(header.points_offset + points_bytes)
+        : 0;
+
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+
+    // Zero padding up to each page-aligned section start
+    static const char zeros[4096] = {0};
+    if (ok) {
+        uint64_t pad = header.points_offset - sizeof(SrsFileHeader);
+        ok = pad == 0 || fwrite(zeros, (size_t)pad, 1, file) == 1;
+    }
+    if (ok) {
+        ok = fwrite(points, (size_t)points_bytes, 1, file) == 1;
+    }
+    if (ok && num_scalars != 0) {
+        uint64_t pad = header.scalars_offset - (header.points_offset + points_bytes);
+        ok = pad == 0 || fwrite(zeros, (size_t)pad, 1, file) == 1;
+        if (ok) {
+            ok = fwrite(scalars, (size_t)(num_scalars * scalar_limbs * sizeof(uint64_t)), 1, file) == 1;
+        }
+    }
+
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    if (!ok) {
+        remove(path);
+    }
+    return ok;
+}
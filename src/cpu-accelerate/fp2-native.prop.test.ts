@@ -0,0 +1,172 @@
+/**
+ * Property-Based Tests for the Native Batch Fp2 Montgomery Multiply
+ *
+ * **Property 1: Each batch lane computes a * b in Fp2 = Fp[u]/(u^2+1)**
+ * **Property 2: The kernel is generic over the limb count (BN254 and
+ * BLS12-381 base fields)**
+ *
+ * Inputs and outputs are interleaved (c0, c1) coefficient pairs in
+ * Montgomery form, so the test converts canonical values in and out
+ * itself and compares against a plain bigint Fp2 reference. Skipped
+ * when the C++ addon is not available.
+ *
+ * **Validates: Requirements 4.1, 4.6**
+ */
+
+import { describe, it, expect } from 'vitest';
+import * as fc from 'fast-check';
+import {
+  PROPERTY_TEST_CONFIG,
+  arbitraryFieldValue,
+  modInverse,
+  BN254_BASE_MODULUS,
+  BLS12_381_BASE_MODULUS,
+} from '../test-utils/property-test-config.js';
+import {
+  bigintToLimbs,
+  limbsToBigintAt,
+  toMontgomery,
+  fromMontgomery,
+  fp2Mul,
+  type Fp2,
+} from '../test-utils/native-test-helpers.js';
+import { loadCppBinding } from '../native.js';
+
+const binding = loadCppBinding();
+
+/**
+ * Montgomery constant mu = -p^-1 mod 2^64 for an odd modulus
+ */
+function computeMontgomeryMu(modulus: bigint): bigint {
+  const base = 1n << 64n;
+  return (base - modInverse(modulus % base, base)) % base;
+}
+
+/**
+ * Pack canonical Fp2 elements into interleaved Montgomery limb pairs
+ */
+function encodeFp2Batch(elements: Fp2[], modulus: bigint, limbCount: number): BigUint64Array {
+  const out = new BigUint64Array(elements.length * limbCount * 2);
+  for (let i = 0; i < elements.length; i++) {
+    const element = elements[i]!;
+    out.set(
+      bigintToLimbs(toMontgomery(element.c0, modulus, limbCount), limbCount),
+      i * limbCount * 2
+    );
+    out.set(
+      bigintToLimbs(toMontgomery(element.c1, modulus, limbCount), limbCount),
+      i * limbCount * 2 + limbCount
+    );
+  }
+  return out;
+}
+
+/**
+ * Unpack interleaved Montgomery limb pairs back to canonical Fp2
+ */
+function decodeFp2Batch(
+  limbs: BigUint64Array,
+  count: number,
+  modulus: bigint,
+  limbCount: number
+): Fp2[] {
+  const out = new Array<Fp2>(count);
+  for (let i = 0; i < count; i++) {
+    out[i] = {
+      c0: fromMontgomery(limbsToBigintAt(limbs, i * limbCount * 2, limbCount), modulus, limbCount),
+      c1: fromMontgomery(
+        limbsToBigintAt(limbs, i * limbCount * 2 + limbCount, limbCount),
+        modulus,
+        limbCount
+      ),
+    };
+  }
+  return out;
+}
+
+/**
+ * Arbitrary matched pair of canonical Fp2 batches
+ */
+function arbitraryFp2PairBatch(
+  modulus: bigint,
+  maxCount: number
+): fc.Arbitrary<{ a: Fp2[]; b: Fp2[] }> {
+  const element = fc
+    .tuple(arbitraryFieldValue(modulus), arbitraryFieldValue(modulus))
+    .map(([c0, c1]) => ({ c0, c1 }));
+  return fc
+    .integer({ min: 1, max: maxCount })
+    .chain((size) =>
+      fc.tuple(
+        fc.array(element, { minLength: size, maxLength: size }),
+        fc.array(element, { minLength: size, maxLength: size })
+      )
+    )
+    .map(([a, b]) => ({ a, b }));
+}
+
+/**
+ * Run the kernel and check every lane against the bigint reference
+ */
+function checkBatch(a: Fp2[], b: Fp2[], modulus: bigint, limbCount: number): void {
+  const count = a.length;
+  const result = binding!.neonBatchFp2MontgomeryMul!(
+    encodeFp2Batch(a, modulus, limbCount),
+    encodeFp2Batch(b, modulus, limbCount),
+    bigintToLimbs(modulus, limbCount),
+    computeMontgomeryMu(modulus),
+    count,
+    limbCount
+  );
+
+  const decoded = decodeFp2Batch(result, count, modulus, limbCount);
+  for (let i = 0; i < count; i++) {
+    expect(decoded[i]).toEqual(fp2Mul(a[i]!, b[i]!, modulus));
+  }
+}
+
+describe.skipIf(binding?.neonBatchFp2MontgomeryMul === undefined)(
+  'Native batch Fp2 Montgomery multiply',
+  () => {
+    it('matches the bigint Fp2 reference over the BN254 base field', () => {
+      fc.assert(
+        fc.property(arbitraryFp2PairBatch(BN254_BASE_MODULUS, 8), ({ a, b }) => {
+          checkBatch(a, b, BN254_BASE_MODULUS, 4);
+        }),
+        PROPERTY_TEST_CONFIG
+      );
+    });
+
+    it('matches the bigint Fp2 reference over the BLS12-381 base field', () => {
+      fc.assert(
+        fc.property(arbitraryFp2PairBatch(BLS12_381_BASE_MODULUS, 8), ({ a, b }) => {
+          checkBatch(a, b, BLS12_381_BASE_MODULUS, 6);
+        }),
+        PROPERTY_TEST_CONFIG
+      );
+    });
+
+    it('multiplies by one and zero correctly', () => {
+      const one: Fp2 = { c0: 1n, c1: 0n };
+      const zero: Fp2 = { c0: 0n, c1: 0n };
+      const x: Fp2 = { c0: 12345678901234567890n, c1: 9876543210987654321n };
+
+      checkBatch([x, x], [one, zero], BN254_BASE_MODULUS, 4);
+    });
+
+    it('squares u to -1', () => {
+      const u: Fp2 = { c0: 0n, c1: 1n };
+      const result = binding!.neonBatchFp2MontgomeryMul!(
+        encodeFp2Batch([u], BN254_BASE_MODULUS, 4),
+        encodeFp2Batch([u], BN254_BASE_MODULUS, 4),
+        bigintToLimbs(BN254_BASE_MODULUS, 4),
+        computeMontgomeryMu(BN254_BASE_MODULUS),
+        1,
+        4
+      );
+
+      const decoded = decodeFp2Batch(result, 1, BN254_BASE_MODULUS, 4);
+      expect(decoded[0]).toEqual({ c0: BN254_BASE_MODULUS - 1n, c1: 0n });
+    });
+  }
+);
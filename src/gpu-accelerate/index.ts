@@ -17,6 +17,7 @@ export {
   type GPUBuffer,
   type GPUPipeline,
   type GPUResult,
+  type GPUStageStats,
 } from './metal.js';
 
 export {
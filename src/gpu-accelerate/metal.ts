@@ -63,6 +63,27 @@ export interface MetalGPUStatus {
   readonly deviceName: string;
 }
 
+/**
+ * Aggregated GPU-side statistics for one compute stage
+ *
+ * Times come from Metal timestamp sample buffers at encoder boundaries,
+ * so they cover kernel execution only — no queueing or host wait time.
+ */
+export interface GPUStageStats {
+  /** Stage name (kernel name or pass label, e.g. ntt_butterfly_stage_3) */
+  readonly stage: string;
+  /** Number of profiled invocations */
+  readonly count: number;
+  /** Total GPU time in milliseconds */
+  readonly gpuMs: number;
+  /** Average threadgroup occupancy (threadsPerGroup / maxThreadsPerGroup) */
+  readonly occupancy: number;
+  /** Dispatched threadgroup size */
+  readonly threadsPerGroup: number;
+  /** Pipeline maxTotalThreadsPerThreadgroup */
+  readonly maxThreadsPerGroup: number;
+}
+
 /**
  * Extended native binding interface with Metal GPU functions
  */
@@ -72,6 +93,9 @@ interface MetalNativeBinding extends NativeCppBinding {
   metalGpuShutdown?(): void;
   metalGpuIsAvailable?(): boolean;
   metalGpuGetStatus?(): MetalGPUStatus;
+  metalGpuProfilingSetEnabled?(enabled: boolean): void;
+  metalGpuProfilingSnapshot?(): GPUStageStats[];
+  metalGpuProfilingReset?(): void;
   metalGpuAllocBuffer?(size: number, shared: boolean): GPUBuffer | null;
   metalGpuFreeBuffer?(bufferId: number): void;
   metalGpuCopyToBuffer?(bufferId: number, data: Uint8Array, offset: number): boolean;
@@ -256,6 +280,35 @@ export class MetalGPU {
     }
   }
 
+  /**
+   * Enable or disable GPU stage profiling
+   *
+   * Off by default (ZK_ACCELERATE_GPU_PROFILE=1 enables it at startup).
+   * When enabled, dispatches sample GPU timestamps around each encoder
+   * so time is attributed to individual stages instead of the single
+   * wall-clock executionTimeMs.
+   */
+  setProfilingEnabled(enabled: boolean): void {
+    this.binding?.metalGpuProfilingSetEnabled?.(enabled);
+  }
+
+  /**
+   * Snapshot per-stage GPU timestamp statistics
+   *
+   * Empty unless profiling is enabled and dispatches have run since the
+   * last reset.
+   */
+  getStageStats(): GPUStageStats[] {
+    return this.binding?.metalGpuProfilingSnapshot?.() ?? [];
+  }
+
+  /**
+   * Reset the GPU stage statistics
+   */
+  resetStageStats(): void {
+    this.binding?.metalGpuProfilingReset?.();
+  }
+
   /**
    * Allocate a GPU buffer
    *
@@ -294,6 +294,7 @@ export {
   type GPUBuffer,
   type GPUPipeline,
   type GPUResult,
+  type GPUStageStats,
   type GPUAcceleratorStatus,
   type MSMGPUConfig,
   type MSMGPUResult,
@@ -0,0 +1,209 @@
+/**
+ * Property-Based Tests for the Native Fixed-Base Tables
+ *
+ * **Property 1: Table-driven scalar multiplication matches the
+ * TypeScript reference for full-range scalars**
+ * **Property 2: Every window size produces the same product**
+ * **Property 3: Serialization round-trips the precomputed table**
+ *
+ * Fixed-base tables precompute window multiples of one point so each
+ * scalar multiplication is a short chain of additions; the result must
+ * be indistinguishable from a plain double-and-add. Suites are skipped
+ * when the C++ addon is not available.
+ *
+ * **Validates: Requirements 2.1, 2.6**
+ */
+
+import { describe, it, expect } from 'vitest';
+import * as fc from 'fast-check';
+import {
+  FAST_PROPERTY_TEST_CONFIG,
+  PROPERTY_TEST_CONFIG,
+  arbitrarySmallScalar,
+  arbitraryScalarValue,
+} from '../test-utils/property-test-config.js';
+import {
+  bigintToLimbs,
+  affinePointToMontLimbs,
+  jacobianMontLimbsToAffine,
+  type AffineBigintPoint,
+} from '../test-utils/native-test-helpers.js';
+import { BN254_CURVE } from '../curve/config.js';
+import { toAffine } from '../curve/point.js';
+import { scalarMul } from '../curve/operations.js';
+import { getFieldElementValue } from '../field/element.js';
+import { loadCppBinding } from '../native.js';
+
+const binding = loadCppBinding();
+
+const MODULUS = BN254_CURVE.field.modulus;
+
+/**
+ * Encode one multiple of the BN254 generator as a native base point
+ */
+function encodeBasePoint(pointScalar: bigint): BigUint64Array {
+  const point = toAffine(scalarMul(pointScalar, BN254_CURVE.generator, BN254_CURVE), BN254_CURVE);
+  return affinePointToMontLimbs(
+    getFieldElementValue(point.x),
+    getFieldElementValue(point.y),
+    MODULUS,
+    4
+  );
+}
+
+/**
+ * Compute the expected product with the TypeScript curve operations
+ */
+function referenceMul(scalar: bigint, pointScalar: bigint): AffineBigintPoint {
+  const base = scalarMul(pointScalar, BN254_CURVE.generator, BN254_CURVE);
+  const affine = toAffine(scalarMul(scalar, base, BN254_CURVE), BN254_CURVE);
+  return {
+    x: getFieldElementValue(affine.x),
+    y: getFieldElementValue(affine.y),
+    isInfinity: affine.isInfinity,
+  };
+}
+
+const hasFixedBase =
+  binding?.fixedBaseTableCreate !== undefined &&
+  binding?.fixedBaseMul !== undefined &&
+  binding?.fixedBaseTableDestroy !== undefined;
+
+describe.skipIf(!hasFixedBase)('Native fixed-base tables', () => {
+  it('matches the TypeScript reference for small scalars', () => {
+    fc.assert(
+      fc.property(arbitrarySmallScalar(), arbitrarySmallScalar(), (scalar, pointScalar) => {
+        const table = binding!.fixedBaseTableCreate!(encodeBasePoint(pointScalar));
+        try {
+          const native = jacobianMontLimbsToAffine(
+            binding!.fixedBaseMul!(table, bigintToLimbs(scalar, 4)),
+            MODULUS,
+            4
+          );
+
+          expect(native).toEqual(referenceMul(scalar, pointScalar));
+        } finally {
+          binding!.fixedBaseTableDestroy!(table);
+        }
+      }),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('matches the TypeScript reference for full-range scalars', () => {
+    fc.assert(
+      fc.property(arbitraryScalarValue('BN254'), (scalar) => {
+        const table = binding!.fixedBaseTableCreate!(encodeBasePoint(1n));
+        try {
+          const native = jacobianMontLimbsToAffine(
+            binding!.fixedBaseMul!(table, bigintToLimbs(scalar, 4)),
+            MODULUS,
+            4
+          );
+
+          expect(native).toEqual(referenceMul(scalar, 1n));
+        } finally {
+          binding!.fixedBaseTableDestroy!(table);
+        }
+      }),
+      FAST_PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('produces the same product for every window size', () => {
+    fc.assert(
+      fc.property(
+        arbitraryScalarValue('BN254'),
+        fc.integer({ min: 4, max: 12 }),
+        (scalar, windowSize) => {
+          const basePoint = encodeBasePoint(1n);
+          const defaultTable = binding!.fixedBaseTableCreate!(basePoint);
+          const sizedTable = binding!.fixedBaseTableCreate!(basePoint, windowSize);
+          try {
+            expect(sizedTable.windowSize).toBe(windowSize);
+
+            const scalarLimbs = bigintToLimbs(scalar, 4);
+            const fromDefault = jacobianMontLimbsToAffine(
+              binding!.fixedBaseMul!(defaultTable, scalarLimbs),
+              MODULUS,
+              4
+            );
+            const fromSized = jacobianMontLimbsToAffine(
+              binding!.fixedBaseMul!(sizedTable, scalarLimbs),
+              MODULUS,
+              4
+            );
+
+            expect(fromSized).toEqual(fromDefault);
+          } finally {
+            binding!.fixedBaseTableDestroy!(defaultTable);
+            binding!.fixedBaseTableDestroy!(sizedTable);
+          }
+        }
+      ),
+      FAST_PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('round-trips through serialize and deserialize', () => {
+    const canSerialize =
+      binding?.fixedBaseTableSerialize !== undefined &&
+      binding?.fixedBaseTableDeserialize !== undefined;
+    if (!canSerialize) {
+      return;
+    }
+
+    fc.assert(
+      fc.property(arbitraryScalarValue('BN254'), (scalar) => {
+        const table = binding!.fixedBaseTableCreate!(encodeBasePoint(1n));
+        let restored: object | null = null;
+        try {
+          restored = binding!.fixedBaseTableDeserialize!(
+            binding!.fixedBaseTableSerialize!(table)
+          );
+
+          const scalarLimbs = bigintToLimbs(scalar, 4);
+          const original = jacobianMontLimbsToAffine(
+            binding!.fixedBaseMul!(table, scalarLimbs),
+            MODULUS,
+            4
+          );
+          const roundTripped = jacobianMontLimbsToAffine(
+            binding!.fixedBaseMul!(restored, scalarLimbs),
+            MODULUS,
+            4
+          );
+
+          expect(roundTripped).toEqual(original);
+        } finally {
+          binding!.fixedBaseTableDestroy!(table);
+          if (restored !== null) {
+            binding!.fixedBaseTableDestroy!(restored);
+          }
+        }
+      }),
+      FAST_PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('returns the point at infinity for a zero scalar', () => {
+    const table = binding!.fixedBaseTableCreate!(encodeBasePoint(1n));
+    try {
+      const result = jacobianMontLimbsToAffine(
+        binding!.fixedBaseMul!(table, new BigUint64Array(4)),
+        MODULUS,
+        4
+      );
+      expect(result.isInfinity).toBe(true);
+    } finally {
+      binding!.fixedBaseTableDestroy!(table);
+    }
+  });
+
+  it('invalidates the table handle on destroy', () => {
+    const table = binding!.fixedBaseTableCreate!(encodeBasePoint(1n));
+    binding!.fixedBaseTableDestroy!(table);
+
+    expect(() => binding!.fixedBaseMul!(table, bigintToLimbs(1n, 4))).toThrow();
+  });
+});
@@ -0,0 +1,235 @@
+/**
+ * Property-Based Tests for the Native Incremental MSM
+ *
+ * **Property 1: A fresh incremental commit matches the one-shot MSM**
+ * **Property 2: Scalar updates converge to the one-shot MSM result**
+ * **Property 3: Serialization round-trips the bucket state**
+ *
+ * The incremental state maintains per-window buckets so single-scalar
+ * changes cost O(windows) point operations instead of a full recompute;
+ * every commit must still equal msmExecute over the current scalar
+ * vector. Suites are skipped when the C++ addon is not available.
+ *
+ * **Validates: Requirements 2.1, 2.6**
+ */
+
+import { describe, it, expect } from 'vitest';
+import * as fc from 'fast-check';
+import {
+  PROPERTY_TEST_CONFIG,
+  FAST_PROPERTY_TEST_CONFIG,
+  arbitrarySmallScalar,
+} from '../test-utils/property-test-config.js';
+import {
+  bigintToLimbs,
+  affinePointToMontLimbs,
+  jacobianMontLimbsToAffine,
+  type AffineBigintPoint,
+} from '../test-utils/native-test-helpers.js';
+import { BN254_CURVE } from '../curve/config.js';
+import { toAffine } from '../curve/point.js';
+import { scalarMul } from '../curve/operations.js';
+import { getFieldElementValue } from '../field/element.js';
+import { loadCppBinding } from '../native.js';
+
+const binding = loadCppBinding();
+
+const MODULUS = BN254_CURVE.field.modulus;
+
+/**
+ * Encode multiples of the BN254 generator into the native point format
+ */
+function encodePoints(pointScalars: bigint[]): BigUint64Array {
+  const out = new BigUint64Array(pointScalars.length * 8);
+  for (let i = 0; i < pointScalars.length; i++) {
+    const point = toAffine(scalarMul(pointScalars[i]!, BN254_CURVE.generator, BN254_CURVE), BN254_CURVE);
+    out.set(
+      affinePointToMontLimbs(
+        getFieldElementValue(point.x),
+        getFieldElementValue(point.y),
+        MODULUS,
+        4
+      ),
+      i * 8
+    );
+  }
+  return out;
+}
+
+/**
+ * Encode a scalar vector into packed 4-limb rows
+ */
+function encodeScalars(scalars: bigint[]): BigUint64Array {
+  const out = new BigUint64Array(scalars.length * 4);
+  for (let i = 0; i < scalars.length; i++) {
+    out.set(bigintToLimbs(scalars[i]!, 4), i * 4);
+  }
+  return out;
+}
+
+/**
+ * Decode a 12-limb Jacobian result to canonical affine coordinates
+ */
+function decodeResult(result: BigUint64Array): AffineBigintPoint {
+  return jacobianMontLimbsToAffine(result, MODULUS, 4);
+}
+
+/**
+ * Generate matched point-multiplier and scalar arrays
+ */
+function arbitraryIncrementalInput(
+  maxSize: number
+): fc.Arbitrary<{ pointScalars: bigint[]; scalars: bigint[] }> {
+  return fc
+    .integer({ min: 1, max: maxSize })
+    .chain((size) =>
+      fc.tuple(
+        fc.array(arbitrarySmallScalar(), { minLength: size, maxLength: size }),
+        fc.array(arbitrarySmallScalar(), { minLength: size, maxLength: size })
+      )
+    )
+    .map(([pointScalars, scalars]) => ({ pointScalars, scalars }));
+}
+
+const hasIncremental =
+  binding?.msmIncrementalCreate !== undefined &&
+  binding?.msmIncrementalUpdate !== undefined &&
+  binding?.msmIncrementalCommit !== undefined &&
+  binding?.msmIncrementalDestroy !== undefined &&
+  binding?.msmExecute !== undefined;
+
+describe.skipIf(!hasIncremental)('Native incremental MSM', () => {
+  it('commits the same result as the one-shot MSM', () => {
+    fc.assert(
+      fc.property(arbitraryIncrementalInput(8), ({ pointScalars, scalars }) => {
+        const n = scalars.length;
+        const points = encodePoints(pointScalars);
+        const scalarLimbs = encodeScalars(scalars);
+
+        const state = binding!.msmIncrementalCreate!(points, scalarLimbs, n);
+        try {
+          const incremental = decodeResult(binding!.msmIncrementalCommit!(state));
+          const oneShot = decodeResult(binding!.msmExecute!(points, scalarLimbs, n));
+
+          expect(incremental).toEqual(oneShot);
+        } finally {
+          binding!.msmIncrementalDestroy!(state);
+        }
+      }),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('converges to the one-shot result as zero scalars are filled in', () => {
+    fc.assert(
+      fc.property(arbitraryIncrementalInput(8), ({ pointScalars, scalars }) => {
+        const n = scalars.length;
+        const points = encodePoints(pointScalars);
+
+        const state = binding!.msmIncrementalCreate!(points, null, n);
+        try {
+          const zero = bigintToLimbs(0n, 4);
+          for (let i = 0; i < n; i++) {
+            const updated = binding!.msmIncrementalUpdate!(
+              state,
+              i,
+              zero,
+              bigintToLimbs(scalars[i]!, 4)
+            );
+            expect(updated).toBe(true);
+          }
+
+          const incremental = decodeResult(binding!.msmIncrementalCommit!(state));
+          const oneShot = decodeResult(binding!.msmExecute!(points, encodeScalars(scalars), n));
+
+          expect(incremental).toEqual(oneShot);
+        } finally {
+          binding!.msmIncrementalDestroy!(state);
+        }
+      }),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('tracks a single scalar change without a full recompute', () => {
+    fc.assert(
+      fc.property(
+        arbitraryIncrementalInput(8),
+        arbitrarySmallScalar(),
+        fc.nat(),
+        ({ pointScalars, scalars }, newScalar, indexSeed) => {
+          const n = scalars.length;
+          const index = indexSeed % n;
+          const points = encodePoints(pointScalars);
+
+          const state = binding!.msmIncrementalCreate!(points, encodeScalars(scalars), n);
+          try {
+            const updated = binding!.msmIncrementalUpdate!(
+              state,
+              index,
+              bigintToLimbs(scalars[index]!, 4),
+              bigintToLimbs(newScalar, 4)
+            );
+            expect(updated).toBe(true);
+
+            const modified = scalars.slice();
+            modified[index] = newScalar;
+
+            const incremental = decodeResult(binding!.msmIncrementalCommit!(state));
+            const oneShot = decodeResult(
+              binding!.msmExecute!(points, encodeScalars(modified), n)
+            );
+
+            expect(incremental).toEqual(oneShot);
+          } finally {
+            binding!.msmIncrementalDestroy!(state);
+          }
+        }
+      ),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('round-trips through serialize and deserialize', () => {
+    const canSerialize =
+      binding?.msmIncrementalSerialize !== undefined &&
+      binding?.msmIncrementalDeserialize !== undefined;
+    if (!canSerialize) {
+      return;
+    }
+
+    fc.assert(
+      fc.property(arbitraryIncrementalInput(8), ({ pointScalars, scalars }) => {
+        const n = scalars.length;
+        const points = encodePoints(pointScalars);
+        const scalarLimbs = encodeScalars(scalars);
+
+        const state = binding!.msmIncrementalCreate!(points, scalarLimbs, n);
+        let restored: { n: number } | null = null;
+        try {
+          const snapshot = binding!.msmIncrementalSerialize!(state);
+          restored = binding!.msmIncrementalDeserialize!(points, n, snapshot);
+
+          const original = decodeResult(binding!.msmIncrementalCommit!(state));
+          const roundTripped = decodeResult(binding!.msmIncrementalCommit!(restored));
+
+          expect(roundTripped).toEqual(original);
+        } finally {
+          binding!.msmIncrementalDestroy!(state);
+          if (restored !== null) {
+            binding!.msmIncrementalDestroy!(restored);
+          }
+        }
+      }),
+      FAST_PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('invalidates the state handle on destroy', () => {
+    const points = encodePoints([1n]);
+    const state = binding!.msmIncrementalCreate!(points, encodeScalars([1n]), 1);
+
+    binding!.msmIncrementalDestroy!(state);
+    expect(() => binding!.msmIncrementalCommit!(state)).toThrow();
+  });
+});
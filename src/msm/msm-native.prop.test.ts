@@ -0,0 +1,419 @@
+/**
+ * Property-Based Tests for the Native MSM Kernels
+ *
+ * **Property 1: Native BN254 G1 MSM matches the TypeScript reference**
+ * **Property 2: Native BLS12-381 G1 MSM matches the TypeScript reference**
+ * **Property 3: Native BN254 G2 MSM matches an affine Fp2 reference**
+ * **Property 4: Signed-digit recoding reconstructs every scalar exactly**
+ *
+ * The native kernels exchange raw limb arrays (points in Montgomery
+ * form, scalars as plain reduced integers), so these tests encode the
+ * inputs themselves and decode the Jacobian results back to canonical
+ * affine coordinates for comparison. All suites are skipped when the
+ * C++ addon is not available on the host platform.
+ *
+ * **Validates: Requirements 2.1, 2.2, 2.6**
+ */
+
+import { describe, it, expect } from 'vitest';
+import * as fc from 'fast-check';
+import {
+  PROPERTY_TEST_CONFIG,
+  arbitrarySmallScalar,
+  arbitraryFieldValue,
+  BN254_BASE_MODULUS,
+  BN254_SCALAR_MODULUS,
+} from '../test-utils/property-test-config.js';
+import {
+  bigintToLimbs,
+  affinePointToMontLimbs,
+  jacobianMontLimbsToAffine,
+  g2AffinePointToMontLimbs,
+  g2JacobianMontLimbsToAffine,
+  fp2Add,
+  fp2Sub,
+  fp2Mul,
+  fp2Inv,
+  type Fp2,
+} from '../test-utils/native-test-helpers.js';
+import { BN254_CURVE, BLS12_381_CURVE } from '../curve/config.js';
+import { toAffine } from '../curve/point.js';
+import { scalarMul, pointAdd } from '../curve/operations.js';
+import { getFieldElementValue } from '../field/element.js';
+import { loadCppBinding } from '../native.js';
+import type { CurveConfig } from '../types.js';
+
+const binding = loadCppBinding();
+
+/**
+ * Encode n affine points and scalars into the native wire format and
+ * run the synchronous G1 MSM kernel for the given curve
+ */
+function runNativeG1Msm(
+  msmFn: (points: BigUint64Array, scalars: BigUint64Array, n: number) => BigUint64Array,
+  curve: CurveConfig,
+  scalars: bigint[],
+  pointScalars: bigint[]
+): { x: bigint; y: bigint; isInfinity: boolean } {
+  const limbCount = curve.field.limbCount;
+  const modulus = curve.field.modulus;
+  const n = scalars.length;
+
+  const pointLimbs = new BigUint64Array(n * 2 * limbCount);
+  for (let i = 0; i < n; i++) {
+    const point = toAffine(scalarMul(pointScalars[i]!, curve.generator, curve), curve);
+    const encoded = affinePointToMontLimbs(
+      getFieldElementValue(point.x),
+      getFieldElementValue(point.y),
+      modulus,
+      limbCount
+    );
+    pointLimbs.set(encoded, i * 2 * limbCount);
+  }
+
+  const scalarLimbs = new BigUint64Array(n * 4);
+  for (let i = 0; i < n; i++) {
+    scalarLimbs.set(bigintToLimbs(scalars[i]!, 4), i * 4);
+  }
+
+  return jacobianMontLimbsToAffine(msmFn(pointLimbs, scalarLimbs, n), modulus, limbCount);
+}
+
+/**
+ * Compute the expected MSM result with the TypeScript curve operations
+ */
+function referenceG1Msm(
+  curve: CurveConfig,
+  scalars: bigint[],
+  pointScalars: bigint[]
+): { x: bigint; y: bigint; isInfinity: boolean } {
+  let acc = scalarMul(scalars[0]!, scalarMul(pointScalars[0]!, curve.generator, curve), curve);
+  for (let i = 1; i < scalars.length; i++) {
+    const term = scalarMul(scalars[i]!, scalarMul(pointScalars[i]!, curve.generator, curve), curve);
+    acc = pointAdd(acc, term, curve);
+  }
+  const affine = toAffine(acc, curve);
+  return {
+    x: getFieldElementValue(affine.x),
+    y: getFieldElementValue(affine.y),
+    isInfinity: affine.isInfinity,
+  };
+}
+
+/**
+ * Generate matched scalar/point-multiplier arrays for MSM inputs
+ */
+function arbitraryMsmInput(
+  maxSize: number
+): fc.Arbitrary<{ scalars: bigint[]; pointScalars: bigint[] }> {
+  return fc
+    .integer({ min: 1, max: maxSize })
+    .chain((size) =>
+      fc.tuple(
+        fc.array(arbitrarySmallScalar(), { minLength: size, maxLength: size }),
+        fc.array(arbitrarySmallScalar(), { minLength: size, maxLength: size })
+      )
+    )
+    .map(([scalars, pointScalars]) => ({ scalars, pointScalars }));
+}
+
+describe.skipIf(binding?.msmExecute === undefined)('Native BN254 G1 MSM', () => {
+  it('matches the TypeScript reference MSM', () => {
+    const msmExecute = binding!.msmExecute!;
+
+    fc.assert(
+      fc.property(arbitraryMsmInput(8), ({ scalars, pointScalars }) => {
+        const native = runNativeG1Msm(msmExecute, BN254_CURVE, scalars, pointScalars);
+        const expected = referenceG1Msm(BN254_CURVE, scalars, pointScalars);
+
+        expect(native.isInfinity).toBe(expected.isInfinity);
+        expect(native.x).toBe(expected.x);
+        expect(native.y).toBe(expected.y);
+      }),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('returns the point at infinity for an all-zero scalar', () => {
+    const msmExecute = binding!.msmExecute!;
+
+    const generator = BN254_CURVE.generator;
+    const points = affinePointToMontLimbs(
+      getFieldElementValue(generator.x),
+      getFieldElementValue(generator.y),
+      BN254_CURVE.field.modulus,
+      BN254_CURVE.field.limbCount
+    );
+    const result = msmExecute(points, new BigUint64Array(4), 1);
+
+    const affine = jacobianMontLimbsToAffine(result, BN254_CURVE.field.modulus, 4);
+    expect(affine.isInfinity).toBe(true);
+  });
+});
+
+describe.skipIf(binding?.msmExecuteBls12381 === undefined)('Native BLS12-381 G1 MSM', () => {
+  it('matches the TypeScript reference MSM', () => {
+    const msmExecuteBls12381 = binding!.msmExecuteBls12381!;
+
+    fc.assert(
+      fc.property(arbitraryMsmInput(8), ({ scalars, pointScalars }) => {
+        const native = runNativeG1Msm(msmExecuteBls12381, BLS12_381_CURVE, scalars, pointScalars);
+        const expected = referenceG1Msm(BLS12_381_CURVE, scalars, pointScalars);
+
+        expect(native.isInfinity).toBe(expected.isInfinity);
+        expect(native.x).toBe(expected.x);
+        expect(native.y).toBe(expected.y);
+      }),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+});
+
+// ============================================================================
+// BN254 G2 reference (affine Fp2 arithmetic, test-only)
+// ============================================================================
+
+/**
+ * Affine G2 point over Fp2, or the point at infinity
+ */
+type G2Point = { x: Fp2; y: Fp2 } | null;
+
+const G2_MODULUS = BN254_BASE_MODULUS;
+
+/**
+ * Generator of the BN254 G2 prime-order subgroup on the sextic twist
+ * y^2 = x^3 + 3/(9 + u)
+ */
+const G2_GENERATOR: { x: Fp2; y: Fp2 } = {
+  x: {
+    c0: 10857046999023057135944570762232829481370756359578518086990519993285655852781n,
+    c1: 11559732032986387107991004021392285783925812861821192530917403151452391805634n,
+  },
+  y: {
+    c0: 8495653923123431417604973247489272438418190587263600148770280649306958101930n,
+    c1: 4082367875863433681332203403145435568316851327593401208105741076214120093531n,
+  },
+};
+
+function g2Add(p: G2Point, q: G2Point): G2Point {
+  if (p === null) return q;
+  if (q === null) return p;
+
+  if (p.x.c0 === q.x.c0 && p.x.c1 === q.x.c1) {
+    const negY = fp2Sub({ c0: 0n, c1: 0n }, q.y, G2_MODULUS);
+    if (p.y.c0 === negY.c0 && p.y.c1 === negY.c1) {
+      return null;
+    }
+    return g2Double(p);
+  }
+
+  const lambda = fp2Mul(
+    fp2Sub(q.y, p.y, G2_MODULUS),
+    fp2Inv(fp2Sub(q.x, p.x, G2_MODULUS), G2_MODULUS),
+    G2_MODULUS
+  );
+  const x3 = fp2Sub(fp2Sub(fp2Mul(lambda, lambda, G2_MODULUS), p.x, G2_MODULUS), q.x, G2_MODULUS);
+  const y3 = fp2Sub(fp2Mul(lambda, fp2Sub(p.x, x3, G2_MODULUS), G2_MODULUS), p.y, G2_MODULUS);
+  return { x: x3, y: y3 };
+}
+
+function g2Double(p: { x: Fp2; y: Fp2 }): G2Point {
+  if (p.y.c0 === 0n && p.y.c1 === 0n) return null;
+
+  const xSquared = fp2Mul(p.x, p.x, G2_MODULUS);
+  const numerator = fp2Add(fp2Add(xSquared, xSquared, G2_MODULUS), xSquared, G2_MODULUS);
+  const lambda = fp2Mul(
+    numerator,
+    fp2Inv(fp2Add(p.y, p.y, G2_MODULUS), G2_MODULUS),
+    G2_MODULUS
+  );
+  const x3 = fp2Sub(fp2Sub(fp2Mul(lambda, lambda, G2_MODULUS), p.x, G2_MODULUS), p.x, G2_MODULUS);
+  const y3 = fp2Sub(fp2Mul(lambda, fp2Sub(p.x, x3, G2_MODULUS), G2_MODULUS), p.y, G2_MODULUS);
+  return { x: x3, y: y3 };
+}
+
+function g2ScalarMul(scalar: bigint, point: { x: Fp2; y: Fp2 }): G2Point {
+  let result: G2Point = null;
+  let addend: G2Point = point;
+  let k = scalar;
+  while (k > 0n) {
+    if (k & 1n) {
+      result = g2Add(result, addend);
+    }
+    addend = g2Add(addend, addend);
+    k >>= 1n;
+  }
+  return result;
+}
+
+describe.skipIf(binding?.msmExecuteG2 === undefined)('Native BN254 G2 MSM', () => {
+  it('uses a generator that satisfies the twist equation', () => {
+    // y^2 = x^3 + 3/(9 + u) — sanity check on the hardcoded constants
+    const b = fp2Mul(
+      { c0: 3n, c1: 0n },
+      fp2Inv({ c0: 9n, c1: 1n }, G2_MODULUS),
+      G2_MODULUS
+    );
+    const lhs = fp2Mul(G2_GENERATOR.y, G2_GENERATOR.y, G2_MODULUS);
+    const xCubed = fp2Mul(
+      fp2Mul(G2_GENERATOR.x, G2_GENERATOR.x, G2_MODULUS),
+      G2_GENERATOR.x,
+      G2_MODULUS
+    );
+    const rhs = fp2Add(xCubed, b, G2_MODULUS);
+
+    expect(lhs).toEqual(rhs);
+  });
+
+  it('returns the generator for a single unit scalar', () => {
+    const msmExecuteG2 = binding!.msmExecuteG2!;
+
+    const points = g2AffinePointToMontLimbs(G2_GENERATOR.x, G2_GENERATOR.y, G2_MODULUS, 4);
+    const result = msmExecuteG2(points, bigintToLimbs(1n, 4), 1);
+
+    const affine = g2JacobianMontLimbsToAffine(result, G2_MODULUS, 4);
+    expect(affine.isInfinity).toBe(false);
+    expect(affine.x).toEqual(G2_GENERATOR.x);
+    expect(affine.y).toEqual(G2_GENERATOR.y);
+  });
+
+  it('matches the affine Fp2 reference MSM', () => {
+    const msmExecuteG2 = binding!.msmExecuteG2!;
+
+    fc.assert(
+      fc.property(arbitraryMsmInput(8), ({ scalars, pointScalars }) => {
+        const n = scalars.length;
+        const basePoints = pointScalars.map(
+          (k) => g2ScalarMul(k, G2_GENERATOR) as { x: Fp2; y: Fp2 }
+        );
+
+        const pointLimbs = new BigUint64Array(n * 16);
+        for (let i = 0; i < n; i++) {
+          pointLimbs.set(
+            g2AffinePointToMontLimbs(basePoints[i]!.x, basePoints[i]!.y, G2_MODULUS, 4),
+            i * 16
+          );
+        }
+        const scalarLimbs = new BigUint64Array(n * 4);
+        for (let i = 0; i < n; i++) {
+          scalarLimbs.set(bigintToLimbs(scalars[i]!, 4), i * 4);
+        }
+
+        let expected: G2Point = null;
+        for (let i = 0; i < n; i++) {
+          expected = g2Add(expected, g2ScalarMul(scalars[i]!, basePoints[i]!));
+        }
+
+        const native = g2JacobianMontLimbsToAffine(
+          msmExecuteG2(pointLimbs, scalarLimbs, n),
+          G2_MODULUS,
+          4
+        );
+
+        expect(native.isInfinity).toBe(expected === null);
+        if (expected !== null) {
+          expect(native.x).toEqual(expected.x);
+          expect(native.y).toEqual(expected.y);
+        }
+      }),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+});
+
+describe.skipIf(binding?.msmRecodeScalars === undefined)('Native signed-digit recoding', () => {
+  it('reconstructs every scalar exactly from its bucket entries', () => {
+    const msmRecodeScalars = binding!.msmRecodeScalars!;
+
+    fc.assert(
+      fc.property(
+        fc.array(arbitraryFieldValue(BN254_SCALAR_MODULUS), { minLength: 1, maxLength: 16 }),
+        fc.integer({ min: 2, max: 16 }),
+        (scalars, windowSize) => {
+          const n = scalars.length;
+          const scalarLimbs = new BigUint64Array(n * 4);
+          for (let i = 0; i < n; i++) {
+            scalarLimbs.set(bigintToLimbs(scalars[i]!, 4), i * 4);
+          }
+
+          const { numWindows, entries, counts } = msmRecodeScalars(scalarLimbs, n, windowSize);
+          expect(counts.length).toBe(numWindows);
+          expect(entries.length).toBe(n * numWindows * 4);
+
+          // Sum each point's signed digits back into an integer; a digit
+          // with sign set contributes -(bucketIndex + 1) at its window
+          const reconstructed = new Array<bigint>(n).fill(0n);
+          for (let w = 0; w < numWindows; w++) {
+            const count = counts[w]!;
+            expect(count).toBeLessThanOrEqual(n);
+
+            for (let e = 0; e < count; e++) {
+              const base = (w * n + e) * 4;
+              const pointIndex = entries[base]!;
+              const bucketIndex = entries[base + 1]!;
+              const windowIndex = entries[base + 2]!;
+              const sign = entries[base + 3]!;
+
+              expect(windowIndex).toBe(w);
+              expect(pointIndex).toBeLessThan(n);
+
+              const digit = sign === 1 ? -BigInt(bucketIndex + 1) : BigInt(bucketIndex + 1);
+              reconstructed[pointIndex] =
+                (reconstructed[pointIndex] ?? 0n) + (digit << BigInt(w * windowSize));
+            }
+          }
+
+          for (let i = 0; i < n; i++) {
+            expect(reconstructed[i]).toBe(scalars[i]);
+          }
+        }
+      ),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('keeps each window sorted by bucket then point index', () => {
+    const msmRecodeScalars = binding!.msmRecodeScalars!;
+
+    fc.assert(
+      fc.property(
+        fc.array(arbitraryFieldValue(BN254_SCALAR_MODULUS), { minLength: 2, maxLength: 32 }),
+        fc.integer({ min: 2, max: 16 }),
+        (scalars, windowSize) => {
+          const n = scalars.length;
+          const scalarLimbs = new BigUint64Array(n * 4);
+          for (let i = 0; i < n; i++) {
+            scalarLimbs.set(bigintToLimbs(scalars[i]!, 4), i * 4);
+          }
+
+          const { numWindows, entries, counts } = msmRecodeScalars(scalarLimbs, n, windowSize);
+
+          const halfWindow = 1 << (windowSize - 1);
+          for (let w = 0; w < numWindows; w++) {
+            for (let e = 0; e < counts[w]!; e++) {
+              const base = (w * n + e) * 4;
+              expect(entries[base + 1]!).toBeLessThan(halfWindow);
+
+              if (e > 0) {
+                const prev = (w * n + e - 1) * 4;
+                const ordered =
+                  entries[prev + 1]! < entries[base + 1]! ||
+                  (entries[prev + 1] === entries[base + 1] && entries[prev]! < entries[base]!);
+                expect(ordered).toBe(true);
+              }
+            }
+          }
+        }
+      ),
+      PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('rejects window sizes outside 2..16', () => {
+    const msmRecodeScalars = binding!.msmRecodeScalars!;
+    const scalars = new BigUint64Array(4);
+
+    expect(() => msmRecodeScalars(scalars, 1, 1)).toThrow();
+    expect(() => msmRecodeScalars(scalars, 1, 17)).toThrow();
+  });
+});
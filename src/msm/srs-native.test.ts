@@ -0,0 +1,135 @@
+/**
+ * Tests for the Native Memory-Mapped SRS Loader
+ *
+ * Covers the write/open round trip, the zero-copy limb views, range
+ * prefetching, and handle invalidation on close (a closed handle must
+ * not be able to unmap the file a second time). Skipped when the C++
+ * addon is not available.
+ */
+
+import { describe, it, expect, beforeAll, afterAll } from 'vitest';
+import * as fs from 'node:fs';
+import * as os from 'node:os';
+import * as path from 'node:path';
+import { loadCppBinding } from '../native.js';
+
+const binding = loadCppBinding();
+
+const hasSrs =
+  binding?.srsWrite !== undefined &&
+  binding?.srsOpen !== undefined &&
+  binding?.srsClose !== undefined &&
+  binding?.srsPrefetch !== undefined;
+
+/** Matches SRS_FLAG_MONTGOMERY in the native header */
+const SRS_FLAG_MONTGOMERY = 0x1;
+
+/**
+ * Fill a limb array with a deterministic pseudo-random pattern
+ */
+function fillLimbs(length: number, seed: bigint): BigUint64Array {
+  const out = new BigUint64Array(length);
+  const mask = (1n << 64n) - 1n;
+  let state = seed;
+  for (let i = 0; i < length; i++) {
+    state = (state * 6364136223846793005n + 1442695040888963407n) & mask;
+    out[i] = state;
+  }
+  return out;
+}
+
+describe.skipIf(!hasSrs)('Native SRS loader', () => {
+  let tmpDir: string;
+
+  beforeAll(() => {
+    tmpDir = fs.mkdtempSync(path.join(os.tmpdir(), 'zk-accelerate-srs-'));
+  });
+
+  afterAll(() => {
+    fs.rmSync(tmpDir, { recursive: true, force: true });
+  });
+
+  it('round-trips points through write and open', () => {
+    const filePath = path.join(tmpDir, 'points-only.srs');
+    const numPoints = 64;
+    const pointLimbs = 8;
+    const points = fillLimbs(numPoints * pointLimbs, 1n);
+
+    expect(binding!.srsWrite!(filePath, points, pointLimbs)).toBe(true);
+
+    const srs = binding!.srsOpen!(filePath);
+    try {
+      expect(srs.numPoints).toBe(numPoints);
+      expect(srs.numScalars).toBe(0);
+      expect(srs.pointLimbs).toBe(pointLimbs);
+      expect(srs.scalars).toBeUndefined();
+      expect(srs.points.length).toBe(numPoints * pointLimbs);
+
+      for (let i = 0; i < points.length; i++) {
+        expect(srs.points[i]).toBe(points[i]);
+      }
+    } finally {
+      binding!.srsClose!(srs);
+    }
+  });
+
+  it('round-trips points and scalars with flags', () => {
+    const filePath = path.join(tmpDir, 'points-scalars.srs');
+    const numPoints = 32;
+    const pointLimbs = 8;
+    const scalarLimbs = 4;
+    const points = fillLimbs(numPoints * pointLimbs, 2n);
+    const scalars = fillLimbs(numPoints * scalarLimbs, 3n);
+
+    expect(
+      binding!.srsWrite!(filePath, points, pointLimbs, scalars, scalarLimbs, SRS_FLAG_MONTGOMERY)
+    ).toBe(true);
+
+    const srs = binding!.srsOpen!(filePath);
+    try {
+      expect(srs.numPoints).toBe(numPoints);
+      expect(srs.numScalars).toBe(numPoints);
+      expect(srs.scalarLimbs).toBe(scalarLimbs);
+      expect(srs.flags).toBe(SRS_FLAG_MONTGOMERY);
+
+      expect(srs.scalars).toBeDefined();
+      for (let i = 0; i < scalars.length; i++) {
+        expect(srs.scalars![i]).toBe(scalars[i]);
+      }
+    } finally {
+      binding!.srsClose!(srs);
+    }
+  });
+
+  it('prefetches point ranges on an open mapping', () => {
+    const filePath = path.join(tmpDir, 'prefetch.srs');
+    const points = fillLimbs(128 * 8, 4n);
+    expect(binding!.srsWrite!(filePath, points, 8)).toBe(true);
+
+    const srs = binding!.srsOpen!(filePath);
+    try {
+      expect(binding!.srsPrefetch!(srs, 0, 64)).toBe(true);
+      expect(binding!.srsPrefetch!(srs, 64, 64)).toBe(true);
+    } finally {
+      binding!.srsClose!(srs);
+    }
+  });
+
+  it('invalidates the handle on close so a double close cannot double-free', () => {
+    const filePath = path.join(tmpDir, 'double-close.srs');
+    const points = fillLimbs(16 * 8, 5n);
+    expect(binding!.srsWrite!(filePath, points, 8)).toBe(true);
+
+    const srs = binding!.srsOpen!(filePath);
+    binding!.srsClose!(srs);
+
+    // The stale views and native pointer are dropped with the mapping
+    expect(srs.points).toBeUndefined();
+    expect(() => binding!.srsClose!(srs)).toThrow(/Invalid SRS handle/);
+    expect(binding!.srsPrefetch!(srs, 0, 1)).toBe(false);
+  });
+
+  it('throws when opening a missing file', () => {
+    expect(() => binding!.srsOpen!(path.join(tmpDir, 'does-not-exist.srs'))).toThrow();
+  });
+});
@@ -39,6 +39,9 @@ export interface NativeCppBinding {
   vdspVectorAdd?(a: Float64Array, b: Float64Array): Float64Array;
   vdspVectorMul?(a: Float64Array, b: Float64Array): Float64Array;
   vdspVectorSub?(a: Float64Array, b: Float64Array): Float64Array;
+  vdspVectorAddInto?(a: Float64Array, b: Float64Array, out: Float64Array): Float64Array;
+  vdspVectorMulInto?(a: Float64Array, b: Float64Array, out: Float64Array): Float64Array;
+  vdspVectorSubInto?(a: Float64Array, b: Float64Array, out: Float64Array): Float64Array;
   blasMatrixMul?(
     a: Float64Array,
     b: Float64Array,
@@ -46,8 +49,235 @@ export interface NativeCppBinding {
     n: number,
     k: number
   ): Float64Array;
+  neonBatchMontgomeryMul?(
+    a: BigUint64Array,
+    b: BigUint64Array,
+    modulus: BigUint64Array,
+    mu: bigint,
+    count: number,
+    limbCount: number
+  ): BigUint64Array;
+  neonBatchMontgomeryMulAsync?(
+    a: BigUint64Array,
+    b: BigUint64Array,
+    modulus: BigUint64Array,
+    mu: bigint,
+    count: number,
+    limbCount: number
+  ): Promise<BigUint64Array>;
+  neonBatchMontgomeryMulSoa?(
+    a: BigUint64Array,
+    b: BigUint64Array,
+    modulus: BigUint64Array,
+    mu: bigint,
+    count: number,
+    limbCount: number
+  ): BigUint64Array;
+  neonBatchFp2MontgomeryMul?(
+    a: BigUint64Array,
+    b: BigUint64Array,
+    modulus: BigUint64Array,
+    mu: bigint,
+    count: number,
+    limbCount: number
+  ): BigUint64Array;
+  neonBatchInverse?(
+    elements: BigUint64Array,
+    modulus: BigUint64Array,
+    mu: bigint,
+    count: number,
+    limbCount: number
+  ): BigUint64Array;
+  msmExecute?(points: BigUint64Array, scalars: BigUint64Array, n: number): BigUint64Array;
+  msmExecuteAsync?(
+    points: BigUint64Array,
+    scalars: BigUint64Array,
+    n: number
+  ): Promise<BigUint64Array>;
+  msmExecuteBls12381?(
+    points: BigUint64Array,
+    scalars: BigUint64Array,
+    n: number
+  ): BigUint64Array;
+  msmExecuteBls12381Async?(
+    points: BigUint64Array,
+    scalars: BigUint64Array,
+    n: number
+  ): Promise<BigUint64Array>;
+  msmExecuteG2?(
+    points: BigUint64Array,
+    scalars: BigUint64Array,
+    n: number
+  ): BigUint64Array;
+  msmExecuteG2Async?(
+    points: BigUint64Array,
+    scalars: BigUint64Array,
+    n: number
+  ): Promise<BigUint64Array>;
+  msmRecodeScalars?(
+    scalars: BigUint64Array,
+    n: number,
+    windowSize: number
+  ): {
+    numWindows: number;
+    entries: Uint32Array;
+    counts: Uint32Array;
+  };
+  msmIncrementalCreate?(
+    points: BigUint64Array,
+    scalars: BigUint64Array | null,
+    n: number,
+    windowSize?: number
+  ): { n: number };
+  msmIncrementalUpdate?(
+    state: object,
+    index: number,
+    oldScalar: BigUint64Array,
+    newScalar: BigUint64Array
+  ): boolean;
+  msmIncrementalCommit?(state: object): BigUint64Array;
+  msmIncrementalCommitAsync?(state: object): Promise<BigUint64Array>;
+  msmIncrementalSerialize?(state: object): Uint8Array;
+  msmIncrementalDeserialize?(
+    points: BigUint64Array,
+    n: number,
+    data: Uint8Array
+  ): { n: number };
+  msmIncrementalDestroy?(state: object): void;
+  fixedBaseTableCreate?(
+    point: BigUint64Array,
+    windowSize?: number
+  ): { windowSize: number };
+  fixedBaseMul?(table: object, scalar: BigUint64Array): BigUint64Array;
+  fixedBaseTableSerialize?(table: object): Uint8Array;
+  fixedBaseTableDeserialize?(data: Uint8Array): object;
+  fixedBaseTableDestroy?(table: object): void;
   neonAvailable?(): boolean;
   smeAvailable?(): boolean;
+  srsOpen?(path: string): {
+    numPoints: number;
+    numScalars: number;
+    pointLimbs: number;
+    scalarLimbs: number;
+    flags: number;
+    points: BigUint64Array;
+    scalars?: BigUint64Array;
+  };
+  srsClose?(srs: object): void;
+  srsPrefetch?(srs: object, startPoint: number, count: number): boolean;
+  srsWrite?(
+    path: string,
+    points: BigUint64Array,
+    pointLimbs: number,
+    scalars?: BigUint64Array,
+    scalarLimbs?: number,
+    flags?: number
+  ): boolean;
+  autotuneWarmup?(): Promise<boolean>;
+  autotuneGetProfile?(): {
+    fingerprint: string;
+    msmGpuCrossover: number | null;
+    msmWindowSizes: number[];
+    neonMulNsPerOp: number;
+    blasGflops: number;
+    gpuMsmBaseMs: number;
+  } | null;
+  arenaCreate?(slabBytes?: number): { [key: string]: unknown };
+  arenaInstall?(arena: object | null): boolean;
+  arenaReset?(arena: object): boolean;
+  arenaDestroy?(arena: object): void;
+  arenaGetStats?(arena: object): {
+    reservedBytes: number;
+    usedBytes: number;
+    peakBytes: number;
+    slabCount: number;
+    resets: number;
+  };
+  getPerfCounters?(): {
+    kernels: {
+      name: string;
+      count: number;
+      totalMs: number;
+      minMs: number;
+      maxMs: number;
+      p50Ms: number;
+      p95Ms: number;
+      p99Ms: number;
+    }[];
+    bytesToGpu: number;
+    bytesFromGpu: number;
+    pool?: {
+      hits: number;
+      misses: number;
+      releases: number;
+      evictions: number;
+      buffersPooled: number;
+      bytesPooled: number;
+    };
+  };
+  resetPerfCounters?(): void;
+  metalGpuBufferContents?(buffer: object): BigUint64Array | null;
+  // Async (promise-returning) GPU kernels
+  metalGpuMsmAsync?(
+    scalarsBuffer: object,
+    pointsBuffer: object,
+    resultBuffer: object,
+    numPoints: number,
+    windowSize?: number
+  ): Promise<{ success: boolean; executionTimeMs: number }>;
+  metalGpuMsmChunkedAsync?(
+    scalars: BigUint64Array,
+    points: BigUint64Array,
+    numPoints: number,
+    windowSize?: number
+  ): Promise<BigUint64Array>;
+  metalGpuNttForwardAsync?(
+    dataBuffer: object,
+    twiddlesBuffer: object,
+    n: number,
+    modulus: BigUint64Array
+  ): Promise<{ success: boolean; executionTimeMs: number }>;
+  metalGpuNttInverseAsync?(
+    dataBuffer: object,
+    twiddlesInvBuffer: object,
+    nInvBuffer: object,
+    n: number,
+    modulus: BigUint64Array
+  ): Promise<{ success: boolean; executionTimeMs: number }>;
+  metalGpuNttBatchAsync?(
+    dataBuffer: object,
+    twiddlesBuffer: object,
+    n: number,
+    batchSize: number,
+    forward: boolean,
+    modulus: BigUint64Array
+  ): Promise<{ success: boolean; executionTimeMs: number }>;
+  nttPlanCreate?(
+    modulus: BigUint64Array,
+    rootOfUnity: BigUint64Array,
+    n: number
+  ): { n: number };
+  nttCpuPlanCreate?(
+    modulus: BigUint64Array,
+    rootOfUnity: BigUint64Array,
+    n: number
+  ): { n: number };
+  nttCpuExecuteAsync?(
+    plan: object,
+    data: BigUint64Array,
+    forward: boolean
+  ): Promise<BigUint64Array>;
+  nttPlanExecuteAsync?(
+    plan: object,
+    dataBuffer: object,
+    forward: boolean
+  ): Promise<{ success: boolean; executionTimeMs: number }>;
+  nttPlanExecuteBatchAsync?(
+    plan: object,
+    dataBuffer: object,
+    batchSize: number,
+    forward: boolean
+  ): Promise<{ success: boolean; executionTimeMs: number }>;
 }
 
 /**
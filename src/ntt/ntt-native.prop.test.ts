@@ -0,0 +1,256 @@
+/**
+ * Property-Based Tests for the Native NTT Plan Engines
+ *
+ * **Property 1: The CPU plan forward transform matches a naive DFT**
+ * **Property 2: Inverse(Forward(x)) round-trips every input**
+ * **Property 3: Plans are cached per (modulus, root, n) — two plans
+ * with different roots over the same field must not share tables**
+ * **Property 4: The GPU plan engine agrees with the CPU engine**
+ *
+ * The plan APIs take the modulus and root of unity as 4-limb arrays
+ * and carry element data as canonical (non-Montgomery) limbs. The GPU
+ * suite doubles as the GPU-vs-CPU comparison gate for the Metal NTT
+ * kernels and is skipped wherever Metal is unavailable.
+ *
+ * **Validates: Requirements 3.1, 3.2**
+ */
+
+import { describe, it, expect } from 'vitest';
+import * as fc from 'fast-check';
+import {
+  FAST_PROPERTY_TEST_CONFIG,
+  arbitraryFieldValue,
+  modPow,
+  modMul,
+  BN254_SCALAR_MODULUS,
+} from '../test-utils/property-test-config.js';
+import {
+  bigintToLimbs,
+  limbsToBigintAt,
+} from '../test-utils/native-test-helpers.js';
+import { loadCppBinding, type NativeCppBinding } from '../native.js';
+
+const binding = loadCppBinding();
+
+/** BN254 scalar field, the working field for circuit-size NTTs */
+const MODULUS = BN254_SCALAR_MODULUS;
+
+/** 5 generates the multiplicative group of the BN254 scalar field */
+const GROUP_GENERATOR = 5n;
+
+/**
+ * Primitive n-th root of unity: g^((r-1)/n) for power-of-two n up to
+ * the field's two-adicity (2^28)
+ */
+function rootOfUnity(n: number): bigint {
+  return modPow(GROUP_GENERATOR, (MODULUS - 1n) / BigInt(n), MODULUS);
+}
+
+/**
+ * Naive O(n^2) DFT over the scalar field: X_k = sum_j x_j * w^(jk)
+ */
+function naiveDft(values: bigint[], root: bigint): bigint[] {
+  const n = values.length;
+  const result = new Array<bigint>(n);
+  for (let k = 0; k < n; k++) {
+    let acc = 0n;
+    for (let j = 0; j < n; j++) {
+      acc = (acc + modMul(values[j]!, modPow(root, BigInt(j * k), MODULUS), MODULUS)) % MODULUS;
+    }
+    result[k] = acc;
+  }
+  return result;
+}
+
+/**
+ * Pack canonical values into the 4-limb-per-element wire format
+ */
+function encodeElements(values: bigint[]): BigUint64Array {
+  const out = new BigUint64Array(values.length * 4);
+  for (let i = 0; i < values.length; i++) {
+    out.set(bigintToLimbs(values[i]!, 4), i * 4);
+  }
+  return out;
+}
+
+/**
+ * Unpack 4-limb elements back to canonical bigints
+ */
+function decodeElements(limbs: BigUint64Array, n: number): bigint[] {
+  const out = new Array<bigint>(n);
+  for (let i = 0; i < n; i++) {
+    out[i] = limbsToBigintAt(limbs, i * 4, 4);
+  }
+  return out;
+}
+
+const MODULUS_LIMBS = bigintToLimbs(MODULUS, 4);
+
+const hasCpuPlan =
+  binding?.nttCpuPlanCreate !== undefined && binding?.nttCpuExecuteAsync !== undefined;
+
+describe.skipIf(!hasCpuPlan)('Native CPU NTT plans', () => {
+  it('matches the naive DFT for small sizes', async () => {
+    await fc.assert(
+      fc.asyncProperty(
+        fc.constantFrom(4, 8, 16),
+        fc.array(arbitraryFieldValue(MODULUS), { minLength: 16, maxLength: 16 }),
+        async (n, values) => {
+          const input = values.slice(0, n);
+          const root = rootOfUnity(n);
+          const plan = binding!.nttCpuPlanCreate!(MODULUS_LIMBS, bigintToLimbs(root, 4), n);
+
+          const transformed = await binding!.nttCpuExecuteAsync!(plan, encodeElements(input), true);
+
+          expect(decodeElements(transformed, n)).toEqual(naiveDft(input, root));
+        }
+      ),
+      FAST_PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('round-trips through forward and inverse', async () => {
+    await fc.assert(
+      fc.asyncProperty(
+        fc.constantFrom(4, 16, 64, 256),
+        fc.array(arbitraryFieldValue(MODULUS), { minLength: 256, maxLength: 256 }),
+        async (n, values) => {
+          const input = values.slice(0, n);
+          const plan = binding!.nttCpuPlanCreate!(
+            MODULUS_LIMBS,
+            bigintToLimbs(rootOfUnity(n), 4),
+            n
+          );
+
+          const forward = await binding!.nttCpuExecuteAsync!(plan, encodeElements(input), true);
+          const inverse = await binding!.nttCpuExecuteAsync!(plan, forward, false);
+
+          expect(decodeElements(inverse, n)).toEqual(input);
+        }
+      ),
+      FAST_PROPERTY_TEST_CONFIG
+    );
+  });
+
+  it('does not share cached tables between plans with different roots', async () => {
+    // Regression check for the plan cache key: w and w^3 are distinct
+    // primitive roots over the same (modulus, n), so the two plans must
+    // each match the DFT taken with their own root
+    const n = 16;
+    const w = rootOfUnity(n);
+    const wCubed = modPow(w, 3n, MODULUS);
+    const input = Array.from({ length: n }, (_, i) => BigInt(i + 1));
+
+    const planW = binding!.nttCpuPlanCreate!(MODULUS_LIMBS, bigintToLimbs(w, 4), n);
+    const planWCubed = binding!.nttCpuPlanCreate!(MODULUS_LIMBS, bigintToLimbs(wCubed, 4), n);
+
+    const fromW = await binding!.nttCpuExecuteAsync!(planW, encodeElements(input), true);
+    const fromWCubed = await binding!.nttCpuExecuteAsync!(planWCubed, encodeElements(input), true);
+
+    expect(decodeElements(fromW, n)).toEqual(naiveDft(input, w));
+    expect(decodeElements(fromWCubed, n)).toEqual(naiveDft(input, wCubed));
+  });
+
+  it('leaves the caller input array untouched', async () => {
+    const n = 64;
+    const input = Array.from({ length: n }, (_, i) => BigInt(i) * 7n + 3n);
+    const encoded = encodeElements(input);
+    const snapshot = new BigUint64Array(encoded);
+
+    const plan = binding!.nttCpuPlanCreate!(MODULUS_LIMBS, bigintToLimbs(rootOfUnity(n), 4), n);
+    await binding!.nttCpuExecuteAsync!(plan, encoded, true);
+
+    expect(encoded).toEqual(snapshot);
+  });
+});
+
+/**
+ * Metal buffer management exports used by the GPU plan path; they sit
+ * outside the typed binding interface (the MetalGPU class owns them)
+ */
+interface MetalBufferBinding {
+  metalGpuInit?(): boolean;
+  metalGpuAllocBuffer?(size: number, shared: boolean): object | null;
+  metalGpuCopyToBuffer?(buffer: object, data: Uint8Array, offset: number): boolean;
+  metalGpuFreeBuffer?(buffer: object): void;
+}
+
+const gpuBinding = binding as (NativeCppBinding & MetalBufferBinding) | null;
+
+const hasGpuPlan =
+  hasCpuPlan &&
+  binding?.nttPlanCreate !== undefined &&
+  binding?.nttPlanExecuteAsync !== undefined &&
+  binding?.metalGpuBufferContents !== undefined &&
+  gpuBinding?.metalGpuAllocBuffer !== undefined &&
+  gpuBinding?.metalGpuCopyToBuffer !== undefined &&
+  gpuBinding?.metalGpuFreeBuffer !== undefined &&
+  gpuBinding?.metalGpuInit?.() === true;
+
+describe.skipIf(!hasGpuPlan)('Native GPU NTT plans', () => {
+  /**
+   * Upload canonical elements into a fresh shared GPU buffer
+   */
+  function uploadElements(values: bigint[]): object {
+    const encoded = encodeElements(values);
+    const buffer = gpuBinding!.metalGpuAllocBuffer!(encoded.byteLength, true);
+    expect(buffer).not.toBeNull();
+
+    const bytes = new Uint8Array(encoded.buffer, encoded.byteOffset, encoded.byteLength);
+    expect(gpuBinding!.metalGpuCopyToBuffer!(buffer!, bytes, 0)).toBe(true);
+    return buffer!;
+  }
+
+  /**
+   * Read n elements back out of a shared GPU buffer
+   */
+  function readElements(buffer: object, n: number): bigint[] {
+    const contents = binding!.metalGpuBufferContents!(buffer);
+    expect(contents).not.toBeNull();
+    return decodeElements(contents!.subarray(0, n * 4), n);
+  }
+
+  it('agrees with the CPU plan engine on the forward transform', async () => {
+    const n = 1024;
+    const input = Array.from({ length: n }, (_, i) =>
+      modPow(GROUP_GENERATOR, BigInt(i + 1), MODULUS)
+    );
+    const rootLimbs = bigintToLimbs(rootOfUnity(n), 4);
+
+    const cpuPlan = binding!.nttCpuPlanCreate!(MODULUS_LIMBS, rootLimbs, n);
+    const expected = await binding!.nttCpuExecuteAsync!(cpuPlan, encodeElements(input), true);
+
+    const gpuPlan = binding!.nttPlanCreate!(MODULUS_LIMBS, rootLimbs, n);
+    const buffer = uploadElements(input);
+    try {
+      const result = await binding!.nttPlanExecuteAsync!(gpuPlan, buffer, true);
+      expect(result.success).toBe(true);
+
+      expect(readElements(buffer, n)).toEqual(decodeElements(expected, n));
+    } finally {
+      gpuBinding!.metalGpuFreeBuffer!(buffer);
+    }
+  });
+
+  it('round-trips through forward and inverse on the GPU', async () => {
+    const n = 256;
+    const input = Array.from({ length: n }, (_, i) => BigInt(i) * 11n + 1n);
+
+    const gpuPlan = binding!.nttPlanCreate!(
+      MODULUS_LIMBS,
+      bigintToLimbs(rootOfUnity(n), 4),
+      n
+    );
+    const buffer = uploadElements(input);
+    try {
+      const forward = await binding!.nttPlanExecuteAsync!(gpuPlan, buffer, true);
+      expect(forward.success).toBe(true);
+      const inverse = await binding!.nttPlanExecuteAsync!(gpuPlan, buffer, false);
+      expect(inverse.success).toBe(true);
+
+      expect(readElements(buffer, n)).toEqual(input);
+    } finally {
+      gpuBinding!.metalGpuFreeBuffer!(buffer);
+    }
+  });
+});
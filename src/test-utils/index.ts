@@ -14,3 +14,6 @@ export * from './property-test-config.js';
 
 // Field element and curve point comparison utilities
 export * from './field-comparison.js';
+
+// Limb and Montgomery-form conversion helpers for native kernel tests
+export * from './native-test-helpers.js';
@@ -0,0 +1,206 @@
+/**
+ * Helpers for testing the native kernel exports
+ *
+ * The C++ addon exchanges data as raw little-endian limb arrays
+ * (BigUint64Array): curve point coordinates travel in Montgomery form,
+ * scalars as plain reduced integers, and MSM results come back as
+ * Jacobian coordinates. These helpers convert between that wire format
+ * and plain bigints so tests can compare native results against the
+ * TypeScript reference implementations.
+ */
+
+import { modInverse, modMul } from './property-test-config.js';
+
+/**
+ * Convert a bigint to little-endian 64-bit limbs
+ */
+export function bigintToLimbs(value: bigint, limbCount: number): BigUint64Array {
+  const limbs = new BigUint64Array(limbCount);
+  const mask = (1n << 64n) - 1n;
+
+  let v = value;
+  for (let i = 0; i < limbCount; i++) {
+    limbs[i] = v & mask;
+    v >>= 64n;
+  }
+
+  return limbs;
+}
+
+/**
+ * Read one limbCount-limb little-endian value out of a larger limb array
+ */
+export function limbsToBigintAt(
+  limbs: BigUint64Array,
+  offset: number,
+  limbCount: number
+): bigint {
+  let result = 0n;
+  for (let i = limbCount - 1; i >= 0; i--) {
+    const limb = limbs[offset + i];
+    if (limb !== undefined) {
+      result = (result << 64n) | limb;
+    }
+  }
+  return result;
+}
+
+/**
+ * Convert a canonical value to Montgomery form: value * R mod p,
+ * where R = 2^(64 * limbCount)
+ */
+export function toMontgomery(value: bigint, modulus: bigint, limbCount: number): bigint {
+  return (value << (64n * BigInt(limbCount))) % modulus;
+}
+
+/**
+ * Convert a Montgomery-form value back to canonical: value * R^-1 mod p
+ */
+export function fromMontgomery(value: bigint, modulus: bigint, limbCount: number): bigint {
+  const r = (1n << (64n * BigInt(limbCount))) % modulus;
+  return modMul(value, modInverse(r, modulus), modulus);
+}
+
+/**
+ * Affine point with plain bigint coordinates (canonical form)
+ */
+export interface AffineBigintPoint {
+  x: bigint;
+  y: bigint;
+  isInfinity: boolean;
+}
+
+/**
+ * Pack one affine point into the native wire format: x then y, each
+ * limbCount limbs in Montgomery form
+ */
+export function affinePointToMontLimbs(
+  x: bigint,
+  y: bigint,
+  modulus: bigint,
+  limbCount: number
+): BigUint64Array {
+  const out = new BigUint64Array(2 * limbCount);
+  out.set(bigintToLimbs(toMontgomery(x, modulus, limbCount), limbCount), 0);
+  out.set(bigintToLimbs(toMontgomery(y, modulus, limbCount), limbCount), limbCount);
+  return out;
+}
+
+/**
+ * Decode a native Jacobian result (X, Y, Z in Montgomery form, 3 *
+ * limbCount limbs) into a canonical affine point
+ */
+export function jacobianMontLimbsToAffine(
+  limbs: BigUint64Array,
+  modulus: bigint,
+  limbCount: number
+): AffineBigintPoint {
+  const x = fromMontgomery(limbsToBigintAt(limbs, 0, limbCount), modulus, limbCount);
+  const y = fromMontgomery(limbsToBigintAt(limbs, limbCount, limbCount), modulus, limbCount);
+  const z = fromMontgomery(limbsToBigintAt(limbs, 2 * limbCount, limbCount), modulus, limbCount);
+
+  if (z === 0n) {
+    return { x: 0n, y: 0n, isInfinity: true };
+  }
+
+  const zInv = modInverse(z, modulus);
+  const zInv2 = modMul(zInv, zInv, modulus);
+  const zInv3 = modMul(zInv2, zInv, modulus);
+  return {
+    x: modMul(x, zInv2, modulus),
+    y: modMul(y, zInv3, modulus),
+    isInfinity: false,
+  };
+}
+
+/**
+ * Element of Fp2 = Fp[u] / (u^2 + 1), as used by the G2 kernels
+ */
+export interface Fp2 {
+  c0: bigint;
+  c1: bigint;
+}
+
+export function fp2Add(a: Fp2, b: Fp2, modulus: bigint): Fp2 {
+  return { c0: (a.c0 + b.c0) % modulus, c1: (a.c1 + b.c1) % modulus };
+}
+
+export function fp2Sub(a: Fp2, b: Fp2, modulus: bigint): Fp2 {
+  return {
+    c0: (a.c0 - b.c0 + modulus) % modulus,
+    c1: (a.c1 - b.c1 + modulus) % modulus,
+  };
+}
+
+/**
+ * Fp2 multiplication with u^2 = -1:
+ * (a0 + a1 u)(b0 + b1 u) = (a0 b0 - a1 b1) + (a0 b1 + a1 b0) u
+ */
+export function fp2Mul(a: Fp2, b: Fp2, modulus: bigint): Fp2 {
+  const c0 = (a.c0 * b.c0 - a.c1 * b.c1) % modulus;
+  const c1 = (a.c0 * b.c1 + a.c1 * b.c0) % modulus;
+  return { c0: (c0 + modulus) % modulus, c1: (c1 + modulus) % modulus };
+}
+
+/**
+ * Fp2 inversion via the norm: (a0 + a1 u)^-1 = (a0 - a1 u) / (a0^2 + a1^2)
+ */
+export function fp2Inv(a: Fp2, modulus: bigint): Fp2 {
+  const norm = (a.c0 * a.c0 + a.c1 * a.c1) % modulus;
+  const normInv = modInverse(norm, modulus);
+  return {
+    c0: modMul(a.c0, normInv, modulus),
+    c1: modMul((modulus - a.c1) % modulus, normInv, modulus),
+  };
+}
+
+/**
+ * Pack one affine G2 point into the native wire format: x.c0, x.c1,
+ * y.c0, y.c1, each limbCount limbs in Montgomery form
+ */
+export function g2AffinePointToMontLimbs(
+  x: Fp2,
+  y: Fp2,
+  modulus: bigint,
+  limbCount: number
+): BigUint64Array {
+  const out = new BigUint64Array(4 * limbCount);
+  const coords = [x.c0, x.c1, y.c0, y.c1];
+  for (let i = 0; i < coords.length; i++) {
+    const coord = coords[i];
+    if (coord !== undefined) {
+      out.set(bigintToLimbs(toMontgomery(coord, modulus, limbCount), limbCount), i * limbCount);
+    }
+  }
+  return out;
+}
+
+/**
+ * Decode a native G2 Jacobian result (X, Y, Z in Fp2, coefficients in
+ * Montgomery form, 6 * limbCount limbs) into a canonical affine point
+ */
+export function g2JacobianMontLimbsToAffine(
+  limbs: BigUint64Array,
+  modulus: bigint,
+  limbCount: number
+): { x: Fp2; y: Fp2; isInfinity: boolean } {
+  const coord = (index: number): bigint =>
+    fromMontgomery(limbsToBigintAt(limbs, index * limbCount, limbCount), modulus, limbCount);
+
+  const x: Fp2 = { c0: coord(0), c1: coord(1) };
+  const y: Fp2 = { c0: coord(2), c1: coord(3) };
+  const z: Fp2 = { c0: coord(4), c1: coord(5) };
+
+  if (z.c0 === 0n && z.c1 === 0n) {
+    return { x: { c0: 0n, c1: 0n }, y: { c0: 0n, c1: 0n }, isInfinity: true };
+  }
+
+  const zInv = fp2Inv(z, modulus);
+  const zInv2 = fp2Mul(zInv, zInv, modulus);
+  const zInv3 = fp2Mul(zInv2, zInv, modulus);
+  return {
+    x: fp2Mul(x, zInv2, modulus),
+    y: fp2Mul(y, zInv3, modulus),
+    isInfinity: false,
+  };
+}